@@ -1,3 +1,3 @@
 #!/bin/sh
 
-cd "$(dirname "$0")/../../Source/" && protoc-c --c_out=. "PLCrashReport.proto" && cd "../Tests/" && protoc-c --c_out=. "PLCrashLogWriterEncodingTests.proto"
\ No newline at end of file
+cd "$(dirname "$0")/../../Source/" && protoc-c --c_out=. "PLCrashReport.proto" && python3 ../Dependencies/protobuf-c/generate-pb-enc.py "PLCrashReport.proto" "PLCrashReport.pb-enc.h" && cd "../Tests/" && protoc-c --c_out=. "PLCrashLogWriterEncodingTests.proto"
\ No newline at end of file
@@ -0,0 +1,313 @@
+#!/usr/bin/env python3
+#
+# Generate async-safe, allocation-free encoders for the messages defined in a proto2 file.
+#
+# The generated header contains static inline functions that append fields to a plcrash_writer_message_t staging
+# buffer (see PLCrashLogWriterEncoding.h). Tag bytes and the sizes of fixed-width fields are emitted as compile-time
+# constants, and the size of a variable-width field is computed arithmetically from its value, allowing a message's
+# encoded size to be determined without a separate sizing pass over the message. Varints are sized and packed via
+# the shared plcrash_writer_varint_size() and plcrash_writer_varint_pack() kernels.
+#
+# Usage: generate-pb-enc.py <input.proto> <output.h>
+#
+# Only the subset of proto2 used by PLCrashReport.proto is supported: nested message and enum definitions, and
+# required, optional, and repeated scalar, enum, string, bytes, and message fields. Packed repeated fields are
+# supported for varint scalar types.
+#
+
+import os
+import re
+import sys
+
+# Scalar types: (C type, wire type, encoding)
+SCALARS = {
+    'int32':    ('int32_t',  0, 'int32'),
+    'int64':    ('int64_t',  0, 'varint'),
+    'uint32':   ('uint32_t', 0, 'varint'),
+    'uint64':   ('uint64_t', 0, 'varint'),
+    'sint32':   ('int32_t',  0, 'zigzag32'),
+    'sint64':   ('int64_t',  0, 'zigzag64'),
+    'bool':     ('bool',     0, 'bool'),
+    'fixed32':  ('uint32_t', 5, 'fixed32'),
+    'sfixed32': ('int32_t',  5, 'fixed32'),
+    'float':    ('float',    5, 'fixed32'),
+    'fixed64':  ('uint64_t', 1, 'fixed64'),
+    'sfixed64': ('int64_t',  1, 'fixed64'),
+    'double':   ('double',   1, 'fixed64'),
+}
+
+FIXED_SIZES = { 'bool': 1, 'fixed32': 4, 'fixed64': 8 }
+
+
+def snake (name):
+    """Convert a CamelCase message or field name to snake_case."""
+    name = re.sub(r'([a-z0-9])([A-Z])', r'\1_\2', name)
+    return name.lower()
+
+
+def strip_comments (text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def parse (text):
+    """Parse the proto definition, returning a list of (path, fields) tuples and the set of enum names."""
+    tokens = re.findall(r'[A-Za-z_][\w.]*|\d+|"[^"]*"|[{}=;\[\]]', strip_comments(text))
+    messages = []
+    enums = set()
+    stack = []
+    i = 0
+
+    while i < len(tokens):
+        tok = tokens[i]
+        if tok in ('syntax', 'package', 'option', 'import'):
+            while tokens[i] != ';':
+                i += 1
+            i += 1
+        elif tok == 'message':
+            stack.append((tokens[i + 1], []))
+            i += 3
+        elif tok == 'enum':
+            enums.add(tokens[i + 1])
+            depth = 0
+            while True:
+                if tokens[i] == '{':
+                    depth += 1
+                elif tokens[i] == '}':
+                    depth -= 1
+                    if depth == 0:
+                        break
+                i += 1
+            i += 1
+        elif tok in ('required', 'optional', 'repeated'):
+            ftype, fname, fnum = tokens[i + 1], tokens[i + 2], int(tokens[i + 4])
+            start = i
+            while tokens[i] != ';':
+                i += 1
+            packed = tok == 'repeated' and tokens[start:i][-5:] == ['[', 'packed', '=', 'true', ']']
+            stack[-1][1].append((fname, ftype, fnum, packed))
+            i += 1
+        elif tok == '}':
+            name, fields = stack.pop()
+            messages.append(([n for n, _ in stack] + [name], fields))
+            i += 1
+        else:
+            raise SystemExit('Unsupported token: %s' % tok)
+
+    messages.sort(key=lambda m: (len(m[0]), m[0]))
+    return messages, enums
+
+
+def varint (value):
+    out = []
+    while True:
+        byte = value & 0x7f
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return out
+
+
+def emit_field (out, path, fname, ftype, fnum, packed, enums):
+    prefix = 'plcrash_pb_' + '_'.join(snake(p) for p in path) + '__' + fname
+    macro = prefix.upper()
+    base = ftype.split('.')[-1]
+
+    if ftype in SCALARS:
+        ctype, wire, encoding = SCALARS[ftype]
+    elif base in enums:
+        ctype, wire, encoding = ('int32_t', 0, 'int32')
+    else:
+        ctype, wire, encoding = (None, 2, 'bytes' if ftype in ('string', 'bytes') else 'message')
+
+    if ftype in ('string', 'bytes'):
+        encoding = 'bytes'
+
+    if packed:
+        if wire != 0:
+            raise SystemExit('Unsupported packed field type: %s' % ftype)
+        wire, encoding = (2, 'packed')
+
+    tag = varint((fnum << 3) | wire)
+    tag_value = sum(b << (8 * i) for i, b in enumerate(tag))
+
+    out.append('/** %s.%s (%s) */' % ('.'.join(path), fname, ftype))
+    out.append('#define %s_NUMBER %d' % (macro, fnum))
+    out.append('/** The encoded tag of %s.%s, in little-endian byte order. */' % ('.'.join(path), fname))
+    out.append('#define %s_TAG 0x%XU' % (macro, tag_value))
+    out.append('#define %s_TAG_SIZE %d' % (macro, len(tag)))
+
+    if encoding in FIXED_SIZES:
+        out.append('#define %s_SIZE (%s_TAG_SIZE + %d)' % (macro, macro, FIXED_SIZES[encoding]))
+        out.append('')
+        out.append('static inline void %s_pack (plcrash_writer_message_t *msg, %s value) {' % (prefix, ctype))
+        out.append('    plcrash_pb_put_tag(msg, %s_TAG, %s_TAG_SIZE);' % (macro, macro))
+        if encoding == 'bool':
+            out.append('    msg->buffer[msg->length++] = value ? 1 : 0;')
+        else:
+            out.append('    plcrash_pb_put_%s(msg, &value);' % encoding)
+        out.append('}')
+    elif encoding in ('varint', 'int32', 'zigzag32', 'zigzag64'):
+        conv = {
+            'varint': '(uint64_t) value',
+            'int32': '(uint64_t) (int64_t) value',
+            'zigzag32': '(uint64_t) plcrash_pb_zigzag32(value)',
+            'zigzag64': 'plcrash_pb_zigzag64(value)',
+        }[encoding]
+        out.append('')
+        out.append('static inline size_t %s_size (%s value) {' % (prefix, ctype))
+        out.append('    return %s_TAG_SIZE + plcrash_pb_varint_size(%s);' % (macro, conv))
+        out.append('}')
+        out.append('')
+        out.append('static inline void %s_pack (plcrash_writer_message_t *msg, %s value) {' % (prefix, ctype))
+        out.append('    plcrash_pb_put_tag(msg, %s_TAG, %s_TAG_SIZE);' % (macro, macro))
+        out.append('    plcrash_pb_put_varint(msg, %s);' % conv)
+        out.append('}')
+    elif encoding == 'bytes':
+        out.append('')
+        out.append('static inline size_t %s_size (size_t len) {' % prefix)
+        out.append('    return %s_TAG_SIZE + plcrash_pb_varint_size(len) + len;' % macro)
+        out.append('}')
+        out.append('')
+        out.append('static inline void %s_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {' % prefix)
+        out.append('    plcrash_pb_put_tag(msg, %s_TAG, %s_TAG_SIZE);' % (macro, macro))
+        out.append('    plcrash_pb_put_varint(msg, len);')
+        out.append('    plcrash_pb_put_bytes(msg, data, len);')
+        out.append('}')
+    elif encoding == 'packed':
+        out.append('')
+        out.append('/** Return the encoded size of a packed %s.%s field with a @a len byte body. */' % ('.'.join(path), fname))
+        out.append('static inline size_t %s_size (size_t len) {' % prefix)
+        out.append('    return %s_TAG_SIZE + plcrash_pb_varint_size(len) + len;' % macro)
+        out.append('}')
+        out.append('')
+        out.append('/** Pack the header of a packed %s.%s chunk, followed by @a len bytes of plcrash_pb_put_varint() elements. */' % ('.'.join(path), fname))
+        out.append('static inline void %s_pack_header (plcrash_writer_message_t *msg, size_t len) {' % prefix)
+        out.append('    plcrash_pb_put_tag(msg, %s_TAG, %s_TAG_SIZE);' % (macro, macro))
+        out.append('    plcrash_pb_put_varint(msg, len);')
+        out.append('}')
+    else:
+        out.append('')
+        out.append('/** Return the encoded size of a %s.%s field with a @a len byte message body. */' % ('.'.join(path), fname))
+        out.append('static inline size_t %s_size (size_t len) {' % prefix)
+        out.append('    return %s_TAG_SIZE + plcrash_pb_varint_size(len) + len;' % macro)
+        out.append('}')
+        out.append('')
+        out.append('/** Pack the header of a %s.%s field with a @a len byte message body; the body must be packed next. */' % ('.'.join(path), fname))
+        out.append('static inline void %s_pack_header (plcrash_writer_message_t *msg, size_t len) {' % prefix)
+        out.append('    plcrash_pb_put_tag(msg, %s_TAG, %s_TAG_SIZE);' % (macro, macro))
+        out.append('    plcrash_pb_put_varint(msg, len);')
+        out.append('}')
+    out.append('')
+
+
+RUNTIME = '''/*
+ * Shared encoding primitives. All functions are async-safe, and perform no bounds checking; the caller must reserve
+ * the message's encoded size via plcrash_writer_message_reserve() prior to packing any fields.
+ *
+ * The generated size functions return exact encoded sizes. Varints are packed via plcrash_writer_varint_pack(), which
+ * may overwrite up to PLCRASH_WRITER_VARINT_SLACK bytes beyond the encoded value; plcrash_writer_message_reserve()
+ * accounts for this slack, and it must not be included in the reserved size.
+ */
+
+/** Return the encoded size of @a value as a varint. */
+static inline size_t plcrash_pb_varint_size (uint64_t value) {
+    return plcrash_writer_varint_size(value);
+}
+
+static inline uint32_t plcrash_pb_zigzag32 (int32_t value) {
+    return ((uint32_t) value << 1) ^ (uint32_t) (value >> 31);
+}
+
+static inline uint64_t plcrash_pb_zigzag64 (int64_t value) {
+    return ((uint64_t) value << 1) ^ (uint64_t) (value >> 63);
+}
+
+static inline void plcrash_pb_put_tag (plcrash_writer_message_t *msg, uint32_t tag, size_t tag_size) {
+    for (size_t i = 0; i < tag_size; i++)
+        msg->buffer[msg->length++] = (uint8_t) (tag >> (8 * i));
+}
+
+/** Pack @a value as a varint. Up to PLCRASH_WRITER_VARINT_SLACK bytes following the value may be overwritten. */
+static inline void plcrash_pb_put_varint (plcrash_writer_message_t *msg, uint64_t value) {
+    msg->length += plcrash_writer_varint_pack(value, msg->buffer + msg->length);
+}
+
+static inline void plcrash_pb_put_fixed32 (plcrash_writer_message_t *msg, const void *value) {
+    uint32_t v;
+    plcrash_async_memcpy(&v, value, sizeof(v));
+    for (size_t i = 0; i < sizeof(v); i++)
+        msg->buffer[msg->length++] = (uint8_t) (v >> (8 * i));
+}
+
+static inline void plcrash_pb_put_fixed64 (plcrash_writer_message_t *msg, const void *value) {
+    uint64_t v;
+    plcrash_async_memcpy(&v, value, sizeof(v));
+    for (size_t i = 0; i < sizeof(v); i++)
+        msg->buffer[msg->length++] = (uint8_t) (v >> (8 * i));
+}
+
+/** Return the encoded size of a length-prefixed field @a field_id with a @a len byte body. */
+static inline size_t plcrash_pb_field_size (uint32_t field_id, size_t len) {
+    return plcrash_pb_varint_size((uint64_t) field_id << 3) + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a length-prefixed field @a field_id with a @a len byte body; the body must be packed next. */
+static inline void plcrash_pb_put_field_header (plcrash_writer_message_t *msg, uint32_t field_id, size_t len) {
+    plcrash_pb_put_varint(msg, ((uint64_t) field_id << 3) | 2);
+    plcrash_pb_put_varint(msg, len);
+}
+
+static inline void plcrash_pb_put_bytes (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    if (len > 0)
+        plcrash_async_memcpy(msg->buffer + msg->length, data, len);
+    msg->length += len;
+}
+'''
+
+
+def main ():
+    if len(sys.argv) != 3:
+        raise SystemExit('Usage: %s <input.proto> <output.h>' % sys.argv[0])
+
+    source, output = sys.argv[1], sys.argv[2]
+    with open(source) as f:
+        messages, enums = parse(f.read())
+
+    guard = re.sub(r'\W', '_', os.path.basename(output)).upper()
+    out = []
+    out.append('/* Generated by generate-pb-enc.py.  DO NOT EDIT! */')
+    out.append('/* Generated from: %s */' % os.path.basename(source))
+    out.append('')
+    out.append('#ifndef %s' % guard)
+    out.append('#define %s' % guard)
+    out.append('')
+    out.append('#include "PLCrashLogWriterEncoding.h"')
+    out.append('#include "PLCrashAsync.h"')
+    out.append('')
+    out.append('#ifdef __cplusplus')
+    out.append('extern "C" {')
+    out.append('#endif')
+    out.append('')
+    out.append(RUNTIME)
+
+    for path, fields in messages:
+        out.append('/* --- %s --- */' % '.'.join(path))
+        out.append('')
+        for fname, ftype, fnum, packed in fields:
+            emit_field(out, path, fname, ftype, fnum, packed, enums)
+
+    out.append('#ifdef __cplusplus')
+    out.append('}')
+    out.append('#endif')
+    out.append('')
+    out.append('#endif /* %s */' % guard)
+
+    with open(output, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
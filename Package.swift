@@ -31,6 +31,7 @@ let package = Package(
                 "Tools/CrashViewer/",	
                 "Other Sources/Crash Demo/",
                 "Dependencies/protobuf-c/generate-pb-c.sh",
+                "Dependencies/protobuf-c/generate-pb-enc.py",
             ],
             sources: [
                 "Source",
@@ -27,11 +27,13 @@
  */
 
 #include "PLCrashAsync.h"
+#include "PLCrashAsyncPageCache.h"
 
 #include <stdint.h>
 #include <errno.h>
 #include <string.h>
 #include <inttypes.h>
+#include <sys/uio.h>
 
 /**
  * @internal
@@ -185,6 +187,9 @@ thread_t pl_mach_thread_self (void) {
  * given @a address + @a offset are unmapped or unreadable, no copy will be performed and an error will
  * be returned.
  *
+ * If a plcrash_async_page_cache_t has been bound to the calling thread via plcrash_async_page_cache_bind(),
+ * the data will be read through the cache.
+ *
  * @param task The task from which data from address @a source will be read.
  * @param address The base address within @a task from which the data will be read.
  * @param offset The offset from @a address at which data will be read.
@@ -196,6 +201,28 @@ thread_t pl_mach_thread_self (void) {
  * the proivded address + offset would overflow pl_vm_address_t, PLCRASH_ENOMEM is returned.
  */
 plcrash_error_t plcrash_async_task_memcpy (mach_port_t task, pl_vm_address_t address, pl_vm_off_t offset, void *dest, pl_vm_size_t len) {
+    plcrash_async_page_cache_t *cache = plcrash_async_page_cache_bound();
+    if (cache != NULL)
+        return plcrash_async_page_cache_memcpy(cache, task, address, offset, dest, len);
+
+    return plcrash_async_task_memcpy_uncached(task, address, offset, dest, len);
+}
+
+/**
+ * Copy @a len bytes from @a task, at @a address + @a offset, storing in @a dest, bypassing any bound
+ * plcrash_async_page_cache_t. The semantics are otherwise identical to plcrash_async_task_memcpy().
+ *
+ * @param task The task from which data from address @a source will be read.
+ * @param address The base address within @a task from which the data will be read.
+ * @param offset The offset from @a address at which data will be read.
+ * @param dest The destination address to which copied data will be written.
+ * @param len The number of bytes to be read.
+ *
+ * @return On success, returns PLCRASH_ESUCCESS. If the pages containing @a source + len are unmapped, PLCRASH_ENOTFOUND
+ * will be returned. If the pages can not be read due to access restrictions, PLCRASH_EACCESS will be returned. If
+ * the proivded address + offset would overflow pl_vm_address_t, PLCRASH_ENOMEM is returned.
+ */
+plcrash_error_t plcrash_async_task_memcpy_uncached (mach_port_t task, pl_vm_address_t address, pl_vm_off_t offset, void *dest, pl_vm_size_t len) {
     pl_vm_address_t target;
     kern_return_t kt;
 
@@ -316,76 +343,245 @@ plcrash_error_t plcrash_async_task_read_uint64 (task_t task, const plcrash_async
     return err;
 }
 
+/*
+ * Word-at-a-time string and memory primitives.
+ *
+ * These operate on aligned machine words (and, where available, 16-byte vectors), falling back to byte-wise
+ * operations for unaligned heads and tails. They must not be compiled into calls to the libc equivalents, which
+ * are not declared async-safe; the compiler's loop idiom recognition is disabled where supported.
+ */
+
+/** A machine word, as used by the word-at-a-time primitives. */
+typedef uintptr_t plcrash_async_word_t;
+
+/** An unaligned machine word. */
+typedef uintptr_t plcrash_async_uword_t __attribute__((aligned(1), may_alias));
+
+/** A machine word with each byte set to 0x01. */
+#define PLCRASH_ASYNC_WORD_ONES ((plcrash_async_word_t) -1 / 0xFF)
+
+/** A machine word with the high bit of each byte set. */
+#define PLCRASH_ASYNC_WORD_HIGHS (PLCRASH_ASYNC_WORD_ONES * 0x80)
+
+/** Evaluates to non-zero if any byte of the word @a w is zero. */
+#define PLCRASH_ASYNC_WORD_HAS_ZERO(w) (((w) - PLCRASH_ASYNC_WORD_ONES) & ~(w) & PLCRASH_ASYNC_WORD_HIGHS)
+
+/** Evaluates to true if @a ptr is aligned to the machine word size. */
+#define PLCRASH_ASYNC_WORD_ALIGNED(ptr) (((uintptr_t) (ptr) & (sizeof(plcrash_async_word_t) - 1)) == 0)
+
+#if defined(__SSE2__) || defined(__ARM_NEON)
+/** If true, 16-byte vector operations are used for bulk copies and fills. */
+#  define PLCRASH_ASYNC_VECTOR 1
+
+/** An unaligned 16-byte vector. */
+typedef uint8_t plcrash_async_uvec_t __attribute__((vector_size(16), aligned(1), may_alias));
+#else
+#  define PLCRASH_ASYNC_VECTOR 0
+#endif
+
+#if defined(__has_attribute)
+#  if __has_attribute(no_builtin)
+     /** Prevent the compiler from replacing the annotated function's loops with calls to the libc equivalents. */
+#    define PLCRASH_ASYNC_NO_BUILTIN __attribute__((no_builtin))
+#  endif
+#endif
+#ifndef PLCRASH_ASYNC_NO_BUILTIN
+#  define PLCRASH_ASYNC_NO_BUILTIN
+#endif
+
+#if defined(__has_feature)
+#  if __has_feature(address_sanitizer)
+     /* Aligned word reads may extend past a string's terminator, but never past the page containing it. */
+#    define PLCRASH_ASYNC_NO_SANITIZE_ADDRESS __attribute__((no_sanitize("address")))
+#  endif
+#endif
+#ifndef PLCRASH_ASYNC_NO_SANITIZE_ADDRESS
+#  define PLCRASH_ASYNC_NO_SANITIZE_ADDRESS
+#endif
+
 /**
- * An intentionally naive async-safe implementation of strcmp(). strcmp() itself is not declared to be async-safe,
+ * An async-safe implementation of strcmp(). strcmp() itself is not declared to be async-safe,
  * though in reality, it is.
  *
+ * If both strings share the same word alignment, they are compared a word at a time.
+ *
  * @param s1 First string.
  * @param s2 Second string.
  * @return Return an integer greater than, equal to, or less than 0, according as the string @a s1 is greater than,
  * equal to, or less than the string @a s2.
  */
+PLCRASH_ASYNC_NO_BUILTIN PLCRASH_ASYNC_NO_SANITIZE_ADDRESS
 int plcrash_async_strcmp(const char *s1, const char *s2) {
-    while (*s1 == *s2++) {
-        if (*s1++ == 0)
-            return (0);
+    if (((uintptr_t) s1 & (sizeof(plcrash_async_word_t) - 1)) == ((uintptr_t) s2 & (sizeof(plcrash_async_word_t) - 1))) {
+        /* Compare bytes until aligned */
+        while (!PLCRASH_ASYNC_WORD_ALIGNED(s1)) {
+            if (*s1 != *s2 || *s1 == 0)
+                goto finish;
+            s1++;
+            s2++;
+        }
+
+        /* Compare aligned words until a difference or a terminator is found. Aligned reads can not cross a page
+         * boundary, and thus may not fault even if they extend past the terminator. */
+        const plcrash_async_uword_t *w1 = (const plcrash_async_uword_t *) s1;
+        const plcrash_async_uword_t *w2 = (const plcrash_async_uword_t *) s2;
+        while (*w1 == *w2 && !PLCRASH_ASYNC_WORD_HAS_ZERO(*w1)) {
+            w1++;
+            w2++;
+        }
+
+        s1 = (const char *) w1;
+        s2 = (const char *) w2;
     }
-    
-    return (*(const unsigned char *)s1 - *(const unsigned char *)(s2 - 1));
+
+finish:
+    /* Locate the differing or terminating byte */
+    while (*s1 == *s2 && *s1 != 0) {
+        s1++;
+        s2++;
+    }
+
+    return (*(const unsigned char *)s1 - *(const unsigned char *)s2);
 }
 
 /**
- * An intentionally naive async-safe implementation of strncmp(). strncmp() itself is not declared to be async-safe,
+ * An async-safe implementation of strncmp(). strncmp() itself is not declared to be async-safe,
  * though in reality, it is.
  *
+ * If both strings share the same word alignment, they are compared a word at a time.
+ *
  * @param s1 First string.
  * @param s2 Second string.
  * @param n No more than n characters will be compared.
  * @return Return an integer greater than, equal to, or less than 0, according as the string @a s1 is greater than,
  * equal to, or less than the string @a s2.
  */
+PLCRASH_ASYNC_NO_BUILTIN PLCRASH_ASYNC_NO_SANITIZE_ADDRESS
 int plcrash_async_strncmp(const char *s1, const char *s2, size_t n) {
-    while (*s1 == *s2++ && n-- > 0) {
-        if (*s1++ == 0)
-            return (0);
+    if (((uintptr_t) s1 & (sizeof(plcrash_async_word_t) - 1)) == ((uintptr_t) s2 & (sizeof(plcrash_async_word_t) - 1))) {
+        /* Compare bytes until aligned */
+        while (n > 0 && !PLCRASH_ASYNC_WORD_ALIGNED(s1)) {
+            if (*s1 != *s2 || *s1 == 0)
+                goto finish;
+            s1++;
+            s2++;
+            n--;
+        }
+
+        /* Compare aligned words */
+        const plcrash_async_uword_t *w1 = (const plcrash_async_uword_t *) s1;
+        const plcrash_async_uword_t *w2 = (const plcrash_async_uword_t *) s2;
+        while (n >= sizeof(plcrash_async_word_t) && *w1 == *w2 && !PLCRASH_ASYNC_WORD_HAS_ZERO(*w1)) {
+            w1++;
+            w2++;
+            n -= sizeof(plcrash_async_word_t);
+        }
+
+        s1 = (const char *) w1;
+        s2 = (const char *) w2;
+    }
+
+finish:
+    /* Locate the differing or terminating byte */
+    for (; n > 0; n--, s1++, s2++) {
+        if (*s1 != *s2)
+            return (*(const unsigned char *)s1 - *(const unsigned char *)s2);
+
+        if (*s1 == 0)
+            return 0;
     }
-    
-    if (n == 0)
-        return 0;
 
-    return (*(const unsigned char *)s1 - *(const unsigned char *)(s2 - 1));
+    return 0;
 }
 
 /**
- * An intentionally naive async-safe implementation of memcpy(). memcpy() itself is not declared to be async-safe,
+ * An async-safe implementation of memcpy(). memcpy() itself is not declared to be async-safe,
  * though in reality, it is.
  *
+ * Bulk data is copied using 16-byte vectors where available, and otherwise a word at a time.
+ *
  * @param dest Destination.
  * @param source Source.
  * @param n Number of bytes to copy.
  */
+PLCRASH_ASYNC_NO_BUILTIN
 void *plcrash_async_memcpy (void *dest, const void *source, size_t n) {
-    uint8_t *s = (uint8_t *) source;
+    const uint8_t *s = (const uint8_t *) source;
     uint8_t *d = (uint8_t *) dest;
 
-    for (size_t count = 0; count < n; count++)
+    if (n >= 2 * sizeof(plcrash_async_word_t)) {
+        /* Align the destination */
+        while (!PLCRASH_ASYNC_WORD_ALIGNED(d)) {
+            *d++ = *s++;
+            n--;
+        }
+
+#if PLCRASH_ASYNC_VECTOR
+        for (; n >= 2 * sizeof(plcrash_async_uvec_t); n -= 2 * sizeof(plcrash_async_uvec_t)) {
+            plcrash_async_uvec_t v0 = ((const plcrash_async_uvec_t *) s)[0];
+            plcrash_async_uvec_t v1 = ((const plcrash_async_uvec_t *) s)[1];
+            ((plcrash_async_uvec_t *) d)[0] = v0;
+            ((plcrash_async_uvec_t *) d)[1] = v1;
+            s += 2 * sizeof(plcrash_async_uvec_t);
+            d += 2 * sizeof(plcrash_async_uvec_t);
+        }
+#endif
+
+        for (; n >= sizeof(plcrash_async_word_t); n -= sizeof(plcrash_async_word_t)) {
+            *(plcrash_async_uword_t *) d = *(const plcrash_async_uword_t *) s;
+            s += sizeof(plcrash_async_word_t);
+            d += sizeof(plcrash_async_word_t);
+        }
+    }
+
+    while (n-- > 0)
         *d++ = *s++;
 
     return (void *) source;
 }
 
 /**
- * An intentionally naive async-safe implementation of memset(). memset() itself is not declared to be async-safe,
+ * An async-safe implementation of memset(). memset() itself is not declared to be async-safe,
  * though in reality, it is.
  *
+ * Bulk data is filled using 16-byte vectors where available, and otherwise a word at a time.
+ *
  * @param dest Destination.
  * @param value Value to write to @a dest.
  * @param n Number of bytes to copy.
  */
+PLCRASH_ASYNC_NO_BUILTIN
 void *plcrash_async_memset(void *dest, uint8_t value, size_t n) {
     uint8_t *d = (uint8_t *) dest;
-    
-    for (size_t count = 0; count < n; count++)
+
+    if (n >= 2 * sizeof(plcrash_async_word_t)) {
+        plcrash_async_word_t w = PLCRASH_ASYNC_WORD_ONES * value;
+
+        /* Align the destination */
+        while (!PLCRASH_ASYNC_WORD_ALIGNED(d)) {
+            *d++ = value;
+            n--;
+        }
+
+#if PLCRASH_ASYNC_VECTOR
+        plcrash_async_uvec_t v = {
+            value, value, value, value, value, value, value, value,
+            value, value, value, value, value, value, value, value
+        };
+        for (; n >= 2 * sizeof(plcrash_async_uvec_t); n -= 2 * sizeof(plcrash_async_uvec_t)) {
+            ((plcrash_async_uvec_t *) d)[0] = v;
+            ((plcrash_async_uvec_t *) d)[1] = v;
+            d += 2 * sizeof(plcrash_async_uvec_t);
+        }
+#endif
+
+        for (; n >= sizeof(plcrash_async_word_t); n -= sizeof(plcrash_async_word_t)) {
+            *(plcrash_async_uword_t *) d = w;
+            d += sizeof(plcrash_async_word_t);
+        }
+    }
+
+    while (n-- > 0)
         *d++ = value;
 
     return (void *) dest;
@@ -440,55 +636,346 @@ ssize_t plcrash_async_writen (int fd, const void *data, size_t len) {
  * @param fd Open file descriptor.
  */
 void plcrash_async_file_init (plcrash_async_file_t *file, int fd, off_t output_limit) {
+    file->backend = PLCRASH_ASYNC_FILE_BACKEND_FD;
     file->fd = fd;
+    file->mem_data = NULL;
+    file->mem_length = 0;
+    file->mem_capacity = 0;
     file->buflen = 0;
+    file->bufptr = file->buffer;
+    file->bufsize = sizeof(file->buffer);
+    file->write_ops = 0;
     file->total_bytes = 0;
     file->limit_bytes = output_limit;
+
+    /* Record the starting offset; this is used to locate previously flushed data in plcrash_async_file_rewrite(). */
+    file->base_offset = lseek(fd, 0, SEEK_CUR);
+}
+
+/**
+ * Initialize the plcrash_async_file_t instance for in-memory output. Flushed data will be appended to a
+ * VM-allocated region that grows as required, and may be fetched via plcrash_async_file_memory_bytes() prior
+ * to calling plcrash_async_file_close().
+ *
+ * The backing region is allocated with vm_allocate(), rather than malloc(), and thus may be safely
+ * grown while other threads (which may hold the malloc lock) are suspended.
+ *
+ * @param file File structure to initialize.
+ * @param output_limit Maximum number of bytes that will be written. Specify 0 to disable any limits. Once
+ * the limit is reached, all data will be dropped.
+ */
+void plcrash_async_file_init_memory (plcrash_async_file_t *file, off_t output_limit) {
+    file->backend = PLCRASH_ASYNC_FILE_BACKEND_MEMORY;
+    file->fd = -1;
+    file->mem_data = NULL;
+    file->mem_length = 0;
+    file->mem_capacity = 0;
+    file->buflen = 0;
+    file->bufptr = file->buffer;
+    file->bufsize = sizeof(file->buffer);
+    file->write_ops = 0;
+    file->total_bytes = 0;
+    file->limit_bytes = output_limit;
+    file->base_offset = 0;
+}
+
+/**
+ * Replace the default output buffer of @a file with the caller-supplied @a buffer. This must be called prior to
+ * writing any data to @a file.
+ *
+ * Larger buffers reduce the number of write operations required to emit a report; the buffer may be allocated
+ * ahead of time, and then supplied at crash time. The buffer must remain valid until @a file is closed.
+ *
+ * @param file The file instance.
+ * @param buffer The output buffer to be used.
+ * @param size The size of @a buffer, in bytes. If 0, the default buffer will be used.
+ */
+void plcrash_async_file_set_buffer (plcrash_async_file_t *file, void *buffer, size_t size) {
+    PLCF_ASSERT(file->buflen == 0);
+
+    if (buffer == NULL || size == 0) {
+        file->bufptr = file->buffer;
+        file->bufsize = sizeof(file->buffer);
+        return;
+    }
+
+    file->bufptr = (char *) buffer;
+    file->bufsize = size;
+}
+
+/**
+ * Return a borrowed reference to the flushed output of a memory-backed @a file. The returned pointer
+ * will remain valid until the next write, flush, or close of @a file; callers should call
+ * plcrash_async_file_flush() prior to fetching the output.
+ *
+ * @param file A file initialized via plcrash_async_file_init_memory().
+ * @param length On return, the number of bytes available at the returned address.
+ *
+ * @return Returns the output bytes, or NULL if no output has been flushed.
+ */
+const void *plcrash_async_file_memory_bytes (plcrash_async_file_t *file, size_t *length) {
+    PLCF_ASSERT(file->backend == PLCRASH_ASYNC_FILE_BACKEND_MEMORY);
+
+    *length = file->mem_length;
+    return file->mem_data;
+}
+
+/**
+ * @internal
+ *
+ * Append @a len bytes from @a data to the memory region of a PLCRASH_ASYNC_FILE_BACKEND_MEMORY @a file, growing the
+ * region if required.
+ *
+ * @return Returns true on success, or false if the region could not be grown.
+ */
+static bool plcrash_async_file_emit_memory (plcrash_async_file_t *file, const void *data, size_t len) {
+    if (len > file->mem_capacity - file->mem_length) {
+        size_t capacity = file->mem_capacity > 0 ? file->mem_capacity * 2 : (size_t) vm_page_size * 4;
+        while (capacity - file->mem_length < len) {
+            /* Guard against overflow */
+            if (capacity > SIZE_MAX / 2) {
+                PLCF_DEBUG("In-memory crash log exceeds the maximum supported size");
+                return false;
+            }
+            capacity *= 2;
+        }
+
+        vm_address_t addr = 0;
+        kern_return_t kr = vm_allocate(mach_task_self(), &addr, capacity, VM_FLAGS_ANYWHERE);
+        if (kr != KERN_SUCCESS) {
+            PLCF_DEBUG("vm_allocate() failed growing in-memory crash log: %d", kr);
+            return false;
+        }
+
+        if (file->mem_data != NULL) {
+            plcrash_async_memcpy((void *) addr, file->mem_data, file->mem_length);
+            vm_deallocate(mach_task_self(), (vm_address_t) file->mem_data, file->mem_capacity);
+        }
+
+        file->mem_data = (uint8_t *) addr;
+        file->mem_capacity = capacity;
+    }
+
+    plcrash_async_memcpy(file->mem_data + file->mem_length, data, len);
+    file->mem_length += len;
+
+    return true;
 }
 
+/**
+ * @internal
+ *
+ * Write @a len bytes from @a data to the file's backing store, bypassing the output buffer.
+ *
+ * @return Returns true on success, or false if an error occurs.
+ */
+static bool plcrash_async_file_emit (plcrash_async_file_t *file, const void *data, size_t len) {
+    switch (file->backend) {
+        case PLCRASH_ASYNC_FILE_BACKEND_FD:
+            file->write_ops++;
+            if (plcrash_async_writen(file->fd, data, len) < 0) {
+                PLCF_DEBUG("Error occured writing to crash log: %s", strerror(errno));
+                return false;
+            }
+            return true;
+
+        case PLCRASH_ASYNC_FILE_BACKEND_MEMORY:
+            return plcrash_async_file_emit_memory(file, data, len);
+    }
+
+    /* Unreachable */
+    PLCF_DEBUG("Unknown output backend %d", file->backend);
+    return false;
+}
+
+
+/**
+ * @internal
+ *
+ * Write the @a buflen bytes at @a buf, followed by the @a len bytes at @a data, to the file's backing store,
+ * bypassing the output buffer. File-backed output is written with a single writev() where possible.
+ *
+ * @return Returns true on success, or false if an error occurs.
+ */
+static bool plcrash_async_file_emitv (plcrash_async_file_t *file, const void *buf, size_t buflen, const void *data, size_t len) {
+    /* Memory-backed output is simply appended */
+    if (file->backend == PLCRASH_ASYNC_FILE_BACKEND_MEMORY)
+        return plcrash_async_file_emit_memory(file, buf, buflen) && plcrash_async_file_emit_memory(file, data, len);
+
+    struct iovec iov[2];
+    struct iovec *iovp = iov;
+    int iovcnt = 0;
+
+    if (buflen > 0) {
+        iov[iovcnt].iov_base = (void *) buf;
+        iov[iovcnt].iov_len = buflen;
+        iovcnt++;
+    }
+
+    iov[iovcnt].iov_base = (void *) data;
+    iov[iovcnt].iov_len = len;
+    iovcnt++;
+
+    /* Loop until all bytes are written */
+    while (iovcnt > 0) {
+        file->write_ops++;
+
+        ssize_t written = writev(file->fd, iovp, iovcnt);
+        if (written <= 0) {
+            if (errno == EINTR)
+                continue;
+
+            PLCF_DEBUG("Error occured writing to crash log: %s", strerror(errno));
+            return false;
+        }
+
+        /* Skip any fully written vectors, and advance within a partially written vector */
+        while (iovcnt > 0 && (size_t) written >= iovp->iov_len) {
+            written -= iovp->iov_len;
+            iovp++;
+            iovcnt--;
+        }
+
+        if (iovcnt > 0) {
+            iovp->iov_base = (uint8_t *) iovp->iov_base + written;
+            iovp->iov_len -= written;
+        }
+    }
+
+    return true;
+}
 
 /**
  * Write all bytes from @a data to the file buffer. Returns true on success,
  * or false if an error occurs.
+ *
+ * When a caller-supplied buffer has been registered via plcrash_async_file_set_buffer(), writes of at least half
+ * its capacity are not copied through the buffer; they're written directly to the backing store, along with any
+ * pending buffered data. The default buffer is only bypassed by writes that could not fit within it.
  */
 bool plcrash_async_file_write (plcrash_async_file_t *file, const void *data, size_t len) {
     /* Check and update output limit */
     if (file->limit_bytes != 0 && len + file->total_bytes > file->limit_bytes) {
         return false;
-    } else if (file->limit_bytes != 0) {
-        file->total_bytes += len;
+    }
+    file->total_bytes += len;
+
+    /* Large writes bypass the buffer. Applying the half-capacity threshold to the small default buffer would issue
+     * a write for every moderately sized value. */
+    size_t bypass_len = (file->bufptr == file->buffer) ? file->bufsize + 1 : file->bufsize / 2;
+    if (len >= bypass_len) {
+        if (!plcrash_async_file_emitv(file, file->bufptr, file->buflen, data, len))
+            return false;
+
+        file->buflen = 0;
+        return true;
     }
 
     /* Check if the buffer will fill */
-    if (file->buflen + len > sizeof(file->buffer)) {
+    if (file->buflen + len > file->bufsize) {
         /* Flush the buffer */
-        if (plcrash_async_writen(file->fd, file->buffer, file->buflen) < 0) {
-            PLCF_DEBUG("Error occured writing to crash log: %s", strerror(errno));
+        if (!plcrash_async_file_emit(file, file->bufptr, file->buflen))
             return false;
-        }
         
         file->buflen = 0;
     }
     
-    /* Check if the new data fits within the buffer, if so, buffer it */
-    if (len + file->buflen <= sizeof(file->buffer)) {
-        plcrash_async_memcpy(file->buffer + file->buflen, data, len);
-        file->buflen += len;
-        
-        return true;
-        
-    } else {
-        /* Won't fit in the buffer, just write it */
-        if (plcrash_async_writen(file->fd, data, len) < 0) {
-            PLCF_DEBUG("Error occured writing to crash log: %s", strerror(errno));
-            return false;
-        }
-        
-        return true;
-    } 
+    /* The new data is guaranteed to fit within the buffer */
+    plcrash_async_memcpy(file->bufptr + file->buflen, data, len);
+    file->buflen += len;
+
+    return true;
 }
 
 
+/**
+ * Return the current output offset of @a file, relative to the position at which the file was initialized. This
+ * includes any data that is still buffered.
+ *
+ * @param file The file instance.
+ */
+off_t plcrash_async_file_offset (plcrash_async_file_t *file) {
+    return file->total_bytes;
+}
+
+/**
+ * Return the total number of write operations issued against the backing file descriptor of @a file. This may
+ * be used to measure the effect of the output buffer size; memory-backed output issues no write operations.
+ *
+ * @param file The file instance.
+ */
+size_t plcrash_async_file_write_ops (plcrash_async_file_t *file) {
+    return file->write_ops;
+}
+
+/**
+ * Overwrite @a len bytes of previously written output at @a offset with @a data. Any bytes that are still buffered
+ * will be updated in place; bytes that have already been flushed will be rewritten directly within the backing file.
+ *
+ * This may be used to fill in fixed-width placeholder values (such as a message length) once the actual value
+ * is known, without requiring the placeholder's dependent data to be generated twice.
+ *
+ * @param file The file instance.
+ * @param offset The output offset, as returned by plcrash_async_file_offset(), at which @a data will be written.
+ * @param data The replacement data.
+ * @param len The number of bytes to be written. The range must fall entirely within previously written output.
+ *
+ * @return Returns true on success, or false if the range is invalid, or an error occurs writing to the backing file.
+ */
+bool plcrash_async_file_rewrite (plcrash_async_file_t *file, off_t offset, const void *data, size_t len) {
+    const uint8_t *p = data;
+
+    /* The rewritten range must have already been written */
+    if (offset < 0 || offset > file->total_bytes || len > (size_t) (file->total_bytes - offset))
+        return false;
+
+    /* Rewrite any previously flushed bytes within the file itself */
+    off_t buffer_offset = file->total_bytes - file->buflen;
+    if (offset < buffer_offset) {
+        size_t flushed_len = len;
+        if (flushed_len > (size_t) (buffer_offset - offset))
+            flushed_len = (size_t) (buffer_offset - offset);
+
+        if (file->backend == PLCRASH_ASYNC_FILE_BACKEND_MEMORY) {
+            /* Memory-backed output may be patched in place */
+            plcrash_async_memcpy(file->mem_data + offset, p, flushed_len);
+            p += flushed_len;
+            offset += flushed_len;
+        } else {
+            /* We can't seek within a non-seekable descriptor */
+            if (file->base_offset < 0) {
+                PLCF_DEBUG("Can not rewrite flushed data in a non-seekable file");
+                return false;
+            }
+
+            size_t left = flushed_len;
+            while (left > 0) {
+                file->write_ops++;
+                ssize_t written = pwrite(file->fd, p, left, file->base_offset + offset);
+                if (written <= 0) {
+                    if (errno == EINTR)
+                        continue;
+
+                    PLCF_DEBUG("Error occured rewriting crash log: %s", strerror(errno));
+                    return false;
+                }
+
+                left -= written;
+                p += written;
+                offset += written;
+            }
+        }
+
+        len -= flushed_len;
+    }
+
+    /* Update any remaining bytes within the buffer */
+    if (len > 0)
+        plcrash_async_memcpy(file->bufptr + (offset - buffer_offset), p, len);
+
+    return true;
+}
+
 /**
  * Flush all buffered bytes from the file buffer.
  */
@@ -498,10 +985,8 @@ bool plcrash_async_file_flush (plcrash_async_file_t *file) {
         return true;
     
     /* Write remaining */
-    if (plcrash_async_writen(file->fd, file->buffer, file->buflen) < 0) {
-        PLCF_DEBUG("Error occured writing to crash log: %s", strerror(errno));
+    if (!plcrash_async_file_emit(file, file->bufptr, file->buflen))
         return false;
-    }
     
     file->buflen = 0;
     
@@ -510,9 +995,21 @@ bool plcrash_async_file_flush (plcrash_async_file_t *file) {
 
 
 /**
- * Close the backing file descriptor.
+ * Close the backing file descriptor. If the file is memory-backed, the output region will be deallocated.
  */
 bool plcrash_async_file_close (plcrash_async_file_t *file) {
+    /* Release in-memory output; there's nothing to flush */
+    if (file->backend == PLCRASH_ASYNC_FILE_BACKEND_MEMORY) {
+        if (file->mem_data != NULL)
+            vm_deallocate(mach_task_self(), (vm_address_t) file->mem_data, file->mem_capacity);
+
+        file->mem_data = NULL;
+        file->mem_length = 0;
+        file->mem_capacity = 0;
+        file->buflen = 0;
+        return true;
+    }
+
     /* Flush any pending data */
     if (!plcrash_async_file_flush(file))
         return false;
@@ -243,6 +243,7 @@ extern const plcrash_async_byteorder_t *plcrash_async_byteorder_big_endian (void
 
 
 plcrash_error_t plcrash_async_task_memcpy (mach_port_t task, pl_vm_address_t address, pl_vm_off_t offset, void *dest, pl_vm_size_t len);
+plcrash_error_t plcrash_async_task_memcpy_uncached (mach_port_t task, pl_vm_address_t address, pl_vm_off_t offset, void *dest, pl_vm_size_t len);
 
 plcrash_error_t plcrash_async_task_read_uint8 (task_t task, pl_vm_address_t address, pl_vm_off_t offset, uint8_t *result);
 
@@ -262,33 +263,89 @@ void *plcrash_async_memset(void *dest, uint8_t value, size_t n);
 
 ssize_t plcrash_async_writen (int fd, const void *data, size_t len);
 
+/**
+ * @internal
+ * @ingroup plcrash_async_bufio
+ *
+ * The size of the default output buffer embedded within plcrash_async_file_t.
+ */
+#define PLCRASH_ASYNC_FILE_DEFAULT_BUFFER_SIZE 256
+
+/**
+ * @internal
+ * @ingroup plcrash_async_bufio
+ *
+ * Output backends supported by plcrash_async_file_t.
+ */
+typedef enum {
+    /** Output is written to a file descriptor. */
+    PLCRASH_ASYNC_FILE_BACKEND_FD = 0,
+
+    /** Output is appended to a growable, VM-allocated memory region. */
+    PLCRASH_ASYNC_FILE_BACKEND_MEMORY = 1
+} plcrash_async_file_backend_t;
+
 /**
  * @internal
  * @ingroup plcrash_async_bufio
  *
  * Async-safe buffered file output. This implementation is only intended for use
  * within signal handler execution of crash log output.
+ *
+ * Output may be directed to either a file descriptor (plcrash_async_file_init()), or to an in-memory
+ * region (plcrash_async_file_init_memory()).
  */
 typedef struct plcrash_async_file {
-    /** Output file descriptor */
+    /** The output backend. */
+    plcrash_async_file_backend_t backend;
+
+    /** If the file is backed by a file descriptor, the output file descriptor; otherwise, -1. */
     int fd;
 
+    /** If the file is memory-backed, the VM-allocated output region, or NULL if no data has yet been flushed. */
+    uint8_t *mem_data;
+
+    /** If the file is memory-backed, the number of flushed bytes in @a mem_data. */
+    size_t mem_length;
+
+    /** If the file is memory-backed, the allocated size of @a mem_data. */
+    size_t mem_capacity;
+
     /** Output limit */
     off_t limit_bytes;
 
     /** Total bytes written */
     off_t total_bytes;
 
+    /** The file descriptor's offset at initialization time, or -1 if the descriptor is not seekable. Used to
+     * rewrite previously flushed output. */
+    off_t base_offset;
+
     /** Current length of data in buffer */
     size_t buflen;
 
-    /** Buffered output */
-    char buffer[256];
+    /** Active output buffer; either @a buffer, or a caller-supplied buffer registered via plcrash_async_file_set_buffer(). */
+    char *bufptr;
+
+    /** Capacity of @a bufptr, in bytes. */
+    size_t bufsize;
+
+    /** Total number of write operations issued against the backing file descriptor. */
+    size_t write_ops;
+
+    /** Default buffered output */
+    char buffer[PLCRASH_ASYNC_FILE_DEFAULT_BUFFER_SIZE];
 } plcrash_async_file_t;
 
 
 void plcrash_async_file_init (plcrash_async_file_t *file, int fd, off_t output_limit);
+void plcrash_async_file_init_memory (plcrash_async_file_t *file, off_t output_limit);
+void plcrash_async_file_set_buffer (plcrash_async_file_t *file, void *buffer, size_t size);
+const void *plcrash_async_file_memory_bytes (plcrash_async_file_t *file, size_t *length);
 bool plcrash_async_file_write (plcrash_async_file_t *file, const void *data, size_t len);
+off_t plcrash_async_file_offset (plcrash_async_file_t *file);
+size_t plcrash_async_file_write_ops (plcrash_async_file_t *file);
+bool plcrash_async_file_rewrite (plcrash_async_file_t *file, off_t offset, const void *data, size_t len);
 bool plcrash_async_file_flush (plcrash_async_file_t *file);
 bool plcrash_async_file_close (plcrash_async_file_t *file);
     
@@ -51,6 +51,84 @@
 
 #pragma mark CFE Reader
 
+/* Evaluates to true if the length of @a _ecount * @a sizof(_etype) can not be represented
+ * by size_t. */
+#define VERIFY_SIZE_T(_etype, _ecount) (SIZE_MAX / sizeof(_etype) < (size_t) _ecount)
+
+/**
+ * @internal
+ *
+ * Map the common encodings table and first-level index entries declared by @a reader's header, populating
+ * the reader's table fields.
+ *
+ * @param reader A reader with a validated header.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, PLCRASH_ENOTFOUND if the index contains no entries, or PLCRASH_EINVAL
+ * if a table lies outside the mapped CFE range.
+ */
+static plcrash_error_t plcrash_async_cfe_reader_map_tables (plcrash_async_cfe_reader_t *reader) {
+    const plcrash_async_byteorder_t *byteorder = reader->byteorder;
+    const pl_vm_address_t base_addr = plcrash_async_mobject_base_address(reader->mobj);
+
+    reader->common_enc = NULL;
+    reader->common_enc_count = 0;
+    reader->index_entries = NULL;
+    reader->index_count = 0;
+
+    /* Find and map the common encodings table */
+    uint32_t common_enc_count = byteorder->swap32(reader->header.commonEncodingsArrayCount);
+    {
+        if (VERIFY_SIZE_T(uint32_t, common_enc_count)) {
+            PLCF_DEBUG("CFE common encoding count extends beyond the range of size_t");
+            return PLCRASH_EINVAL;
+        }
+
+        size_t common_enc_len = common_enc_count * sizeof(uint32_t);
+        uint32_t common_enc_off = byteorder->swap32(reader->header.commonEncodingsArraySectionOffset);
+        reader->common_enc = plcrash_async_mobject_remap_address(reader->mobj, base_addr, common_enc_off, common_enc_len);
+        if (reader->common_enc == NULL) {
+            PLCF_DEBUG("The declared common table lies outside the mapped CFE range");
+            return PLCRASH_EINVAL;
+        }
+        reader->common_enc_count = common_enc_count;
+    }
+
+    /* Find and map the index */
+    uint32_t index_off = byteorder->swap32(reader->header.indexSectionOffset);
+    uint32_t index_count = byteorder->swap32(reader->header.indexCount);
+
+    if (VERIFY_SIZE_T(sizeof(struct unwind_info_section_header_index_entry), index_count)) {
+        PLCF_DEBUG("CFE index count extends beyond the range of size_t");
+        return PLCRASH_EINVAL;
+    }
+
+    if (index_count == 0) {
+        PLCF_DEBUG("CFE index contains no entries");
+        return PLCRASH_ENOTFOUND;
+    }
+
+    /*
+     * NOTE: CFE includes an extra entry in the total count of second-level pages, ie, from ld64:
+     * const uint32_t indexCount = secondLevelPageCount+1;
+     *
+     * There's no explanation as to why, and tools appear to explicitly ignore the entry entirely. We do the same
+     * here.
+     */
+    PLCF_ASSERT(index_count != 0);
+    index_count--;
+
+    /* Load the index entries */
+    size_t index_len = index_count * sizeof(struct unwind_info_section_header_index_entry);
+    reader->index_entries = plcrash_async_mobject_remap_address(reader->mobj, base_addr, index_off, index_len);
+    if (reader->index_entries == NULL) {
+        PLCF_DEBUG("The declared entries table lies outside the mapped CFE range");
+        return PLCRASH_EINVAL;
+    }
+    reader->index_count = index_count;
+
+    return PLCRASH_ESUCCESS;
+}
+
 /**
  * Initialize a new CFE reader using the provided memory object. Any resources held by a successfully initialized
  * instance must be freed via plcrash_async_cfe_reader_free();
@@ -94,6 +172,11 @@ plcrash_error_t plcrash_async_cfe_reader_init (plcrash_async_cfe_reader_t *reade
     }
 
     reader->header = *header;
+
+    /* Resolve the tables required by every lookup, allowing plcrash_async_cfe_reader_find_pc() to proceed directly
+     * to the binary search. */
+    reader->tables_err = plcrash_async_cfe_reader_map_tables(reader);
+
     return PLCRASH_ESUCCESS;
 }
 
@@ -143,10 +226,6 @@ plcrash_error_t plcrash_async_cfe_reader_init (plcrash_async_cfe_reader_t *reade
     } \
 } while (0)
 
-/* Evaluates to true if the length of @a _ecount * @a sizof(_etype) can not be represented
- * by size_t. */
-#define VERIFY_SIZE_T(_etype, _ecount) (SIZE_MAX / sizeof(_etype) < (size_t) _ecount)
-
 /**
  * Return the compact frame encoding entry for @a pc via @a encoding, if available.
  *
@@ -155,71 +234,32 @@ plcrash_error_t plcrash_async_cfe_reader_init (plcrash_async_cfe_reader_t *reade
  * the target Mach-O image's __TEXT vmaddr.
  * @param function_base On success, will be populated with the base address of the function. This value is relative to
  * the image's load address, rather than the in-memory address of the loaded image.
+ * @param function_end On success, will be populated with the end address (exclusive) of the range described by the
+ * entry; this is the base address of the following entry, and is relative to the image's load address. If no following
+ * entry exists, the range is conservatively terminated at @a pc + 1.
  * @param encoding On success, will be populated with the compact frame encoding entry.
  *
  * @return Returns PLFRAME_ESUCCCESS on success, or one of the remaining error codes if a CFE parsing error occurs. If
  * the entry can not be found, PLFRAME_ENOTFOUND will be returned.
  */
-plcrash_error_t plcrash_async_cfe_reader_find_pc (plcrash_async_cfe_reader_t *reader, pl_vm_address_t pc, pl_vm_address_t *function_base, uint32_t *encoding) {
+plcrash_error_t plcrash_async_cfe_reader_find_pc (plcrash_async_cfe_reader_t *reader, pl_vm_address_t pc, pl_vm_address_t *function_base, pl_vm_address_t *function_end, uint32_t *encoding) {
     const plcrash_async_byteorder_t *byteorder = reader->byteorder;
     const pl_vm_address_t base_addr = plcrash_async_mobject_base_address(reader->mobj);
 
-    /* Find and map the common encodings table */
-    uint32_t common_enc_count = byteorder->swap32(reader->header.commonEncodingsArrayCount);
-    uint32_t *common_enc;
-    {
-        if (VERIFY_SIZE_T(uint32_t, common_enc_count)) {
-            PLCF_DEBUG("CFE common encoding count extends beyond the range of size_t");
-            return PLCRASH_EINVAL;
-        }
+    /* Verify that the common encoding and index tables were resolved at initialization */
+    if (reader->tables_err != PLCRASH_ESUCCESS)
+        return reader->tables_err;
 
-        size_t common_enc_len = common_enc_count * sizeof(uint32_t);
-        uint32_t common_enc_off = byteorder->swap32(reader->header.commonEncodingsArraySectionOffset);
-        common_enc = plcrash_async_mobject_remap_address(reader->mobj, base_addr, common_enc_off, common_enc_len);
-        if (common_enc == NULL) {
-            PLCF_DEBUG("The declared common table lies outside the mapped CFE range");
-            return PLCRASH_EINVAL;
-        }
-    }
+    uint32_t common_enc_count = reader->common_enc_count;
+    uint32_t *common_enc = reader->common_enc;
 
-    /* Find and load the first level entry */
+    /* Binary search for the first-level entry */
     struct unwind_info_section_header_index_entry *first_level_entry = NULL;
     {
-        /* Find and map the index */
-        uint32_t index_off = byteorder->swap32(reader->header.indexSectionOffset);
-        uint32_t index_count = byteorder->swap32(reader->header.indexCount);
-        
-        if (VERIFY_SIZE_T(sizeof(struct unwind_info_section_header_index_entry), index_count)) {
-            PLCF_DEBUG("CFE index count extends beyond the range of size_t");
-            return PLCRASH_EINVAL;
-        }
-        
-        if (index_count == 0) {
-            PLCF_DEBUG("CFE index contains no entries");
-            return PLCRASH_ENOTFOUND;
-        }
-        
-        /*
-         * NOTE: CFE includes an extra entry in the total count of second-level pages, ie, from ld64:
-         * const uint32_t indexCount = secondLevelPageCount+1;
-         *
-         * There's no explanation as to why, and tools appear to explicitly ignore the entry entirely. We do the same
-         * here.
-         */
-        PLCF_ASSERT(index_count != 0);
-        index_count--;
-        
-        /* Load the index entries */
-        size_t index_len = index_count * sizeof(struct unwind_info_section_header_index_entry);
-        struct unwind_info_section_header_index_entry *index_entries = plcrash_async_mobject_remap_address(reader->mobj, base_addr, index_off, index_len);
-        if (index_entries == NULL) {
-            PLCF_DEBUG("The declared entries table lies outside the mapped CFE range");
-            return PLCRASH_EINVAL;
-        }
-        
-        /* Binary search for the first-level entry */
+        struct unwind_info_section_header_index_entry *index_entries = reader->index_entries;
+
 #define CFE_FUN_BINARY_SEARCH_ENTVAL(_tval) (byteorder->swap32(_tval.functionOffset))
-        CFE_FUN_BINARY_SEARCH(pc, index_entries, index_count, first_level_entry);
+        CFE_FUN_BINARY_SEARCH(pc, index_entries, reader->index_count, first_level_entry);
 #undef CFE_FUN_BINARY_SEARCH_ENTVAL
         
         if (first_level_entry == NULL) {
@@ -228,6 +268,11 @@ plcrash_error_t plcrash_async_cfe_reader_find_pc (plcrash_async_cfe_reader_t *re
         }
     }
 
+    /* The end of the first-level entry's range; the final entry of each second-level page extends to this address */
+    pl_vm_address_t page_end = pc + 1;
+    if (first_level_entry + 1 < reader->index_entries + reader->index_count)
+        page_end = byteorder->swap32((first_level_entry + 1)->functionOffset);
+
     /* Locate and decode the second-level entry */
     uint32_t second_level_offset = byteorder->swap32(first_level_entry->secondLevelPagesSectionOffset);
     uint32_t *second_level_kind = plcrash_async_mobject_remap_address(reader->mobj, base_addr, second_level_offset, sizeof(uint32_t));
@@ -269,6 +314,7 @@ plcrash_error_t plcrash_async_cfe_reader_find_pc (plcrash_async_cfe_reader_t *re
 
             *encoding = byteorder->swap32(entry->encoding);
             *function_base = byteorder->swap32(entry->functionOffset);
+            *function_end = (entry + 1 < entries + entries_count) ? byteorder->swap32((entry + 1)->functionOffset) : page_end;
             return PLCRASH_ESUCCESS;
         }
 
@@ -314,8 +360,12 @@ plcrash_error_t plcrash_async_cfe_reader_find_pc (plcrash_async_cfe_reader_t *re
             uint32_t c_entry = byteorder->swap32(*c_entry_ptr);
             uint8_t c_encoding_idx = UNWIND_INFO_COMPRESSED_ENTRY_ENCODING_INDEX(c_entry);
             
-            /* Save the function base */
+            /* Save the function range */
             *function_base = base_foffset + UNWIND_INFO_COMPRESSED_ENTRY_FUNC_OFFSET(byteorder->swap32(c_entry));
+            if (c_entry_ptr + 1 < compressed_entries + entries_count)
+                *function_end = base_foffset + UNWIND_INFO_COMPRESSED_ENTRY_FUNC_OFFSET(byteorder->swap32(*(c_entry_ptr + 1)));
+            else
+                *function_end = page_end;
             
             /* Handle common table entries */
             if (c_encoding_idx < common_enc_count) {
@@ -973,7 +1023,7 @@ plcrash_async_cfe_entry_type_t plcrash_async_cfe_entry_type (plcrash_async_cfe_e
  *
  *   TODO: Need a mechanism to define the actual size of the offset. For x86-32/x86-64, it is defined as being
  *   encoded in a subl instruction.
- * - PLCRASH_ASYNC_CFE_ENTRY_TYPE_DWARF: Unused.
+ * - PLCRASH_ASYNC_CFE_ENTRY_TYPE_DWARF: The offset to the DWARF FDE in the __eh_frame section.
  *
  * @param entry The entry from which the stack offset value will be fetched.
  */
@@ -59,6 +59,24 @@ typedef struct plcrash_async_cfe_reader {
 
     /** The byte order of the encoded data (including the header). */
     const plcrash_async_byteorder_t *byteorder;
+
+    /**
+     * The result of resolving the common encodings and first-level index tables at initialization. If not
+     * PLCRASH_ESUCCESS, the tables are unavailable and this error will be returned from plcrash_async_cfe_reader_find_pc().
+     */
+    plcrash_error_t tables_err;
+
+    /** The common encodings table, mapped from @a mobj. Note that the values may require byte-swapping. */
+    uint32_t *common_enc;
+
+    /** The number of entries in @a common_enc. */
+    uint32_t common_enc_count;
+
+    /** The first-level index entries, mapped from @a mobj, excluding the trailing sentinel entry. */
+    struct unwind_info_section_header_index_entry *index_entries;
+
+    /** The number of entries in @a index_entries. */
+    uint32_t index_count;
 } plcrash_async_cfe_reader_t;
 
 /**
@@ -191,7 +209,7 @@ typedef struct plcrash_async_cfe_entry {
 
 plcrash_error_t plcrash_async_cfe_reader_init (plcrash_async_cfe_reader_t *reader, plcrash_async_mobject_t *mobj, cpu_type_t cputype);
 
-plcrash_error_t plcrash_async_cfe_reader_find_pc (plcrash_async_cfe_reader_t *reader, pl_vm_address_t pc, pl_vm_address_t *function_base, uint32_t *encoding);
+plcrash_error_t plcrash_async_cfe_reader_find_pc (plcrash_async_cfe_reader_t *reader, pl_vm_address_t pc, pl_vm_address_t *function_base, pl_vm_address_t *function_end, uint32_t *encoding);
 
 void plcrash_async_cfe_reader_free (plcrash_async_cfe_reader_t *reader);
 
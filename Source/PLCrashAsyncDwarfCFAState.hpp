@@ -319,7 +319,9 @@ public:
                                   const plcrash_async_byteorder_t *byteorder,
                                   pl_vm_address_t address,
                                   pl_vm_off_t offset,
-                                  pl_vm_size_t length);
+                                  pl_vm_size_t length,
+                                  machine_ptr *row_start,
+                                  machine_ptr *row_end);
     
     plcrash_error_t apply_state (task_t task,
                                  plcrash_async_dwarf_cie_info_t *cie_info,
@@ -73,6 +73,11 @@ static plcrash_error_t plcrash_async_dwarf_cfa_state_apply_register (task_t task
  * @param address The task-relative address within @a mobj at which the opcodes will be fetched.
  * @param offset An offset to be applied to @a address.
  * @param length The total length of the opcodes readable at @a address + @a offset.
+ * @param row_start If non-NULL, on success will be populated with the location at which the CFA table row
+ * describing @a pc begins.
+ * @param row_end If non-NULL, on success will be populated with the location at which the following CFA table row
+ * begins, or 0 if the program was evaluated to completion; in that case, the row extends to the end of the FDE's
+ * address range. The evaluated state applies to all PCs within [@a row_start, @a row_end).
  *
  * @return Returns PLCRASH_ESUCCESS on success, or an appropriate plcrash_error_t values
  * on failure. If an invalid opcode is detected, PLCRASH_ENOTSUP will be returned.
@@ -89,11 +94,14 @@ plcrash_error_t dwarf_cfa_state<machine_ptr, machine_ptr_s>::eval_program (plcra
                                                                            const plcrash_async_byteorder_t *byteorder,
                                                                            pl_vm_address_t address,
                                                                            pl_vm_off_t offset,
-                                                                           pl_vm_size_t length)
+                                                                           pl_vm_size_t length,
+                                                                           machine_ptr *row_start,
+                                                                           machine_ptr *row_end)
 {
     plcrash::async::dwarf_opstream opstream;
     plcrash_error_t err;
     machine_ptr location = initial_pc_value;
+    machine_ptr previous_location = initial_pc_value;
 
     /* Save the initial state; this is needed for DW_CFA_restore, et al. */
     // TODO - It would be preferrable to only allocate the number of registers actually required here.
@@ -187,6 +195,7 @@ plcrash_error_t dwarf_cfa_state<machine_ptr, machine_ptr_s>::eval_program (plcra
     uint8_t opcode;
     while ((pc == 0 || location <= pc) && opstream.read_intU(&opcode)) {
         uint8_t const_operand = 0;
+        previous_location = location;
 
         /* Check for opcodes encoded in the top two bits, with an operand
          * in the bottom 6 bits. */
@@ -454,6 +463,14 @@ plcrash_error_t dwarf_cfa_state<machine_ptr, machine_ptr_s>::eval_program (plcra
         }
     }
 
+    /* If evaluation stopped on a location advance beyond pc, the row ends at the new location */
+    bool advanced_past_pc = (pc != 0 && location > pc);
+    if (row_start != NULL)
+        *row_start = advanced_past_pc ? previous_location : location;
+
+    if (row_end != NULL)
+        *row_end = advanced_past_pc ? location : 0;
+
     return PLCRASH_ESUCCESS;
 }
 
@@ -28,6 +28,7 @@
 #include "PLCrashFeatureConfig.h"
 
 #include <inttypes.h>
+#include <stdlib.h>
 
 #if PLCRASH_FEATURE_UNWIND_DWARF
 
@@ -63,6 +64,8 @@ plcrash_error_t dwarf_frame_reader::init (plcrash_async_mobject_t *mobj,
     _byteorder = byteorder;
     _debug_frame = debug_frame;
     _m64 = m64;
+    _fde_table = NULL;
+    _fde_table_count = 0;
     
     return PLCRASH_ESUCCESS;
 }
@@ -70,6 +73,9 @@ plcrash_error_t dwarf_frame_reader::init (plcrash_async_mobject_t *mobj,
 /**
  * Locate the frame descriptor entry for @a pc, if available.
  *
+ * If an FDE lookup table has been built via nasync_build_fde_table() and no offset hint is provided, the
+ * FDE will be located via a binary search of the table. Otherwise, the frame data is scanned linearly.
+ *
  * @param offset A section-relative offset at which the FDE search will be initiated. This is primarily useful in combination with the compact unwind
  * encoding, in cases where the unwind instructions can not be expressed, and instead a FDE offset is provided by the encoding. Pass an offset of 0
  * to begin searching at the beginning of the unwind data.
@@ -86,11 +92,14 @@ plcrash_error_t dwarf_frame_reader::find_fde (pl_vm_off_t offset,
                                               pl_vm_address_t pc,
                                               plcrash_async_dwarf_fde_info_t *fde_info)
 {
-    const plcrash_async_byteorder_t *byteorder = _byteorder;
     const pl_vm_address_t base_addr = plcrash_async_mobject_base_address(_mobj);
     const pl_vm_address_t end_addr = base_addr + plcrash_async_mobject_length(_mobj);
     
     plcrash_error_t err;
+
+    /* Use the lookup table, if available */
+    if (_fde_table != NULL && offset == 0x0)
+        return find_fde_in_table(pc, fde_info);
     
     /* Apply the FDE offset */
     pl_vm_address_t cfi_entry = base_addr;
@@ -105,23 +114,219 @@ plcrash_error_t dwarf_frame_reader::find_fde (pl_vm_off_t offset,
     }
     
     /* Iterate over table entries */
-    while (cfi_entry < end_addr) {
+    pl_vm_address_t fde_entry;
+    while ((err = next_fde(&cfi_entry, &fde_entry, fde_info)) == PLCRASH_ESUCCESS) {
+        /* Check if our PC is within range */
+        if (pc >= fde_info->pc_start && pc < fde_info->pc_end)
+            return PLCRASH_ESUCCESS;
+    }
+    
+    return err;
+}
+
+/*
+ * FDE lookup table sort comparator; orders by ascending pc_start.
+ */
+int dwarf_frame_reader::fde_table_entry_compare (const void *a, const void *b) {
+    const fde_table_entry *lhs = (const fde_table_entry *) a;
+    const fde_table_entry *rhs = (const fde_table_entry *) b;
+
+    if (lhs->pc_start < rhs->pc_start)
+        return -1;
+    else if (lhs->pc_start > rhs->pc_start)
+        return 1;
+
+    return 0;
+}
+
+/**
+ * Build a lookup table of all FDEs within the frame data, sorted by their starting PC. Once built, find_fde()
+ * will locate FDEs via a binary search of the table, rather than a linear scan of the frame data.
+ *
+ * FDEs covering an empty PC range can never match a lookup, and are omitted from the table. Overlapping FDEs
+ * are retained, and are resolved at lookup time in favor of the FDE appearing first in the frame data, matching
+ * the behavior of the linear scan.
+ *
+ * The table must be freed via nasync_free_fde_table().
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or an appropriate plcrash_error_t value if the frame data could not be
+ * parsed, or the table could not be allocated.
+ *
+ * @warning This method is not async safe.
+ */
+plcrash_error_t dwarf_frame_reader::nasync_build_fde_table () {
+    const pl_vm_address_t base_addr = plcrash_async_mobject_base_address(_mobj);
+    plcrash_async_dwarf_fde_info_t fde_info;
+    plcrash_error_t err;
+
+    /* Count the available non-empty FDEs */
+    size_t count = 0;
+    pl_vm_address_t cfi_entry = base_addr;
+    pl_vm_address_t fde_entry;
+    while ((err = next_fde(&cfi_entry, &fde_entry, &fde_info)) == PLCRASH_ESUCCESS) {
+        if (fde_info.pc_end > fde_info.pc_start)
+            count++;
+        plcrash_async_dwarf_fde_info_free(&fde_info);
+    }
+
+    if (err != PLCRASH_ENOTFOUND)
+        return err;
+
+    /* Allocate and populate the table */
+    fde_table_entry *table = (fde_table_entry *) malloc(sizeof(fde_table_entry) * (count > 0 ? count : 1));
+    if (table == NULL)
+        return PLCRASH_ENOMEM;
+
+    size_t idx = 0;
+    cfi_entry = base_addr;
+    while (idx < count && (err = next_fde(&cfi_entry, &fde_entry, &fde_info)) == PLCRASH_ESUCCESS) {
+        if (fde_info.pc_end > fde_info.pc_start) {
+            table[idx].pc_start = fde_info.pc_start;
+            table[idx].pc_end = fde_info.pc_end;
+            table[idx].entry_offset = fde_entry - base_addr;
+            idx++;
+        }
+        plcrash_async_dwarf_fde_info_free(&fde_info);
+    }
+
+    /* Sort by starting address. The sort is stable, preserving section order for overlapping entries. */
+    if (mergesort(table, idx, sizeof(fde_table_entry), fde_table_entry_compare) != 0) {
+        free(table);
+        return PLCRASH_ENOMEM;
+    }
+
+    /* Record the running maximum end address, allowing lookups to find any earlier entry that overlaps a later one */
+    uint64_t max_pc_end = 0;
+    for (size_t i = 0; i < idx; i++) {
+        if (table[i].pc_end > max_pc_end)
+            max_pc_end = table[i].pc_end;
+        table[i].max_pc_end = max_pc_end;
+    }
+
+    nasync_free_fde_table();
+    _fde_table = table;
+    _fde_table_count = idx;
+
+    return PLCRASH_ESUCCESS;
+}
+
+/**
+ * Free the FDE lookup table, if any, returning the reader to linear FDE search.
+ *
+ * @warning This method is not async safe.
+ */
+void dwarf_frame_reader::nasync_free_fde_table () {
+    if (_fde_table != NULL)
+        free(_fde_table);
+
+    _fde_table = NULL;
+    _fde_table_count = 0;
+}
+
+/**
+ * @internal
+ *
+ * Locate the FDE for @a pc via a binary search of the FDE lookup table.
+ *
+ * @param pc The PC value to search for.
+ * @param fde_info If the FDE is found, PLFRAME_ESUCCESS will be returned and @a fde_info will be initialized with the
+ * FDE data.
+ *
+ * @return Returns PLFRAME_ESUCCCESS on success, PLFRAME_ENOTFOUND if no FDE covers @a pc, or one of the remaining
+ * error codes if a DWARF parsing error occurs.
+ */
+plcrash_error_t dwarf_frame_reader::find_fde_in_table (pl_vm_address_t pc, plcrash_async_dwarf_fde_info_t *fde_info) {
+    /* Find the first entry with a pc_start greater than pc */
+    size_t low = 0;
+    size_t high = _fde_table_count;
+    while (low < high) {
+        size_t mid = low + ((high - low) / 2);
+        if (_fde_table[mid].pc_start <= pc) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    /*
+     * Walk back over the entries starting at or before pc, stopping once no earlier entry can extend past pc. If
+     * multiple FDEs overlap pc, prefer the one appearing first in the frame data, as the linear scan would.
+     */
+    const fde_table_entry *entry = NULL;
+    for (size_t i = low; i > 0 && _fde_table[i - 1].max_pc_end > pc; i--) {
+        const fde_table_entry *candidate = &_fde_table[i - 1];
+        if (pc >= candidate->pc_end)
+            continue;
+
+        if (entry == NULL || candidate->entry_offset < entry->entry_offset)
+            entry = candidate;
+    }
+
+    if (entry == NULL)
+        return PLCRASH_ENOTFOUND;
+
+    return decode_fde(plcrash_async_mobject_base_address(_mobj) + entry->entry_offset, fde_info);
+}
+
+/**
+ * @internal
+ *
+ * Decode the FDE at @a cfi_entry.
+ *
+ * @param cfi_entry The target-relative address of the FDE, including its initial length field.
+ * @param fde_info On success, will be initialized with the FDE data.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or an appropriate plcrash_error_t value on error.
+ */
+plcrash_error_t dwarf_frame_reader::decode_fde (pl_vm_address_t cfi_entry, plcrash_async_dwarf_fde_info_t *fde_info) {
+    if (_m64)
+        return plcrash_async_dwarf_fde_info_init<uint64_t>(fde_info, _mobj, _byteorder, cfi_entry, _debug_frame);
+    else
+        return plcrash_async_dwarf_fde_info_init<uint32_t>(fde_info, _mobj, _byteorder, cfi_entry, _debug_frame);
+}
+
+/**
+ * @internal
+ *
+ * Decode the next FDE at or following @a cfi_entry, skipping any CIE entries.
+ *
+ * @param cfi_entry The target-relative address of the CFI entry at which to begin the search. On success, this will be
+ * updated to point to the entry following the returned FDE.
+ * @param fde_entry On success, will be set to the target-relative address of the returned FDE, including its initial
+ * length field.
+ * @param fde_info On success, will be initialized with the FDE data.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, PLCRASH_ENOTFOUND if no further FDEs are available, or one of the
+ * remaining error codes if a DWARF parsing error occurs.
+ */
+plcrash_error_t dwarf_frame_reader::next_fde (pl_vm_address_t *cfi_entry,
+                                              pl_vm_address_t *fde_entry,
+                                              plcrash_async_dwarf_fde_info_t *fde_info)
+{
+    const plcrash_async_byteorder_t *byteorder = _byteorder;
+    const pl_vm_address_t base_addr = plcrash_async_mobject_base_address(_mobj);
+    const pl_vm_address_t end_addr = base_addr + plcrash_async_mobject_length(_mobj);
+    
+    plcrash_error_t err;
+    
+    /* Iterate over table entries */
+    while (*cfi_entry < end_addr) {
         /* Fetch the entry length (and determine wether it's 64-bit or 32-bit) */
         uint64_t length;
         pl_vm_size_t length_size;
         uint8_t dwarf_word_size;
         
         {
-            uint32_t *length32 = (uint32_t *) plcrash_async_mobject_remap_address(_mobj, cfi_entry, 0x0, sizeof(uint32_t));
+            uint32_t *length32 = (uint32_t *) plcrash_async_mobject_remap_address(_mobj, *cfi_entry, 0x0, sizeof(uint32_t));
             if (length32 == NULL) {
-                PLCF_DEBUG("The current CFI entry 0x%" PRIx64 " header lies outside the mapped range", (uint64_t) cfi_entry);
+                PLCF_DEBUG("The current CFI entry 0x%" PRIx64 " header lies outside the mapped range", (uint64_t) *cfi_entry);
                 return PLCRASH_EINVAL;
             }
             
             if (byteorder->swap32(*length32) == UINT32_MAX) {
-                uint64_t *length64 = (uint64_t *) plcrash_async_mobject_remap_address(_mobj, cfi_entry, sizeof(uint32_t), sizeof(uint64_t));
+                uint64_t *length64 = (uint64_t *) plcrash_async_mobject_remap_address(_mobj, *cfi_entry, sizeof(uint32_t), sizeof(uint64_t));
                 if (length64 == NULL) {
-                    PLCF_DEBUG("The current CFI entry 0x%" PRIx64 " header lies outside the mapped range", (uint64_t) cfi_entry);
+                    PLCF_DEBUG("The current CFI entry 0x%" PRIx64 " header lies outside the mapped range", (uint64_t) *cfi_entry);
                     return PLCRASH_EINVAL;
                 }
                 
@@ -155,7 +360,7 @@ plcrash_error_t dwarf_frame_reader::find_fde (pl_vm_off_t offset,
         
         /* Calculate the next entry address; the length_size addition is known-safe, as we were able to successfully read the length from *cfi_entry */
         pl_vm_address_t next_cfi_entry;
-        if (!plcrash_async_address_apply_offset(cfi_entry+length_size, (pl_vm_off_t) length, &next_cfi_entry)) {
+        if (!plcrash_async_address_apply_offset((*cfi_entry)+length_size, (pl_vm_off_t) length, &next_cfi_entry)) {
             PLCF_DEBUG("Entry length size overflows the CFI address");
             return PLCRASH_EINVAL;
         }
@@ -163,8 +368,8 @@ plcrash_error_t dwarf_frame_reader::find_fde (pl_vm_off_t offset,
         /* Fetch the entry id */
         uint64_t cie_id;
         
-        if ((plcrash_async_dwarf_read_uintmax64(_mobj, byteorder, cfi_entry, length_size, dwarf_word_size, &cie_id)) != PLCRASH_ESUCCESS) {
-            PLCF_DEBUG("The current CFI entry 0x%" PRIx64 " cie_id lies outside the mapped range", (uint64_t) cfi_entry);
+        if ((plcrash_async_dwarf_read_uintmax64(_mobj, byteorder, *cfi_entry, length_size, dwarf_word_size, &cie_id)) != PLCRASH_ESUCCESS) {
+            PLCF_DEBUG("The current CFI entry 0x%" PRIx64 " cie_id lies outside the mapped range", (uint64_t) *cfi_entry);
             return PLCRASH_EINVAL;
         }
         
@@ -183,25 +388,19 @@ plcrash_error_t dwarf_frame_reader::find_fde (pl_vm_off_t offset,
             /* If not a FDE, skip */
             if (is_cie) {
                 /* Not a FDE -- skip */
-                cfi_entry = next_cfi_entry;
+                *cfi_entry = next_cfi_entry;
                 continue;
             }
         }
         
         /* Decode the FDE */
-        if (_m64)
-            err = plcrash_async_dwarf_fde_info_init<uint64_t>(fde_info, _mobj, byteorder, cfi_entry, _debug_frame);
-        else
-            err = plcrash_async_dwarf_fde_info_init<uint32_t>(fde_info, _mobj, byteorder, cfi_entry, _debug_frame);
-        if (err != PLCRASH_ESUCCESS)
+        if ((err = decode_fde(*cfi_entry, fde_info)) != PLCRASH_ESUCCESS)
             return err;
-        
-        /* Check if our PC is within range */
-        if (pc >= fde_info->pc_start && pc < fde_info->pc_end)
-            return PLCRASH_ESUCCESS;
-        
-        /* Skip to the next entry */
-        cfi_entry = next_cfi_entry;
+
+        /* Advance to the next entry */
+        *fde_entry = *cfi_entry;
+        *cfi_entry = next_cfi_entry;
+        return PLCRASH_ESUCCESS;
     }
     
     return PLCRASH_ENOTFOUND;
@@ -64,7 +64,39 @@ public:
                               pl_vm_address_t pc,
                               plcrash_async_dwarf_fde_info_t *fde_info);
 
+    plcrash_error_t nasync_build_fde_table ();
+    void nasync_free_fde_table ();
+
+    /**
+     * Return the number of entries in the reader's FDE lookup table, or 0 if no table has been built.
+     */
+    size_t fde_table_count () const { return _fde_table_count; }
+
 private:
+    /**
+     * @internal
+     *
+     * An FDE lookup table entry.
+     */
+    struct fde_table_entry {
+        /** The start of the IP range covered by the FDE. */
+        uint64_t pc_start;
+
+        /** The end of the IP range covered by the FDE (exclusive). */
+        uint64_t pc_end;
+
+        /** The greatest pc_end of this entry and all entries preceding it in the table, used to bound the search for overlapping FDEs. */
+        uint64_t max_pc_end;
+
+        /** The section-relative offset of the FDE, including its initial length field. */
+        pl_vm_address_t entry_offset;
+    };
+
+    plcrash_error_t next_fde (pl_vm_address_t *cfi_entry, pl_vm_address_t *fde_entry, plcrash_async_dwarf_fde_info_t *fde_info);
+    plcrash_error_t decode_fde (pl_vm_address_t cfi_entry, plcrash_async_dwarf_fde_info_t *fde_info);
+    plcrash_error_t find_fde_in_table (pl_vm_address_t pc, plcrash_async_dwarf_fde_info_t *fde_info);
+    static int fde_table_entry_compare (const void *a, const void *b);
+
     /** A memory object containing the DWARF data at the starting address. */
     plcrash_async_mobject_t *_mobj;
     
@@ -76,6 +108,12 @@ private:
     
     /** True if this is a debug_frame section */
     bool _debug_frame;
+
+    /** The FDE lookup table, sorted by pc_start, or NULL if no table has been built. */
+    fde_table_entry *_fde_table;
+
+    /** The number of entries in _fde_table. */
+    size_t _fde_table_count;
 };
     
 PLCR_CPP_END_NS
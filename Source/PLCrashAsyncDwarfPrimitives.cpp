@@ -445,39 +445,15 @@ plcrash_error_t plcrash::async::plcrash_async_dwarf_read_task_uleb128 (task_t ta
  * @param size On success, will be set to the total size of the decoded LEB128 value at @a location, in bytes.
  */
 plcrash_error_t plcrash::async::plcrash_async_dwarf_read_uleb128 (plcrash_async_mobject_t *mobj, pl_vm_address_t location, pl_vm_off_t offset, uint64_t *result, pl_vm_size_t *size) {
-    unsigned int shift = 0;
-    pl_vm_off_t position = 0;
-    *result = 0;
-    
-    uint8_t *p;
-    while ((p = (uint8_t *) plcrash_async_mobject_remap_address(mobj, location, position + offset, 1)) != NULL) {
-        /* LEB128 uses 7 bits for the number, the final bit to signal completion */
-        uint8_t byte = *p;
-        *result |= ((uint64_t) (byte & 0x7f)) << shift;
-        shift += 7;
-        
-        /* This is used to track length, so we must set it before
-         * potentially terminating the loop below */
-        position++;
-        
-        /* Check for terminating bit */
-        if ((byte & 0x80) == 0)
-            break;
-        
-        /* Check for a ULEB128 larger than 64-bits */
-        if (shift >= 64) {
-            PLCF_DEBUG("ULEB128 is larger than the maximum supported size of 64 bits");
-            return PLCRASH_ENOTSUP;
-        }
-    }
-    
+    /* Validate the available span once; the decoder performs no further bounds checks */
+    const uint8_t *p = (const uint8_t *) plcrash_async_mobject_remap_address(mobj, location, offset, 1);
     if (p == NULL) {
         PLCF_DEBUG("ULEB128 value did not terminate within mapped memory range");
         return PLCRASH_EINVAL;
     }
-    
-    *size = position;
-    return PLCRASH_ESUCCESS;
+
+    pl_vm_size_t avail = (pl_vm_size_t) (mobj->address + mobj->length - (uintptr_t) p);
+    return plcrash_async_dwarf_decode_uleb128(p, avail, result, size);
 }
 
 /**
@@ -490,43 +466,15 @@ plcrash_error_t plcrash::async::plcrash_async_dwarf_read_uleb128 (plcrash_async_
  * @param size On success, will be set to the total size of the decoded LEB128 value, in bytes.
  */
 plcrash_error_t plcrash::async::plcrash_async_dwarf_read_sleb128 (plcrash_async_mobject_t *mobj, pl_vm_address_t location, pl_vm_off_t offset, int64_t *result, pl_vm_size_t *size) {
-    unsigned int shift = 0;
-    pl_vm_off_t position = 0;
-    *result = 0;
-    
-    uint8_t *p;
-    while ((p = (uint8_t *) plcrash_async_mobject_remap_address(mobj, location, position + offset, 1)) != NULL) {
-        /* LEB128 uses 7 bits for the number, the final bit to signal completion */
-        uint8_t byte = *p;
-        *result |= ((uint64_t) (byte & 0x7f)) << shift;
-        shift += 7;
-        
-        /* This is used to track length, so we must set it before
-         * potentially terminating the loop below */
-        position++;
-        
-        /* Check for terminating bit */
-        if ((byte & 0x80) == 0)
-            break;
-        
-        /* Check for a ULEB128 larger than 64-bits */
-        if (shift >= 64) {
-            PLCF_DEBUG("ULEB128 is larger than the maximum supported size of 64 bits");
-            return PLCRASH_ENOTSUP;
-        }
-    }
-    
+    /* Validate the available span once; the decoder performs no further bounds checks */
+    const uint8_t *p = (const uint8_t *) plcrash_async_mobject_remap_address(mobj, location, offset, 1);
     if (p == NULL) {
-        PLCF_DEBUG("ULEB128 value did not terminate within mapped memory range");
+        PLCF_DEBUG("SLEB128 value did not terminate within mapped memory range");
         return PLCRASH_EINVAL;
     }
-    
-    /* Sign bit is 2nd high order bit */
-    if (shift < 64 && (*p & 0x40))
-        *result |= -(1ULL << shift);
-    
-    *size = position;
-    return PLCRASH_ESUCCESS;
+
+    pl_vm_size_t avail = (pl_vm_size_t) (mobj->address + mobj->length - (uintptr_t) p);
+    return plcrash_async_dwarf_decode_sleb128(p, avail, result, size);
 }
 
 /* Provide explicit 32/64-bit instantiations */
@@ -339,6 +339,132 @@ private:
     base_addr_t _func_base;
 };
 
+#ifndef PLCRASH_ASYNC_DWARF_LEB128_WORD_DECODE
+/**
+ * If true, LEB128 values of up to 8 bytes are decoded using a single 64-bit load and continuation bit mask, rather
+ * than a byte at a time. The byte-at-a-time decoder is always used for longer values, and when fewer than 8 bytes
+ * remain in the input.
+ */
+#  define PLCRASH_ASYNC_DWARF_LEB128_WORD_DECODE 1
+#endif
+
+/**
+ * @internal
+ *
+ * Decode a LEB128 value from the @a avail bytes at @a p. The caller is responsible for verifying that @a avail
+ * bytes are readable at @a p; no further bounds checking is performed.
+ *
+ * @param p The LEB128 data.
+ * @param avail The number of readable bytes at @a p.
+ * @param result On success, the decoded 7-bit groups, zero-extended.
+ * @param size On success, the total size of the LEB128 value, in bytes.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, PLCRASH_EINVAL if the value does not terminate within @a avail
+ * bytes, or PLCRASH_ENOTSUP if the value is larger than 64 bits.
+ */
+static inline plcrash_error_t plcrash_async_dwarf_decode_leb128 (const uint8_t *p, pl_vm_size_t avail, uint64_t *result, pl_vm_size_t *size) {
+#if PLCRASH_ASYNC_DWARF_LEB128_WORD_DECODE
+    if (avail >= sizeof(uint64_t)) {
+        uint64_t word;
+        __builtin_memcpy(&word, p, sizeof(word));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+
+        /* Locate the first byte with a clear continuation bit */
+        uint64_t stop = ~word & 0x8080808080808080ULL;
+        if (stop != 0) {
+            unsigned int len = (__builtin_ctzll(stop) >> 3) + 1;
+            uint64_t v = word & 0x7f7f7f7f7f7f7f7fULL;
+            if (len < sizeof(uint64_t))
+                v &= (1ULL << (len * 8)) - 1;
+
+            /* Pack the 7-bit groups: 8 x 7 -> 4 x 14 -> 2 x 28 -> 1 x 56 bits */
+            v = ((v & 0x7f007f007f007f00ULL) >> 1) | (v & 0x007f007f007f007fULL);
+            v = ((v & 0x3fff00003fff0000ULL) >> 2) | (v & 0x00003fff00003fffULL);
+            v = ((v & 0x0fffffff00000000ULL) >> 4) | (v & 0x000000000fffffffULL);
+
+            *result = v;
+            *size = len;
+            return PLCRASH_ESUCCESS;
+        }
+
+        /* Values longer than 8 bytes are decoded below */
+    }
+#endif
+
+    unsigned int shift = 0;
+    uint64_t v = 0;
+    for (pl_vm_size_t position = 0; position < avail; position++) {
+        /* LEB128 uses 7 bits for the number, the final bit to signal completion */
+        uint8_t byte = p[position];
+        v |= ((uint64_t) (byte & 0x7f)) << shift;
+        shift += 7;
+
+        /* Check for terminating bit */
+        if ((byte & 0x80) == 0) {
+            *result = v;
+            *size = position + 1;
+            return PLCRASH_ESUCCESS;
+        }
+
+        /* Check for a LEB128 larger than 64-bits */
+        if (shift >= 64) {
+            PLCF_DEBUG("LEB128 is larger than the maximum supported size of 64 bits");
+            return PLCRASH_ENOTSUP;
+        }
+    }
+
+    PLCF_DEBUG("LEB128 value did not terminate within mapped memory range");
+    return PLCRASH_EINVAL;
+}
+
+/**
+ * @internal
+ *
+ * Decode a ULEB128 value from the @a avail bytes at @a p. The caller is responsible for verifying that @a avail
+ * bytes are readable at @a p.
+ *
+ * @param p The ULEB128 data.
+ * @param avail The number of readable bytes at @a p.
+ * @param result On success, the ULEB128 value.
+ * @param size On success, the total size of the ULEB128 value, in bytes.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or a plcrash_error_t error code if the value could not be decoded.
+ */
+static inline plcrash_error_t plcrash_async_dwarf_decode_uleb128 (const uint8_t *p, pl_vm_size_t avail, uint64_t *result, pl_vm_size_t *size) {
+    return plcrash_async_dwarf_decode_leb128(p, avail, result, size);
+}
+
+/**
+ * @internal
+ *
+ * Decode a SLEB128 value from the @a avail bytes at @a p. The caller is responsible for verifying that @a avail
+ * bytes are readable at @a p.
+ *
+ * @param p The SLEB128 data.
+ * @param avail The number of readable bytes at @a p.
+ * @param result On success, the SLEB128 value.
+ * @param size On success, the total size of the SLEB128 value, in bytes.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or a plcrash_error_t error code if the value could not be decoded.
+ */
+static inline plcrash_error_t plcrash_async_dwarf_decode_sleb128 (const uint8_t *p, pl_vm_size_t avail, int64_t *result, pl_vm_size_t *size) {
+    uint64_t v;
+    plcrash_error_t err;
+
+    if ((err = plcrash_async_dwarf_decode_leb128(p, avail, &v, size)) != PLCRASH_ESUCCESS)
+        return err;
+
+    /* Sign bit is the 2nd high order bit of the final byte */
+    unsigned int shift = (unsigned int) (*size * 7);
+    if (shift < 64 && (p[*size - 1] & 0x40))
+        v |= -(1ULL << shift);
+
+    *result = (int64_t) v;
+    return PLCRASH_ESUCCESS;
+}
+
 plcrash_error_t plcrash_async_dwarf_read_uleb128 (plcrash_async_mobject_t *mobj, pl_vm_address_t location, pl_vm_off_t offset, uint64_t *result, pl_vm_size_t *size);
 plcrash_error_t plcrash_async_dwarf_read_sleb128 (plcrash_async_mobject_t *mobj, pl_vm_address_t location, pl_vm_off_t offset, int64_t *result, pl_vm_size_t *size);
 
@@ -29,10 +29,16 @@
 #include "PLCrashAsync.h"
 #include "PLCrashAsyncImageList.h"
 #include "PLCrashAsyncLinkedList.hpp"
+#include "PLCrashFrameDWARFUnwind.h"
+#include "PLCrashFrameCompactUnwind.h"
 
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <dlfcn.h>
+#include <inttypes.h>
+
+#include <atomic>
 
 using namespace plcrash::async;
 
@@ -44,6 +50,9 @@ using namespace plcrash::async;
  * Maintains a linked list of binary images with support for async-safe iteration. Writing may occur concurrently with
  * async-safe reading, but is not async-safe.
  *
+ * Removed images are retired, and freed by a subsequent update once all readers that were active at the time of their
+ * removal have completed.
+ *
  * Atomic compare and swap is used to ensure a consistent view of the list for readers. To simplify implementation, a
  * write mutex is held for all updates; the implementation is not designed for efficiency in the face of contention
  * between readers and writers, and it's assumed that no contention should realistically occur.
@@ -51,6 +60,306 @@ using namespace plcrash::async;
  */
 
 
+/**
+ * @internal
+ *
+ * Allocate a new, empty address range index with space for @a capacity entries.
+ *
+ * @param capacity The number of entries to be allocated.
+ *
+ * @return Returns the new index, or NULL if allocation fails.
+ */
+static plcrash_async_image_range_index_t *plcrash_nasync_image_range_index_new (size_t capacity) {
+    plcrash_async_image_range_index_t *index = (plcrash_async_image_range_index_t *) malloc(sizeof(*index) + (sizeof(plcrash_async_image_range_t) * capacity));
+    if (index == NULL)
+        return NULL;
+
+    index->ranges = (plcrash_async_image_range_t *) (index + 1);
+    index->count = 0;
+    index->_next_retired = NULL;
+    return index;
+}
+
+/**
+ * @internal
+ *
+ * Free @a image and all associated resources.
+ *
+ * @param image The image to be freed.
+ */
+static void plcrash_nasync_image_free (plcrash_async_image_t *image) {
+    /* Deallocate the DWARF unwind context. */
+#if PLCRASH_FEATURE_UNWIND_DWARF
+    if (image->dwarf_unwind != NULL)
+        plframe_nasync_dwarf_unwind_context_free(image->dwarf_unwind);
+
+    /* Deallocate the compact unwind context. */
+    if (image->compact_unwind != NULL)
+        plframe_nasync_compact_unwind_context_free(image->compact_unwind);
+#endif
+
+    /* Deallocate the Mach-O reference. */
+    plcrash_nasync_macho_free(&image->macho_image);
+
+    /* Deallocate the actual image value */
+    free(image);
+}
+
+/**
+ * @internal
+ *
+ * Free all retired images and address range indexes that are no longer referenced by any reader. The caller
+ * must hold the list's write lock.
+ *
+ * @param list The list whose retired values should be reclaimed.
+ */
+static void plcrash_nasync_image_list_reclaim (plcrash_async_image_list_t *list) {
+    plcrash_async_image_range_index_t **index_prevp = &list->_retired_range_index;
+    while (*index_prevp != NULL) {
+        plcrash_async_image_range_index_t *index = *index_prevp;
+        if (!list->_list->nasync_epoch_quiesced(index->_retire_epoch)) {
+            index_prevp = &index->_next_retired;
+            continue;
+        }
+
+        *index_prevp = index->_next_retired;
+        free(index);
+    }
+
+    plcrash_async_image_t **image_prevp = &list->_retired_images;
+    while (*image_prevp != NULL) {
+        plcrash_async_image_t *image = *image_prevp;
+        if (!list->_list->nasync_epoch_quiesced(image->_retire_epoch)) {
+            image_prevp = &image->_next_retired;
+            continue;
+        }
+
+        *image_prevp = image->_next_retired;
+        plcrash_nasync_image_free(image);
+    }
+}
+
+/**
+ * @internal
+ *
+ * Return the preferred @a list header table slot for @a header.
+ *
+ * @param list The list whose table should be searched.
+ * @param header The image header address.
+ */
+static inline size_t plcrash_nasync_image_table_slot (plcrash_async_image_list_t *list, pl_vm_address_t header) {
+    /* Fibonacci hashing; header addresses are page aligned, and the low bits carry no information. */
+    uint64_t hash = ((uint64_t) header) * 0x9E3779B97F4A7C15ULL;
+    return (size_t) (hash ^ (hash >> 32)) & (list->_header_table_capacity - 1);
+}
+
+/**
+ * @internal
+ *
+ * Insert @a image into @a list's header address table, growing the table if necessary. If the table can not
+ * be grown, it will be discarded, and removal will fall back to scanning the list. The caller must hold the
+ * list's write lock.
+ *
+ * @param list The list to be updated.
+ * @param image The image to be inserted.
+ */
+static void plcrash_nasync_image_table_insert (plcrash_async_image_list_t *list, plcrash_async_image_t *image) {
+    if (list->_header_table == NULL)
+        return;
+
+    /* Maintain a load factor of no more than 50% */
+    if ((list->_header_table_count + 1) * 2 > list->_header_table_capacity) {
+        plcrash_async_image_t **previous = list->_header_table;
+        size_t previous_capacity = list->_header_table_capacity;
+
+        list->_header_table = (plcrash_async_image_t **) calloc(previous_capacity * 2, sizeof(list->_header_table[0]));
+        if (list->_header_table == NULL) {
+            PLCF_DEBUG("Failed to grow image header table; falling back to linear image removal");
+            free(previous);
+            list->_header_table_capacity = 0;
+            list->_header_table_count = 0;
+            return;
+        }
+
+        list->_header_table_capacity = previous_capacity * 2;
+        list->_header_table_count = 0;
+        for (size_t i = 0; i < previous_capacity; i++) {
+            if (previous[i] != NULL)
+                plcrash_nasync_image_table_insert(list, previous[i]);
+        }
+        free(previous);
+    }
+
+    size_t mask = list->_header_table_capacity - 1;
+    size_t slot = plcrash_nasync_image_table_slot(list, image->macho_image.header_addr);
+    while (list->_header_table[slot] != NULL)
+        slot = (slot + 1) & mask;
+
+    list->_header_table[slot] = image;
+    list->_header_table_count++;
+}
+
+/**
+ * @internal
+ *
+ * Find and remove the first image with @a header from @a list's header address table. The caller must hold
+ * the list's write lock.
+ *
+ * @param list The list to be updated.
+ * @param header The header address of the image to be removed.
+ *
+ * @return Returns the removed image, or NULL if not found.
+ */
+static plcrash_async_image_t *plcrash_nasync_image_table_remove (plcrash_async_image_list_t *list, pl_vm_address_t header) {
+    size_t mask = list->_header_table_capacity - 1;
+    size_t slot = plcrash_nasync_image_table_slot(list, header);
+
+    while (list->_header_table[slot] != NULL && list->_header_table[slot]->macho_image.header_addr != header)
+        slot = (slot + 1) & mask;
+
+    plcrash_async_image_t *image = list->_header_table[slot];
+    if (image == NULL)
+        return NULL;
+
+    list->_header_table[slot] = NULL;
+    list->_header_table_count--;
+
+    /* Shift any subsequent entries in the probe sequence back into the vacated slot */
+    size_t hole = slot;
+    for (size_t next = (hole + 1) & mask; list->_header_table[next] != NULL; next = (next + 1) & mask) {
+        size_t preferred = plcrash_nasync_image_table_slot(list, list->_header_table[next]->macho_image.header_addr);
+
+        /* Leave the entry in place if its preferred slot lies cyclically within (hole, next] */
+        bool in_place = (hole <= next) ? (hole < preferred && preferred <= next) : (hole < preferred || preferred <= next);
+        if (in_place)
+            continue;
+
+        list->_header_table[hole] = list->_header_table[next];
+        list->_header_table[next] = NULL;
+        hole = next;
+    }
+
+    return image;
+}
+
+/**
+ * @internal
+ *
+ * Compute the running maximum end address of each range in @a index.
+ *
+ * @param index The populated index to be updated.
+ */
+static void plcrash_nasync_image_range_index_update_bounds (plcrash_async_image_range_index_t *index) {
+    pl_vm_address_t max_end = 0;
+    for (size_t i = 0; i < index->count; i++) {
+        if (index->ranges[i].end > max_end)
+            max_end = index->ranges[i].end;
+        index->ranges[i].max_end = max_end;
+    }
+}
+
+/**
+ * @internal
+ *
+ * Atomically replace the list's address range index with @a index, retiring the previous index. The caller
+ * must hold the list's write lock.
+ *
+ * @param list The list to be updated.
+ * @param index The new index, or NULL if the index is unavailable.
+ */
+static void plcrash_nasync_image_list_publish_ranges (plcrash_async_image_list_t *list, plcrash_async_image_range_index_t *index) {
+    plcrash_async_image_range_index_t *previous = list->_range_index;
+
+    /* Ensure the index is fully populated prior to making it visible to async-safe readers. */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    list->_range_index = index;
+
+    /* Retire the previous index; it may only be freed once no readers may hold a reference to it. */
+    if (previous != NULL) {
+        previous->_retire_epoch = list->_list->nasync_retire_epoch();
+        previous->_next_retired = list->_retired_range_index;
+        list->_retired_range_index = previous;
+    }
+
+    plcrash_nasync_image_list_reclaim(list);
+}
+
+/**
+ * @internal
+ *
+ * Publish a new address range index that includes @a image. The caller must hold the list's write lock.
+ *
+ * @param list The list to be updated.
+ * @param image The newly appended image.
+ */
+static void plcrash_nasync_image_list_insert_range (plcrash_async_image_list_t *list, plcrash_async_image_t *image) {
+    plcrash_async_image_range_index_t *previous = list->_range_index;
+
+    /* If the index is unavailable, lookups will fall back to scanning the list */
+    if (previous == NULL)
+        return;
+
+    plcrash_async_image_range_index_t *index = plcrash_nasync_image_range_index_new(previous->count + 1);
+    if (index == NULL) {
+        PLCF_DEBUG("Failed to allocate image address range index; falling back to linear image lookup");
+        plcrash_nasync_image_list_publish_ranges(list, NULL);
+        return;
+    }
+
+    plcrash_async_image_range_t range;
+    range.start = image->macho_image.header_addr;
+    range.end = image->macho_image.header_addr + image->macho_image.text_size;
+    range.sequence = list->_range_sequence++;
+    range.image = image;
+
+    /* Copy the existing ranges, inserting the new range after any ranges with an equal or lower start address */
+    bool inserted = false;
+    for (size_t i = 0; i < previous->count; i++) {
+        if (!inserted && previous->ranges[i].start > range.start) {
+            index->ranges[index->count++] = range;
+            inserted = true;
+        }
+        index->ranges[index->count++] = previous->ranges[i];
+    }
+
+    if (!inserted)
+        index->ranges[index->count++] = range;
+
+    plcrash_nasync_image_range_index_update_bounds(index);
+    plcrash_nasync_image_list_publish_ranges(list, index);
+}
+
+/**
+ * @internal
+ *
+ * Publish a new address range index that excludes @a image. The caller must hold the list's write lock.
+ *
+ * @param list The list to be updated.
+ * @param image The removed image.
+ */
+static void plcrash_nasync_image_list_remove_range (plcrash_async_image_list_t *list, plcrash_async_image_t *image) {
+    plcrash_async_image_range_index_t *previous = list->_range_index;
+
+    /* If the index is unavailable, lookups will fall back to scanning the list */
+    if (previous == NULL)
+        return;
+
+    plcrash_async_image_range_index_t *index = plcrash_nasync_image_range_index_new(previous->count);
+    if (index == NULL) {
+        PLCF_DEBUG("Failed to allocate image address range index; falling back to linear image lookup");
+        plcrash_nasync_image_list_publish_ranges(list, NULL);
+        return;
+    }
+
+    for (size_t i = 0; i < previous->count; i++) {
+        if (previous->ranges[i].image != image)
+            index->ranges[index->count++] = previous->ranges[i];
+    }
+
+    plcrash_nasync_image_range_index_update_bounds(index);
+    plcrash_nasync_image_list_publish_ranges(list, index);
+}
+
 /**
  * Initialize a new binary image list and issue a memory barrier
  *
@@ -64,6 +373,18 @@ void plcrash_nasync_image_list_init (plcrash_async_image_list_t *list, mach_port
 
     list->_list = new async_list<plcrash_async_image_t *>();
     list->task = task;
+    list->_write_lock = PLCR_COMPAT_LOCK_INIT;
+    list->_load_lock = PLCR_COMPAT_LOCK_INIT;
+    list->_range_index = plcrash_nasync_image_range_index_new(0);
+
+    list->_header_table = (plcrash_async_image_t **) calloc(PLCRASH_ASYNC_IMAGE_LIST_TABLE_CAPACITY, sizeof(list->_header_table[0]));
+    if (list->_header_table != NULL)
+        list->_header_table_capacity = PLCRASH_ASYNC_IMAGE_LIST_TABLE_CAPACITY;
+
+    /* Preallocate space for deferred registrations; dyld reports every loaded image at registration time */
+    list->_pending = (plcrash_async_image_pending_t *) malloc(sizeof(plcrash_async_image_pending_t) * PLCRASH_ASYNC_IMAGE_LIST_PENDING_CAPACITY);
+    if (list->_pending != NULL)
+        list->_pending_capacity = PLCRASH_ASYNC_IMAGE_LIST_PENDING_CAPACITY;
     mach_port_mod_refs(mach_task_self(), list->task, MACH_PORT_RIGHT_SEND, 1);
 }
 
@@ -76,23 +397,77 @@ void plcrash_nasync_image_list_free (plcrash_async_image_list_t *list) {
     /* Clean up the image structures */
     list->_list->set_reading(true);
     async_list<plcrash_async_image_t *>::node *next = NULL;
-    while ((next = list->_list->next(next)) != NULL) {
-        plcrash_async_image_t *image = next->value();
-        
-        /* Deallocate the Mach-O reference. */
-        plcrash_nasync_macho_free(&image->macho_image);
-        
-        /* Deallocate the actual image value */
-        free(image);
-    }
+    while ((next = list->_list->next(next)) != NULL)
+        plcrash_nasync_image_free(next->value());
     list->_list->set_reading(false);
 
+    /* Clean up any removed images */
+    while (list->_retired_images != NULL) {
+        plcrash_async_image_t *next = list->_retired_images->_next_retired;
+        plcrash_nasync_image_free(list->_retired_images);
+        list->_retired_images = next;
+    }
+
+    /* Free the header address table */
+    if (list->_header_table != NULL)
+        free(list->_header_table);
+
+    /* Discard any deferred registrations */
+    if (list->_pending != NULL)
+        free(list->_pending);
+
+    /* Free the address range indexes */
+    if (list->_range_index != NULL)
+        free(list->_range_index);
+
+    while (list->_retired_range_index != NULL) {
+        plcrash_async_image_range_index_t *next = list->_retired_range_index->_next_retired;
+        free(list->_retired_range_index);
+        list->_retired_range_index = next;
+    }
+
     /* Free the backing list */
     delete list->_list;
     
     mach_port_mod_refs(mach_task_self(), list->task, MACH_PORT_RIGHT_SEND, -1);
 }
 
+/**
+ * @internal
+ *
+ * Build the lookup structures specified by @a flags for @a image, if not already built. On failure, lookups fall back
+ * to their unindexed implementations.
+ *
+ * @param image The image to be indexed.
+ * @param flags The plcrash_async_image_index_t lookup structures to be built.
+ *
+ * @warning This method is not async safe, and must not be called concurrently for the same @a image.
+ */
+static void plcrash_nasync_image_build_indexes (plcrash_async_image_t *image, uint32_t flags) {
+    PLCF_UNUSED_IN_RELEASE plcrash_error_t ret;
+
+    if ((flags & PLCRASH_ASYNC_IMAGE_INDEX_SYMBOLS) && (ret = plcrash_nasync_macho_build_symbol_index(&image->macho_image)) != PLCRASH_ESUCCESS)
+        PLCF_DEBUG("Failed to build symbol index for %s: %d", image->macho_image.name, ret);
+
+#if PLCRASH_FEATURE_UNWIND_DWARF
+    if ((flags & PLCRASH_ASYNC_IMAGE_INDEX_DWARF_UNWIND) && image->dwarf_unwind == NULL) {
+        plframe_dwarf_unwind_context_t *context = plframe_nasync_dwarf_unwind_context_new(&image->macho_image);
+
+        /* Ensure the context is fully populated prior to making it visible to async-safe readers. */
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        image->dwarf_unwind = context;
+    }
+
+    if ((flags & PLCRASH_ASYNC_IMAGE_INDEX_COMPACT_UNWIND) && image->compact_unwind == NULL) {
+        plframe_compact_unwind_context_t *context = plframe_nasync_compact_unwind_context_new(&image->macho_image);
+
+        /* Ensure the context is fully populated prior to making it visible to async-safe readers. */
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        image->compact_unwind = context;
+    }
+#endif
+}
+
 /**
  * Append a new binary image record to @a list.
  *
@@ -113,8 +488,139 @@ void plcrash_nasync_image_list_append (plcrash_async_image_list_t *list, pl_vm_a
         return;
     }
 
+    /* Build any configured lookup structures prior to making the image visible to readers */
+    plcrash_nasync_image_build_indexes(new_entry, list->index_flags);
+
     /* Append */
-    list->_list->nasync_append(new_entry);
+    PLCR_COMPAT_LOCK_LOCK(&list->_write_lock); {
+        new_entry->_node = list->_list->nasync_append(new_entry);
+        plcrash_nasync_image_table_insert(list, new_entry);
+        plcrash_nasync_image_list_insert_range(list, new_entry);
+    } PLCR_COMPAT_LOCK_UNLOCK(&list->_write_lock);
+}
+
+/**
+ * Record a binary image to be appended to @a list by a later call to plcrash_nasync_image_list_load_deferred(). No
+ * Mach-O data is read; this is intended for use from dyld image callbacks, where the cost of
+ * plcrash_nasync_image_list_append() would be incurred for every loaded image.
+ *
+ * Deferred images are not visible to readers of the list until they have been loaded.
+ *
+ * @param list The list to which the image record should be appended.
+ * @param header The image's header address.
+ * @param vmaddr_slide The image's vmaddr slide.
+ * @param name A borrowed reference to the image's name, which must remain valid until the image is loaded, or NULL.
+ * If NULL, the name will be resolved via dladdr() when the image is loaded. This is only supported if @a list is
+ * configured for the current task.
+ *
+ * @warning This method is not async safe.
+ */
+void plcrash_nasync_image_list_append_deferred (plcrash_async_image_list_t *list, pl_vm_address_t header, intptr_t vmaddr_slide, const char *name) {
+    PLCR_COMPAT_LOCK_LOCK(&list->_write_lock); {
+        /* Grow the pending array, if necessary */
+        if (list->_pending_count == list->_pending_capacity) {
+            size_t capacity = list->_pending_capacity > 0 ? list->_pending_capacity * 2 : PLCRASH_ASYNC_IMAGE_LIST_PENDING_CAPACITY;
+            plcrash_async_image_pending_t *pending = (plcrash_async_image_pending_t *) realloc(list->_pending, sizeof(pending[0]) * capacity);
+            if (pending == NULL) {
+                PLCR_COMPAT_LOCK_UNLOCK(&list->_write_lock);
+
+                /* Fall back on loading the image immediately */
+                PLCF_DEBUG("Failed to grow deferred image array; loading image immediately");
+                Dl_info info;
+                if (name == NULL && dladdr((const void *) (uintptr_t) header, &info) != 0)
+                    name = info.dli_fname;
+
+                if (name != NULL)
+                    plcrash_nasync_image_list_append(list, header, name);
+                return;
+            }
+
+            list->_pending = pending;
+            list->_pending_capacity = capacity;
+        }
+
+        plcrash_async_image_pending_t *entry = &list->_pending[list->_pending_count++];
+        entry->header = header;
+        entry->vmaddr_slide = vmaddr_slide;
+        entry->name = name;
+    } PLCR_COMPAT_LOCK_UNLOCK(&list->_write_lock);
+}
+
+/**
+ * Load and append all images previously recorded via plcrash_nasync_image_list_append_deferred(), in registration
+ * order. Images may continue to be recorded, or removed, concurrently.
+ *
+ * @param list The list whose deferred images should be loaded.
+ *
+ * @return Returns the number of deferred registrations that were processed.
+ *
+ * @warning This method is not async safe.
+ */
+size_t plcrash_nasync_image_list_load_deferred (plcrash_async_image_list_t *list) {
+    size_t processed = 0;
+
+    for (;;) {
+        plcrash_async_image_pending_t entry;
+
+        /* Fetch the next pending entry */
+        PLCR_COMPAT_LOCK_LOCK(&list->_write_lock); {
+            if (list->_pending_head == list->_pending_count) {
+                PLCR_COMPAT_LOCK_UNLOCK(&list->_write_lock);
+                break;
+            }
+            entry = list->_pending[list->_pending_head];
+        } PLCR_COMPAT_LOCK_UNLOCK(&list->_write_lock);
+
+        /* Resolve the image name. This must be done prior to acquiring the load lock: dladdr() acquires the dyld lock,
+         * which is held by dyld while dispatching the image removal callbacks that acquire the load lock. */
+        const char *name = entry.name;
+        Dl_info info;
+        if (name == NULL && list->task == mach_task_self() && dladdr((const void *) (uintptr_t) entry.header, &info) != 0)
+            name = info.dli_fname;
+
+        PLCR_COMPAT_LOCK_LOCK(&list->_load_lock); {
+            /* The entry may have been removed while its name was being resolved */
+            bool current = false;
+            PLCR_COMPAT_LOCK_LOCK(&list->_write_lock); {
+                if (list->_pending_head < list->_pending_count && list->_pending[list->_pending_head].header == entry.header) {
+                    current = true;
+
+                    /* Reset the array once drained */
+                    if (++list->_pending_head == list->_pending_count) {
+                        list->_pending_head = 0;
+                        list->_pending_count = 0;
+                    }
+                }
+            } PLCR_COMPAT_LOCK_UNLOCK(&list->_write_lock);
+
+            if (current) {
+                if (name != NULL) {
+                    plcrash_nasync_image_list_append(list, entry.header, name);
+                } else {
+                    PLCF_DEBUG("Could not resolve the name of deferred image at 0x%" PRIx64, (uint64_t) entry.header);
+                }
+                processed++;
+            }
+        } PLCR_COMPAT_LOCK_UNLOCK(&list->_load_lock);
+    }
+
+    return processed;
+}
+
+/**
+ * Return the number of images recorded via plcrash_nasync_image_list_append_deferred() that have not yet
+ * been loaded.
+ *
+ * @param list The list to be queried.
+ *
+ * @warning This method is not async safe.
+ */
+size_t plcrash_nasync_image_list_deferred_count (plcrash_async_image_list_t *list) {
+    size_t count;
+    PLCR_COMPAT_LOCK_LOCK(&list->_write_lock); {
+        count = list->_pending_count - list->_pending_head;
+    } PLCR_COMPAT_LOCK_UNLOCK(&list->_write_lock);
+    return count;
 }
 
 /**
@@ -126,27 +632,102 @@ void plcrash_nasync_image_list_append (plcrash_async_image_list_t *list, pl_vm_a
  * @warning This method is not async safe.
  */
 void plcrash_nasync_image_list_remove (plcrash_async_image_list_t *list, pl_vm_address_t header) {
-    list->_list->set_reading(true); {
-        /* Find a matching entry */
-        async_list<plcrash_async_image_t *>::node *found = NULL;
-        async_list<plcrash_async_image_t *>::node *next = NULL;
-        while ((next = list->_list->next(next)) != NULL) {
-            if (next->value()->macho_image.header_addr == header) {
-                found = next;
-                break;
+    /* Wait for any in-progress deferred load, which may reference the image being removed */
+    PLCR_COMPAT_LOCK_LOCK(&list->_load_lock);
+    PLCR_COMPAT_LOCK_LOCK(&list->_write_lock); {
+        /* If the image has not yet been loaded, simply drop the deferred registration */
+        for (size_t i = list->_pending_head; i < list->_pending_count; i++) {
+            if (list->_pending[i].header != header)
+                continue;
+
+            memmove(&list->_pending[i], &list->_pending[i + 1], sizeof(list->_pending[0]) * (list->_pending_count - i - 1));
+            list->_pending_count--;
+
+            PLCR_COMPAT_LOCK_UNLOCK(&list->_write_lock);
+            PLCR_COMPAT_LOCK_UNLOCK(&list->_load_lock);
+            return;
+        }
+
+        /* Find a matching entry, using the header address table if available */
+        plcrash_async_image_t *image = NULL;
+        if (list->_header_table != NULL) {
+            image = plcrash_nasync_image_table_remove(list, header);
+        } else {
+            list->_list->set_reading(true);
+            async_list<plcrash_async_image_t *>::node *next = NULL;
+            while ((next = list->_list->next(next)) != NULL) {
+                if (next->value()->macho_image.header_addr == header) {
+                    image = next->value();
+                    break;
+                }
             }
+            list->_list->set_reading(false);
         }
 
         /* If not found, nothing to do */
-        if (found == NULL) {
+        if (image == NULL) {
             PLCF_DEBUG("Can't find header addr=%llu in Mach-O image list.", (uint64_t)header);
-            list->_list->set_reading(false);
+            PLCR_COMPAT_LOCK_UNLOCK(&list->_write_lock);
+            PLCR_COMPAT_LOCK_UNLOCK(&list->_load_lock);
             return;
         }
 
-        /* Delete the entry */
-        list->_list->nasync_remove_node(found);
-    } list->_list->set_reading(false);
+        /* Delete the entry, and drop it from the address range index */
+        list->_list->nasync_remove_node(image->_node);
+        plcrash_nasync_image_list_remove_range(list, image);
+
+        /* Retire the image; it will be freed once no readers may hold a reference to it. */
+        image->_retire_epoch = list->_list->nasync_retire_epoch();
+        image->_next_retired = list->_retired_images;
+        list->_retired_images = image;
+
+        plcrash_nasync_image_list_reclaim(list);
+    } PLCR_COMPAT_LOCK_UNLOCK(&list->_write_lock);
+    PLCR_COMPAT_LOCK_UNLOCK(&list->_load_lock);
+}
+
+/**
+ * Configure the optional lookup structures to be built for the images in @a list. The structures are built for every
+ * image currently in the list, as well as for all subsequently appended images, allowing crash-time lookups to avoid
+ * linear scans of the images' symbol and unwind tables.
+ *
+ * Clearing a flag does not discard lookup structures that have already been built.
+ *
+ * @param list The list to be configured.
+ * @param flags A bitwise OR of the plcrash_async_image_index_t lookup structures to be built.
+ *
+ * @warning This method is not async safe.
+ */
+void plcrash_nasync_image_list_set_indexing (plcrash_async_image_list_t *list, uint32_t flags) {
+    list->index_flags = flags;
+    if (flags == 0)
+        return;
+
+    /* Index any images that were registered prior to indexing being enabled */
+    plcrash_async_image_list_set_reading(list, true); {
+        plcrash_async_image_t *image = NULL;
+        while ((image = plcrash_async_image_list_next(list, image)) != NULL)
+            plcrash_nasync_image_build_indexes(image, flags);
+    } plcrash_async_image_list_set_reading(list, false);
+}
+
+/**
+ * Return the number of removed images that have not yet been freed, as they may still be referenced by
+ * readers of @a list. Removed images are freed by subsequent updates to the list once all readers that were
+ * active at the time of their removal have completed.
+ *
+ * @param list The list to be queried.
+ *
+ * @warning This method is not async safe.
+ */
+size_t plcrash_nasync_image_list_retired_count (plcrash_async_image_list_t *list) {
+    size_t count = 0;
+    PLCR_COMPAT_LOCK_LOCK(&list->_write_lock); {
+        plcrash_nasync_image_list_reclaim(list);
+        for (plcrash_async_image_t *image = list->_retired_images; image != NULL; image = image->_next_retired)
+            count++;
+    } PLCR_COMPAT_LOCK_UNLOCK(&list->_write_lock);
+    return count;
 }
 
 /**
@@ -171,6 +752,42 @@ void plcrash_async_image_list_set_reading (plcrash_async_image_list_t *list, boo
  * @warning The list must be retained for reading via plcrash_async_image_list_set_reading() before calling this function.
  */
 plcrash_async_image_t *plcrash_async_image_containing_address (plcrash_async_image_list_t *list, pl_vm_address_t address) {
+    /* Perform a binary search of the address range index, if available */
+    plcrash_async_image_range_index_t *index = list->_range_index;
+    if (index != NULL) {
+        /* Find the first range with a start address greater than address */
+        size_t low = 0;
+        size_t high = index->count;
+        while (low < high) {
+            size_t mid = low + ((high - low) / 2);
+            if (index->ranges[mid].start <= address) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+
+        /*
+         * Walk back over the ranges starting at or before address, stopping once no earlier range can extend past
+         * address. If multiple ranges contain address, prefer the image appended first, as iterating the list would.
+         */
+        const plcrash_async_image_range_t *range = NULL;
+        for (size_t i = low; i > 0 && index->ranges[i - 1].max_end > address; i--) {
+            const plcrash_async_image_range_t *candidate = &index->ranges[i - 1];
+            if (address >= candidate->end)
+                continue;
+
+            if (range == NULL || candidate->sequence < range->sequence)
+                range = candidate;
+        }
+
+        if (range == NULL)
+            return NULL;
+
+        return range->image;
+    }
+
+    /* Otherwise, fall back on iterating the list */
     plcrash_async_image_t *image = NULL;
     while ((image = plcrash_async_image_list_next(list, image)) != NULL) {
         if (plcrash_async_macho_contains_address(&image->macho_image, address))
@@ -204,7 +821,8 @@ plcrash_async_image_t *plcrash_async_image_list_next (plcrash_async_image_list_t
     if (node == NULL)
         return NULL;
     
-    /* Lazily swap in the cyclic node reference. This is pessimestic, but there's really not a better time to do it. */
+    /* The cyclic node reference is recorded by the writer once the image has been appended; a reader may observe the
+     * image before then, in which case we swap it in lazily. The value written is identical in either case. */
     plcrash_async_image_t *image = node->value();
     image->_node = node;
 
@@ -33,6 +33,7 @@
 #include <stdbool.h>
 
 #include "PLCrashAsyncMachOImage.h"
+#include "PLCrashCompatConstants.h"
 
 /*
  * NOTE: We keep this code C-compatible for backwards-compatibility purposes. If the entirity
@@ -49,6 +50,42 @@ extern "C" {
 
 typedef struct plcrash_async_image plcrash_async_image_t;
 
+/* Forward declarations; see PLCrashFrameDWARFUnwind.h and PLCrashFrameCompactUnwind.h */
+struct plframe_dwarf_unwind_context;
+struct plframe_compact_unwind_context;
+
+/**
+ * @internal
+ * @ingroup plcrash_async_image
+ *
+ * Optional per-image lookup structures that may be built as images are appended to a plcrash_async_image_list_t.
+ */
+typedef enum {
+    /** Build an address-sorted symbol index. See plcrash_nasync_macho_build_symbol_index(). */
+    PLCRASH_ASYNC_IMAGE_INDEX_SYMBOLS = 1 << 0,
+
+    /** Build a persistent DWARF unwind context. See plframe_nasync_dwarf_unwind_context_new(). */
+    PLCRASH_ASYNC_IMAGE_INDEX_DWARF_UNWIND = 1 << 1,
+
+    /** Build a persistent compact unwind context. See plframe_nasync_compact_unwind_context_new(). */
+    PLCRASH_ASYNC_IMAGE_INDEX_COMPACT_UNWIND = 1 << 2,
+} plcrash_async_image_index_t;
+
+/**
+ * @internal
+ * @ingroup plcrash_async_image
+ *
+ * Frame readers that may be recorded as unsupported for an image, allowing the frame walker to skip readers whose
+ * unwind data is known to be absent from the image.
+ */
+typedef enum {
+    /** The image has no __unwind_info section. */
+    PLCRASH_ASYNC_IMAGE_READER_COMPACT_UNWIND = 1 << 0,
+
+    /** The image has no __eh_frame or __debug_frame section. */
+    PLCRASH_ASYNC_IMAGE_READER_DWARF_UNWIND = 1 << 1,
+} plcrash_async_image_reader_t;
+
 /**
  * @internal
  * @ingroup plcrash_async_image
@@ -59,6 +96,22 @@ struct plcrash_async_image {
     /** The binary image. */
     plcrash_async_macho_t macho_image;
 
+    /** The image's persistent DWARF unwind context, or NULL if unavailable. This is published only once fully initialized. */
+    struct plframe_dwarf_unwind_context * volatile dwarf_unwind;
+
+    /** The image's persistent compact unwind context, or NULL if unavailable. This is published only once fully initialized. */
+    struct plframe_compact_unwind_context * volatile compact_unwind;
+
+    /** A bitwise OR of the plcrash_async_image_reader_t frame readers known to be unsupported by this image. Updated
+     * atomically by the frame readers; see plcrash_async_image_set_reader_unsupported(). */
+    volatile uint32_t unsupported_readers;
+
+    /** The next image awaiting reclamation once removed from the list, or NULL. Guarded by the list's write lock. */
+    struct plcrash_async_image *_next_retired;
+
+    /** The reader epoch at which the image was removed from the list. */
+    uint64_t _retire_epoch;
+
     /** A borrowed, circular reference to the backing list node. */
 #ifdef __cplusplus
     plcrash::async::async_list<plcrash_async_image_t *>::node * volatile _node;
@@ -67,6 +120,89 @@ struct plcrash_async_image {
 #endif
 };
 
+/**
+ * @internal
+ * @ingroup plcrash_async_image
+ *
+ * The __TEXT address range of a single binary image.
+ */
+typedef struct plcrash_async_image_range {
+    /** The first address of the image's __TEXT segment. */
+    pl_vm_address_t start;
+
+    /** The end of the image's __TEXT segment (exclusive). */
+    pl_vm_address_t end;
+
+    /** The greatest end address of this range and all ranges preceding it in the index, used to bound the search for overlapping ranges. */
+    pl_vm_address_t max_end;
+
+    /** The order in which the image was appended to the list; lower values were appended earlier. */
+    uint64_t sequence;
+
+    /** The image. */
+    plcrash_async_image_t *image;
+} plcrash_async_image_range_t;
+
+/**
+ * @internal
+ * @ingroup plcrash_async_image
+ *
+ * An immutable snapshot of the __TEXT address ranges of all images in a plcrash_async_image_list_t, sorted by
+ * start address. Snapshots are replaced, rather than modified, when the list is updated, allowing async-safe
+ * readers to perform lookups via binary search without locking.
+ *
+ * Ranges may overlap; lookups resolve an address covered by multiple ranges to the image appended to the list
+ * first, matching the result of iterating the list.
+ */
+typedef struct plcrash_async_image_range_index {
+    /** The image ranges, sorted by ascending start address. */
+    plcrash_async_image_range_t *ranges;
+
+    /** The number of entries in @a ranges. */
+    size_t count;
+
+    /** The next retired snapshot awaiting reclamation, or NULL. */
+    struct plcrash_async_image_range_index *_next_retired;
+
+    /** The reader epoch at which the snapshot was replaced. */
+    uint64_t _retire_epoch;
+} plcrash_async_image_range_index_t;
+
+/**
+ * @internal
+ * @ingroup plcrash_async_image
+ *
+ * The number of deferred image registrations for which space is preallocated by plcrash_nasync_image_list_init().
+ */
+#define PLCRASH_ASYNC_IMAGE_LIST_PENDING_CAPACITY 1024
+
+/**
+ * @internal
+ * @ingroup plcrash_async_image
+ *
+ * The initial capacity of a plcrash_async_image_list_t's header address table. The table is grown as required to
+ * maintain a load factor of no more than 50%.
+ */
+#define PLCRASH_ASYNC_IMAGE_LIST_TABLE_CAPACITY 256
+
+/**
+ * @internal
+ * @ingroup plcrash_async_image
+ *
+ * A binary image that has been registered with a plcrash_async_image_list_t, but whose Mach-O data has not
+ * yet been loaded. See plcrash_nasync_image_list_append_deferred().
+ */
+typedef struct plcrash_async_image_pending {
+    /** The image's header address. */
+    pl_vm_address_t header;
+
+    /** The image's vmaddr slide, as reported by dyld. */
+    intptr_t vmaddr_slide;
+
+    /** A borrowed reference to the image's name, or NULL if the name should be resolved when the image is loaded. */
+    const char *name;
+} plcrash_async_image_pending_t;
+
 /**
  * @internal
  * @ingroup plcrash_async_image
@@ -78,6 +214,49 @@ typedef struct plcrash_async_image_list {
     /** The Mach task in which all Mach-O images can be found */
     mach_port_t task;
 
+    /** The plcrash_async_image_index_t lookup structures to be built for each image as it is appended to the list. */
+    volatile uint32_t index_flags;
+
+    /** The lock held by writers while updating the backing list and its address range index. */
+    PLCR_COMPAT_LOCK_TYPE _write_lock;
+
+    /** The current address range index, or NULL if the index is unavailable and lookups must scan the list. */
+    plcrash_async_image_range_index_t * volatile _range_index;
+
+    /** Replaced address range indexes that may still be referenced by readers. */
+    plcrash_async_image_range_index_t *_retired_range_index;
+
+    /** The sequence number to be assigned to the next range inserted into the address range index. */
+    uint64_t _range_sequence;
+
+    /** The lock held while a deferred image is loaded, or any image is removed. Must be acquired prior to @a _write_lock. */
+    PLCR_COMPAT_LOCK_TYPE _load_lock;
+
+    /** Deferred image registrations that have not yet been loaded; entries in [_pending_head, _pending_count) are valid. Guarded by @a _write_lock. */
+    plcrash_async_image_pending_t *_pending;
+
+    /** The index of the first valid entry in @a _pending. */
+    size_t _pending_head;
+
+    /** The number of used entries in @a _pending, including loaded entries prior to @a _pending_head. */
+    size_t _pending_count;
+
+    /** The allocated capacity of @a _pending. */
+    size_t _pending_capacity;
+
+    /** An open-addressed hash table mapping image header addresses to images, used to remove images in constant time,
+     * or NULL if the table is unavailable and removal must scan the list. Guarded by @a _write_lock. */
+    plcrash_async_image_t **_header_table;
+
+    /** The number of slots in @a _header_table; always a power of two. */
+    size_t _header_table_capacity;
+
+    /** The number of images in @a _header_table. */
+    size_t _header_table_count;
+
+    /** Removed images that may still be referenced by readers. Guarded by @a _write_lock. */
+    plcrash_async_image_t *_retired_images;
+
     /** The backing list */
 #ifdef __cplusplus
     plcrash::async::async_list<plcrash_async_image_t *> *_list;
@@ -86,10 +265,42 @@ typedef struct plcrash_async_image_list {
 #endif
 } plcrash_async_image_list_t;
 
+/**
+ * @internal
+ * @ingroup plcrash_async_image
+ *
+ * Return true if @a reader has been recorded as unsupported for @a image. This function is async-safe.
+ *
+ * @param image The image to query.
+ * @param reader The plcrash_async_image_reader_t frame reader.
+ */
+static inline bool plcrash_async_image_reader_unsupported (plcrash_async_image_t *image, plcrash_async_image_reader_t reader) {
+    return (image->unsupported_readers & reader) != 0;
+}
+
+/**
+ * @internal
+ * @ingroup plcrash_async_image
+ *
+ * Record @a reader as unsupported for @a image; subsequent frame reads within @a image will skip the reader. This
+ * function is async-safe.
+ *
+ * @param image The image to update.
+ * @param reader The plcrash_async_image_reader_t frame reader.
+ */
+static inline void plcrash_async_image_set_reader_unsupported (plcrash_async_image_t *image, plcrash_async_image_reader_t reader) {
+    __atomic_fetch_or(&image->unsupported_readers, (uint32_t) reader, __ATOMIC_RELAXED);
+}
+
 void plcrash_nasync_image_list_init (plcrash_async_image_list_t *list, mach_port_t task);
 void plcrash_nasync_image_list_free (plcrash_async_image_list_t *list);
 void plcrash_nasync_image_list_append (plcrash_async_image_list_t *list, pl_vm_address_t header, const char *name);
+void plcrash_nasync_image_list_append_deferred (plcrash_async_image_list_t *list, pl_vm_address_t header, intptr_t vmaddr_slide, const char *name);
+size_t plcrash_nasync_image_list_load_deferred (plcrash_async_image_list_t *list);
+size_t plcrash_nasync_image_list_deferred_count (plcrash_async_image_list_t *list);
 void plcrash_nasync_image_list_remove (plcrash_async_image_list_t *list, pl_vm_address_t header);
+void plcrash_nasync_image_list_set_indexing (plcrash_async_image_list_t *list, uint32_t flags);
+size_t plcrash_nasync_image_list_retired_count (plcrash_async_image_list_t *list);
 
 void plcrash_async_image_list_set_reading (plcrash_async_image_list_t *list, bool enable);
 
@@ -33,12 +33,20 @@
 #include "PLCrashMacros.h"
 #include "PLCrashCompatConstants.h"
 #include <atomic>
+#include <new>
 
 PLCR_CPP_BEGIN_NS
 
 namespace async {
-    
-    
+
+/**
+ * @internal
+ * @ingroup plcrash_async
+ *
+ * The number of nodes allocated by the first storage chunk of an async_list. Each subsequent chunk doubles in size.
+ */
+#define PLCRASH_ASYNC_LIST_CHUNK_NODES 32
+
 /**
  * @internal
  * @ingroup plcrash_async
@@ -52,6 +60,12 @@ namespace async {
  * write mutex is held for all updates; the implementation is not designed for efficiency in the face of contention
  * between readers and writers, and it's assumed that no contention should realistically occur.
  *
+ * Nodes are allocated from contiguous storage chunks that are retained for the lifetime of the list; removed nodes
+ * are retired, and returned to the free list once all readers that may hold a reference to them have completed.
+ * Readers are tracked with a combined reader count and epoch, which is advanced each time the last active reader
+ * completes; this allows writers to determine when retired values are no longer reachable without requiring the list
+ * to be entirely idle. See nasync_retire_epoch() and nasync_epoch_quiesced().
+ *
  * @tparam V The list element type. 
  */
 template <typename V>
@@ -64,16 +78,6 @@ public:
     public:
         friend class async_list<V>;
         
-        // Custom new/delete that do not rely on the stdlib
-        void *operator new (size_t size) {
-            void *ptr = malloc(size);
-            PLCF_ASSERT(ptr != NULL);
-            return ptr;
-        }
-        void operator delete (void *ptr) {
-            free(ptr);
-        }
-        
         /**
          * Return the list item value.
          */
@@ -83,17 +87,6 @@ public:
 
     private:
         
-        /**
-         * Construct a new node with @a value.
-         *
-         * @param value The value for this node.
-         */
-        node (V value) {
-            _value = value;
-            _prev = NULL;
-            _next = NULL;
-        }
-        
         /**
          * Reset a node for re-use.
          *
@@ -103,6 +96,9 @@ public:
             _value = value;
             _prev = NULL;
             _next = NULL;
+            _linked = false;
+            _reclaim_next = NULL;
+            _retire_epoch = 0;
         }
     
         /** The list entry value. */
@@ -113,17 +109,37 @@ public:
         
         /** The next image in the list, or NULL. */
         std::atomic<node *> _next;
+
+        /** True if the node is currently reachable from the list head. Guarded by the write lock. */
+        bool _linked;
+
+        /** The next node in the retired or free list. Guarded by the write lock, and never accessed by readers. */
+        node *_reclaim_next;
+
+        /** The reader epoch at which this node was retired; see nasync_retire_epoch(). */
+        uint64_t _retire_epoch;
     };
 
     async_list (void);
     ~async_list (void);
     
-    void nasync_prepend (V value);
-    void nasync_append (V value);
+    node *nasync_prepend (V value);
+    node *nasync_append (V value);
     void nasync_remove_first_value (V value);
     void nasync_remove_node (node *deleted_node);
     void set_reading (bool enable);
     node *next (node *current);
+
+    uint64_t nasync_retire_epoch (void);
+    bool nasync_epoch_quiesced (uint64_t epoch);
+
+    /**
+     * Return true if the list is currently retained for reading. Once a value has been made unreachable by
+     * readers, a false result guarantees that no reader still holds a reference to it.
+     */
+    bool nasync_has_readers (void) {
+        return (_readers & READER_COUNT_MASK) > 0;
+    }
     
     // Custom new/delete that do not rely on the stdlib
     void *operator new (size_t size) {
@@ -145,14 +161,57 @@ public:
         node *prev = NULL;
         for (node *cur = _head; cur != NULL; cur = cur->_next) {
             PLCF_ASSERT(cur->_prev == prev);
+            PLCF_ASSERT(cur->_linked);
             prev = cur;
         }
         
         PLCF_ASSERT(prev == _tail);
+
+        /* Retired and free nodes must not be reachable */
+        for (node *cur = _retired; cur != NULL; cur = cur->_reclaim_next)
+            PLCF_ASSERT(!cur->_linked);
+
+        for (node *cur = _free; cur != NULL; cur = cur->_reclaim_next)
+            PLCF_ASSERT(!cur->_linked);
+    }
+
+    /**
+     * Return the number of retired nodes that have not yet been returned to the free list. Intended to be used from
+     * the unit tests.
+     */
+    size_t nasync_retired_count (void) {
+        size_t count = 0;
+        PLCR_COMPAT_LOCK_LOCK(&_write_lock); {
+            for (node *cur = _retired; cur != NULL; cur = cur->_reclaim_next)
+                count++;
+        } PLCR_COMPAT_LOCK_UNLOCK(&_write_lock);
+        return count;
     }
 
 private:
-    void free_list (node *next);
+    /** The bits of _readers that contain the active reader count. */
+    static const uint64_t READER_COUNT_MASK = UINT32_MAX;
+
+    /** The value added to _readers to advance the reader epoch. */
+    static const uint64_t READER_EPOCH_ONE = ((uint64_t) 1) << 32;
+
+    /**
+     * A chunk of node storage.
+     */
+    struct chunk {
+        /** The next allocated chunk, or NULL. */
+        chunk *next;
+
+        /** The number of nodes in this chunk. */
+        size_t capacity;
+
+        /** The number of nodes in this chunk that have been handed out. */
+        size_t used;
+    };
+
+    node *alloc_node (V value);
+    void link_node (node *new_node, bool prepend);
+    void reclaim_retired (void);
 
     /** The lock used by writers. No lock is required for readers. */
     PLCR_COMPAT_LOCK_TYPE _write_lock;
@@ -163,91 +222,157 @@ private:
     /** The tail of the list, or NULL if the list is empty. Must only be used to append new entries. */
     node *_tail;
     
-    /** The list reference count. No nodes will be deallocated while the count is greater than 0. If the count
-     * reaches 0, all nodes in the free list will be deallocated. */
-    std::atomic_int32_t _refcount;
+    /** The active reader count (low 32 bits) and reader epoch (high 32 bits). The epoch is advanced atomically with
+     * the release of the last active reader. */
+    std::atomic<uint64_t> _readers;
     
-    /** The node free list. */
+    /** Removed nodes that may still be referenced by readers. */
+    node *_retired;
+
+    /** Reclaimed nodes available for re-use. */
     node *_free;
+
+    /** The most recently allocated storage chunk, or NULL. */
+    chunk *_chunks;
 };
 
 /** Construct a new, empty linked list */
 template <typename V> async_list<V>::async_list (void) {
     _head = NULL;
     _tail = NULL;
+    _retired = NULL;
     _free = NULL;
-    _refcount = 0;
+    _chunks = NULL;
+    _readers = 0;
     _write_lock = PLCR_COMPAT_LOCK_INIT;
 }
     
 template <typename V> async_list<V>::~async_list (void) {
-    /* Free all nodes */
-    if (_head != NULL)
-        free_list(_head);
-    
-    if (_free != NULL)
-        free_list(_free);
+    /* All nodes are owned by the storage chunks */
+    while (_chunks != NULL) {
+        chunk *next = _chunks->next;
+        free(_chunks);
+        _chunks = next;
+    }
 }
 
 /**
- * Prepend a new entry value to the list
+ * @internal
  *
- * @param value The value to be prepended.
+ * Fetch a node from the free list, or allocate a new node from the current storage chunk, allocating a new
+ * chunk if necessary. The caller must hold the write lock.
  *
- * @warning This method is not async safe.
+ * @param value The value for the new node.
  */
-template <typename V> void async_list<V>::nasync_prepend (V value) {
-    /* Lock the list from other writers. */
-    PLCR_COMPAT_LOCK_LOCK(&_write_lock); {
-        /* Construct the new entry, or recycle an existing one. */
-        node *new_node;
-        if (_free != NULL) {
-            /* Fetch a node from the free list */
-            new_node = _free;
-            new_node->reset(value);
-            
-            /* Update the free list */
-            _free = _free->_next;
-        } else {
-            new_node = new node(value);
+template <typename V> typename async_list<V>::node *async_list<V>::alloc_node (V value) {
+    node *new_node;
+
+    /* Recycle any nodes that are no longer referenced by readers */
+    if (_free == NULL)
+        reclaim_retired();
+
+    if (_free != NULL) {
+        new_node = _free;
+        _free = _free->_reclaim_next;
+    } else {
+        if (_chunks == NULL || _chunks->used == _chunks->capacity) {
+            size_t capacity = (_chunks != NULL) ? _chunks->capacity * 2 : PLCRASH_ASYNC_LIST_CHUNK_NODES;
+            chunk *c = (chunk *) malloc(sizeof(chunk) + (sizeof(node) * capacity));
+            PLCF_ASSERT(c != NULL);
+
+            c->next = _chunks;
+            c->capacity = capacity;
+            c->used = 0;
+            _chunks = c;
         }
+
+        new_node = new (((node *) (_chunks + 1)) + _chunks->used++) node();
+    }
+
+    new_node->reset(value);
+    return new_node;
+}
+
+/**
+ * @internal
+ *
+ * Link @a new_node into the list. The caller must hold the write lock.
+ *
+ * @param new_node The node to be linked.
+ * @param prepend If true, the node will be prepended; otherwise, appended.
+ */
+template <typename V> void async_list<V>::link_node (node *new_node, bool prepend) {
+    /* Issue a memory barrier to ensure a consistent view of the value. */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    new_node->_linked = true;
+
+    /* If this is the first entry, initialize the list. */
+    if (_tail == NULL) {
         
-        /* Issue a memory barrier to ensure a consistent view of the value. */
-        std::atomic_thread_fence(std::memory_order_seq_cst);
+        /* Update the list tail. This need not be done atomically, as tail is never accessed by a lockless reader. */
+        _tail = new_node;
         
-        /* If this is the first entry, initialize the list. */
-        if (_tail == NULL) {
-            
-            /* Update the list tail. This need not be done atomically, as tail is never accessed by a lockless reader. */
-            _tail = new_node;
-            
-            /* Atomically update the list head; this will be iterated upon by lockless readers. */
-            node *expected = NULL;
-            if (!_head.compare_exchange_strong(expected, new_node)) {
-                /* Should never occur */
-                PLCF_DEBUG("An async image head was set with tail == NULL despite holding lock.");
-            }
+        /* Atomically update the list head; this will be iterated upon by lockless readers. */
+        node *expected = NULL;
+        if (!_head.compare_exchange_strong(expected, new_node)) {
+            /* Should never occur */
+            PLCF_DEBUG("An async image head was set with tail == NULL despite holding lock.");
         }
+    }
+
+    /* Prepend to the head of the list */
+    else if (prepend) {
+        new_node->_next = (node *)_head;
+        new_node->_prev = NULL;
         
-        /* Otherwise, prepend to the head of the list */
-        else {
-            new_node->_next = (node *)_head;
-            new_node->_prev = NULL;
-            
-            /* Update the prev pointers. This is never accessed without a lock, so no additional synchronization
-             * is required here. */
-            ((node *)_head)->_prev = new_node;
-
-            /* Issue a memory barrier to ensure a consistent view of the nodes. */
-            std::atomic_thread_fence(std::memory_order_seq_cst);
-
-            /* Atomically slot the new record into place; this may be iterated on by a lockless reader. */
-            node *expected = new_node->_next;
-            if (!_head.compare_exchange_strong(expected, new_node)) {
-                PLCF_DEBUG("Failed to prepend to image list despite holding lock");
-            }
+        /* Update the prev pointers. This is never accessed without a lock, so no additional synchronization
+         * is required here. */
+        ((node *)_head)->_prev = new_node;
+
+        /* Issue a memory barrier to ensure a consistent view of the nodes. */
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        /* Atomically slot the new record into place; this may be iterated on by a lockless reader. */
+        node *expected = new_node->_next;
+        if (!_head.compare_exchange_strong(expected, new_node)) {
+            PLCF_DEBUG("Failed to prepend to image list despite holding lock");
         }
+    }
+    
+    /* Otherwise, append to the end of the list */
+    else {
+        /* Atomically slot the new record into place; this may be iterated on by a lockless reader. */
+        node *expected = NULL;
+        if (!_tail->_next.compare_exchange_strong(expected, new_node)) {
+            PLCF_DEBUG("Failed to append to image list despite holding lock");
+        }
+        
+        /* Update the prev and tail pointers. This is never accessed without a lock, so no additional barrier
+         * is required here. */
+        new_node->_prev = _tail;
+        _tail = new_node;
+    }
+}
+
+/**
+ * Prepend a new entry value to the list
+ *
+ * @param value The value to be prepended.
+ *
+ * @return Returns the new node, which may be supplied to nasync_remove_node().
+ *
+ * @warning This method is not async safe.
+ */
+template <typename V> typename async_list<V>::node *async_list<V>::nasync_prepend (V value) {
+    node *new_node;
+
+    /* Lock the list from other writers. */
+    PLCR_COMPAT_LOCK_LOCK(&_write_lock); {
+        new_node = alloc_node(value);
+        link_node(new_node, true);
     } PLCR_COMPAT_LOCK_UNLOCK(&_write_lock);
+
+    return new_node;
 }
 
 
@@ -256,56 +381,20 @@ template <typename V> void async_list<V>::nasync_prepend (V value) {
  *
  * @param value The value to be appended.
  *
+ * @return Returns the new node, which may be supplied to nasync_remove_node().
+ *
  * @warning This method is not async safe.
  */
-template <typename V> void async_list<V>::nasync_append (V value) {
-    
+template <typename V> typename async_list<V>::node *async_list<V>::nasync_append (V value) {
+    node *new_node;
+
     /* Lock the list from other writers. */
     PLCR_COMPAT_LOCK_LOCK(&_write_lock); {
-        /* Construct the new entry, or recycle an existing one. */
-        node *new_node;
-        if (_free != NULL) {
-            /* Fetch a node from the free list */
-            new_node = _free;
-            new_node->reset(value);
-            
-            /* Update the free list */
-            _free = _free->_next;
-        } else {
-            new_node = new node(value);
-        }
-        
-        /* Issue a memory barrier to ensure a consistent view of the value. */
-        std::atomic_thread_fence(std::memory_order_seq_cst);
-        
-        /* If this is the first entry, initialize the list. */
-        if (_tail == NULL) {
-            
-            /* Update the list tail. This need not be done atomically, as tail is never accessed by a lockless reader. */
-            _tail = new_node;
-            
-            /* Atomically update the list head; this will be iterated upon by lockless readers. */
-            node *expected = NULL;
-            if (!_head.compare_exchange_strong(expected, new_node)) {
-                /* Should never occur */
-                PLCF_DEBUG("An async image head was set with tail == NULL despite holding lock.");
-            }
-        }
-        
-        /* Otherwise, append to the end of the list */
-        else {
-            /* Atomically slot the new record into place; this may be iterated on by a lockless reader. */
-            node *expected = NULL;
-            if (!_tail->_next.compare_exchange_strong(expected, new_node)) {
-                PLCF_DEBUG("Failed to append to image list despite holding lock");
-            }
-            
-            /* Update the prev and tail pointers. This is never accessed without a lock, so no additional barrier
-             * is required here. */
-            new_node->_prev = _tail;
-            _tail = new_node;
-        }
+        new_node = alloc_node(value);
+        link_node(new_node, false);
     } PLCR_COMPAT_LOCK_UNLOCK(&_write_lock);
+
+    return new_node;
 }
 
 /**
@@ -329,26 +418,23 @@ template <typename V> void async_list<V>::nasync_remove_first_value (V value) {
 }
 
 /**
- * Remove a specific entry node from the list.
+ * Remove a specific entry node from the list. This is a constant-time operation.
  *
- * @param deleted_node The node to be removed.
+ * The node will not be re-used until all readers that may hold a reference to it have completed; a reader positioned
+ * at the node may continue iterating from it.
+ *
+ * @param deleted_node The node to be removed. If the node is not currently in the list, the request will be ignored.
  *
  * @warning This method is not async safe.
  */
 template <typename V> void async_list<V>::nasync_remove_node (node *deleted_node) {
     /* Lock the list from other writers. */
     PLCR_COMPAT_LOCK_LOCK(&_write_lock); {
-        /* Find the record. */
-        node *item = _head;
-        while (item != NULL) {
-            if (item == deleted_node)
-                break;
-            
-            item = item->_next;
-        }
-        
-        /* If not found, nothing to do */
-        if (item == NULL) {
+        node *item = deleted_node;
+
+        /* If not found, nothing to do. Node storage is never freed prior to destruction of the list, so
+         * this may be safely checked for a previously removed node. */
+        if (!item->_linked) {
             PLCR_COMPAT_LOCK_UNLOCK(&_write_lock);
             return;
         }
@@ -370,7 +456,7 @@ template <typename V> void async_list<V>::nasync_remove_node (node *deleted_node
         }
         
         /* Now that the item is unreachable, update the prev/tail pointers. These are never accessed without a lock,
-         * and need not be updated atomically. */
+         * and need not be updated atomically. The item's next pointer is left intact for any reader positioned at it. */
         if (item->_next != NULL) {
             /* Item is not the tail (otherwise next would be NULL), so simply update the next item's prev pointer. */
             ((node *)item->_next)->_prev = item->_prev;
@@ -378,23 +464,72 @@ template <typename V> void async_list<V>::nasync_remove_node (node *deleted_node
             /* Item is the tail (next is NULL). Simply update the tail record. */
             _tail = item->_prev;
         }
-        
-        /* If a reader is active, place the node on the free list. The item is unreachable here when readers
-         * aren't active, so if we have a 0 refcount, we can safely delete the item, and be sure that no
-         * reader holds a reference to it. */
-        if (_refcount > 0) {
-            item->_prev = NULL;
-            item->_next = _free;
-            
-            if (_free != NULL)
-                _free->_prev = item;
-            _free = item;
-        } else {
-            delete item;
-        }
+
+        /* Retire the node; it will be re-used once no reader may hold a reference to it. */
+        item->_linked = false;
+        item->_prev = NULL;
+        item->_retire_epoch = nasync_retire_epoch();
+        item->_reclaim_next = _retired;
+        _retired = item;
+
+        reclaim_retired();
     } PLCR_COMPAT_LOCK_UNLOCK(&_write_lock);
 }
 
+/**
+ * @internal
+ *
+ * Move all retired nodes that are no longer referenced by readers to the free list. The caller must hold the write lock.
+ */
+template <typename V> void async_list<V>::reclaim_retired (void) {
+    node **prevp = &_retired;
+    while (*prevp != NULL) {
+        node *item = *prevp;
+        if (!nasync_epoch_quiesced(item->_retire_epoch)) {
+            prevp = &item->_reclaim_next;
+            continue;
+        }
+
+        *prevp = item->_reclaim_next;
+        item->_reclaim_next = _free;
+        _free = item;
+    }
+}
+
+/**
+ * Return a token identifying the current reader epoch. This should be called after a value has been made
+ * unreachable by readers, and the result later supplied to nasync_epoch_quiesced() to determine whether
+ * the value may be reclaimed.
+ *
+ * This method is async-safe.
+ */
+template <typename V> uint64_t async_list<V>::nasync_retire_epoch (void) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return _readers;
+}
+
+/**
+ * Return true if all readers that were active when @a epoch was fetched via nasync_retire_epoch() have
+ * completed. Once true, a value made unreachable prior to fetching @a epoch is no longer referenced by
+ * any reader.
+ *
+ * This method is async-safe.
+ *
+ * @param epoch A token previously returned by nasync_retire_epoch().
+ */
+template <typename V> bool async_list<V>::nasync_epoch_quiesced (uint64_t epoch) {
+    /* No readers were active at retirement */
+    if ((epoch & READER_COUNT_MASK) == 0)
+        return true;
+
+    /* All readers have since completed, advancing the epoch. */
+    uint64_t current = _readers;
+    if ((current & READER_COUNT_MASK) == 0)
+        return true;
+
+    return (current & ~READER_COUNT_MASK) != (epoch & ~READER_COUNT_MASK);
+}
+
 /**
  * Retain or release the list for reading. This method is async-safe.
  *
@@ -405,10 +540,18 @@ template <typename V> void async_list<V>::nasync_remove_node (node *deleted_node
 template <typename V> void async_list<V>::set_reading (bool enable) {
     if (enable) {
         /* Increment and issue a barrier. Once issued, no items will be deallocated while a reference is held. */
-        _refcount++;
+        _readers++;
     } else {
-        /* Increment and issue a barrier. Once issued, items may again be deallocated. */
-        _refcount--;
+        /* Decrement and issue a barrier. If this is the last active reader, the epoch is advanced atomically with the
+         * decrement; once issued, retired items may again be deallocated. */
+        uint64_t state = _readers;
+        uint64_t next;
+        do {
+            PLCF_ASSERT((state & READER_COUNT_MASK) > 0);
+            next = state - 1;
+            if ((next & READER_COUNT_MASK) == 0)
+                next += READER_EPOCH_ONE;
+        } while (!_readers.compare_exchange_weak(state, next));
     }
 }
 
@@ -420,7 +563,7 @@ template <typename V> void async_list<V>::set_reading (bool enable) {
  * @param current The current list node, or NULL to start iteration.
  */
 template <typename V> typename async_list<V>::node *async_list<V>::next (node *current) {
-    PLCF_ASSERT(_refcount > 0);
+    PLCF_ASSERT(nasync_has_readers());
     
     if (current != NULL)
         return current->_next;
@@ -428,27 +571,6 @@ template <typename V> typename async_list<V>::node *async_list<V>::next (node *c
     return _head;
 }
 
-/*
- * @internal
- *
- * Free all items in @a next list.
- *
- * @param next The head of the list to deallocate.
- *
- * @warning This method is not async-safe, and must only be called with the write lock held, or
- * from the deconstructor.
- */
-template <typename V> void async_list<V>::free_list (node *next) {
-    while (next != NULL) {
-        /* Save the current pointer and fetch the next pointer. */
-        node *cur = next;
-        next = cur->_next;
-        
-        /* Deallocate the current item. */
-        delete cur;
-    }
-}
-
 PLCR_CPP_END_NS
 }
 
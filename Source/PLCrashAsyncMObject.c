@@ -254,14 +254,40 @@ static plcrash_error_t plcrash_async_mobject_remap_pages_workaround (mach_port_t
  *
  * @return On success, returns PLCRASH_ESUCCESS. On failure, one of the plcrash_error_t error values will be returned, and no
  * mapping will be performed.
+ *
+ * @note If a plcrash_async_mapping_cache_t has been bound to the calling thread, the object may share an existing
+ * mapping from the cache, and any new mapping will be added to the cache. The object must be freed prior to freeing
+ * the cache.
  */
 plcrash_error_t plcrash_async_mobject_init (plcrash_async_mobject_t *mobj, mach_port_t task, pl_vm_address_t task_addr, pl_vm_size_t length, bool require_full) {
     plcrash_error_t err;
 
-    /* Perform the page mapping */
-    err = plcrash_async_mobject_remap_pages_workaround(task, task_addr, length, require_full, &mobj->vm_address, &mobj->vm_length);
-    if (err != PLCRASH_ESUCCESS)
-        return err;
+    /* Try to share an existing mapping from the calling thread's mapping cache, if any. */
+    plcrash_async_mapping_cache_t *cache = plcrash_async_mapping_cache_bound();
+    pl_vm_address_t base_addr = mach_vm_trunc_page(task_addr);
+    pl_vm_size_t total_size = mach_vm_round_page(length + (task_addr - base_addr));
+
+    mobj->cache_entry = NULL;
+    if (cache != NULL)
+        mobj->cache_entry = plcrash_async_mapping_cache_acquire(cache, task, base_addr, total_size, require_full);
+
+    if (mobj->cache_entry != NULL) {
+        /* Provide a view of the requested pages within the cached mapping */
+        pl_vm_size_t entry_offset = base_addr - mobj->cache_entry->task_address;
+        mobj->vm_address = mobj->cache_entry->vm_address + entry_offset;
+        mobj->vm_length = mobj->cache_entry->vm_length - entry_offset;
+        if (mobj->vm_length > total_size)
+            mobj->vm_length = total_size;
+    } else {
+        /* Perform the page mapping */
+        err = plcrash_async_mobject_remap_pages_workaround(task, task_addr, length, require_full, &mobj->vm_address, &mobj->vm_length);
+        if (err != PLCRASH_ESUCCESS)
+            return err;
+
+        /* Hand ownership of the new mapping to the cache; if the cache is full, we retain ownership. */
+        if (cache != NULL)
+            mobj->cache_entry = plcrash_async_mapping_cache_insert(cache, task, base_addr, total_size, mobj->vm_address, mobj->vm_length);
+    }
 
     /* Determine the offset and length of the actual data */
     mobj->address = mobj->vm_address + (task_addr - mach_vm_trunc_page(task_addr));
@@ -470,6 +496,14 @@ plcrash_error_t plcrash_async_mobject_read_uint64 (plcrash_async_mobject_t *mobj
  */
 void plcrash_async_mobject_free (plcrash_async_mobject_t *mobj) {
     kern_return_t kt;
+
+    /* Shared mappings are owned by the mapping cache */
+    if (mobj->cache_entry != NULL) {
+        plcrash_async_mapping_cache_release(mobj->cache_entry);
+        mobj->cache_entry = NULL;
+        mach_port_mod_refs(mach_task_self(), mobj->task, MACH_PORT_RIGHT_SEND, -1);
+        return;
+    }
     
 #ifdef PL_HAVE_MACH_VM
     kt = mach_vm_deallocate(mach_task_self(), mobj->vm_address, mobj->vm_length);
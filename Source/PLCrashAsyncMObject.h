@@ -35,6 +35,7 @@ extern "C" {
 
 #include <stdint.h>
 #include "PLCrashAsync.h"
+#include "PLCrashAsyncMappingCache.h"
 
 /**
  * @ingroup plcrash_async
@@ -67,6 +68,9 @@ typedef struct plcrash_async_mobject {
     
     /** The actual mapping size. This may differ from the user-requested size, as the base address has been page-aligned */
     pl_vm_size_t vm_length;
+
+    /** The shared mapping backing this object, or NULL if the object owns its mapping. See plcrash_async_mapping_cache_t. */
+    plcrash_async_mapping_cache_entry_t *cache_entry;
 } plcrash_async_mobject_t;
 
 plcrash_error_t plcrash_async_mobject_init (plcrash_async_mobject_t *mobj, mach_port_t task, pl_vm_address_t task_addr, pl_vm_size_t length, bool require_full);
@@ -32,6 +32,7 @@
 #include <string.h>
 #include <inttypes.h>
 #include <assert.h>
+#include <stdatomic.h>
 
 #include <mach-o/fat.h>
 
@@ -51,6 +52,8 @@
  * @{
  */
 
+static void plcrash_nasync_macho_build_summary (plcrash_async_macho_t *image);
+
 /**
  * Initialize a new Mach-O binary image parser.
  *
@@ -70,6 +73,8 @@ plcrash_error_t plcrash_nasync_macho_init (plcrash_async_macho_t *image, mach_po
     bool mobj_initialized = false;
     bool task_initialized = false;
     image->name = NULL;
+    image->symbol_index = NULL;
+    image->summary.valid = false;
 
     /* Basic initialization */
     image->task = task;
@@ -196,6 +201,9 @@ plcrash_error_t plcrash_nasync_macho_init (plcrash_async_macho_t *image, mach_po
         image->vmaddr_slide = 0;
     }
 
+    /* Summarize the load commands; this relies on the vmaddr slide computed above. */
+    plcrash_nasync_macho_build_summary(image);
+
     return PLCRASH_ESUCCESS;
     
 error:
@@ -373,6 +381,22 @@ void *plcrash_async_macho_next_command_type (plcrash_async_macho_t *image, void
     return NULL;
 }
 
+/**
+ * @internal
+ *
+ * Return the load command at @a offset within @a image's mapped load commands, or NULL if @a offset is
+ * PLCRASH_ASYNC_MACHO_SUMMARY_NONE.
+ *
+ * @param image The image containing the load command.
+ * @param offset A load command offset recorded in the image's summary.
+ */
+static void *plcrash_async_macho_summary_command (plcrash_async_macho_t *image, uint32_t offset) {
+    if (offset == PLCRASH_ASYNC_MACHO_SUMMARY_NONE)
+        return NULL;
+
+    return (void *) (image->load_cmds.address + offset);
+}
+
 /**
  * Find the first LC_CMD matching the given @a cmd type.
  *
@@ -388,6 +412,20 @@ void *plcrash_async_macho_next_command_type (plcrash_async_macho_t *image, void
 void *plcrash_async_macho_find_command (plcrash_async_macho_t *image, uint32_t expectedCommand) {
     struct load_command *cmd = NULL;
 
+    /* Use the summary for the commands it records */
+    if (image->summary.valid) {
+        switch (expectedCommand) {
+            case LC_UUID:
+                return plcrash_async_macho_summary_command(image, image->summary.uuid_offset);
+            case LC_SYMTAB:
+                return plcrash_async_macho_summary_command(image, image->summary.symtab_offset);
+            case LC_DYSYMTAB:
+                return plcrash_async_macho_summary_command(image, image->summary.dysymtab_offset);
+            default:
+                break;
+        }
+    }
+
     /* Iterate commands until we either find a match, or reach the end */
     while ((cmd = plcrash_async_macho_next_command(image, cmd)) != NULL) {
         /* Read the load command type */
@@ -417,6 +455,17 @@ void *plcrash_async_macho_find_command (plcrash_async_macho_t *image, uint32_t e
 void *plcrash_async_macho_find_segment_cmd (plcrash_async_macho_t *image, const char *segname) {
     void *seg = NULL;
 
+    /* If summarized, the summary's segment table is authoritative */
+    if (image->summary.valid) {
+        for (uint32_t i = 0; i < image->summary.segment_count; i++) {
+            const plcrash_async_macho_summary_segment_t *entry = &image->summary.segments[i];
+            if (plcrash_async_strncmp(segname, entry->segname, sizeof(entry->segname)) == 0)
+                return plcrash_async_macho_summary_command(image, entry->cmd_offset);
+        }
+
+        return NULL;
+    }
+
     while ((seg = plcrash_async_macho_next_command_type(image, seg, image->m64 ? LC_SEGMENT_64 : LC_SEGMENT)) != 0) {
 
         /* Read the load command */
@@ -523,6 +572,141 @@ static bool plcrash_async_macho_read_section (plcrash_async_macho_t *image, uint
     return true;
 }
 
+/**
+ * @internal
+ *
+ * Segment and section names of the well-known sections recorded in plcrash_async_macho_summary_t, indexed by
+ * plcrash_async_macho_section_id_t.
+ */
+static const struct {
+    const char *segname;
+    const char *sectname;
+} plcrash_async_macho_section_names[PLCRASH_ASYNC_MACHO_SECTION_COUNT] = {
+    [PLCRASH_ASYNC_MACHO_SECTION_UNWIND_INFO]                   = { "__TEXT",       "__unwind_info" },
+    [PLCRASH_ASYNC_MACHO_SECTION_EH_FRAME]                      = { "__TEXT",       "__eh_frame" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DEBUG_FRAME]                   = { "__DWARF",      "__debug_frame" },
+    [PLCRASH_ASYNC_MACHO_SECTION_OBJC_METHLIST]                 = { "__TEXT",       "__objc_methlist" },
+    [PLCRASH_ASYNC_MACHO_SECTION_OBJC_MODULE_INFO]              = { "__OBJC",       "__module_info" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_CONST]               = { "__DATA",       "__objc_const" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_CONST_AX]            = { "__DATA",       "__objc_const_ax" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_SELREFS]             = { "__DATA",       "__objc_selrefs" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_CLASSLIST]           = { "__DATA",       "__objc_classlist" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_CATLIST]             = { "__DATA",       "__objc_catlist" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_DATA]                = { "__DATA",       "__objc_data" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_DATA]                     = { "__DATA",       "__data" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_CONST_OBJC_CONST]         = { "__DATA_CONST", "__objc_const" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_CONST_OBJC_CLASSLIST]     = { "__DATA_CONST", "__objc_classlist" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_CONST_OBJC_CATLIST]       = { "__DATA_CONST", "__objc_catlist" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_DIRTY_OBJC_CONST]         = { "__DATA_DIRTY", "__objc_const" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_DIRTY_OBJC_CLASSLIST]     = { "__DATA_DIRTY", "__objc_classlist" },
+    [PLCRASH_ASYNC_MACHO_SECTION_DATA_DIRTY_OBJC_CATLIST]       = { "__DATA_DIRTY", "__objc_catlist" },
+};
+
+/**
+ * @internal
+ *
+ * Return true if the well-known section @a section_id is named @a sectname within @a segname. Either name may
+ * be a non-NUL-terminated Mach-O name field.
+ */
+static bool plcrash_async_macho_section_id_matches (plcrash_async_macho_section_id_t section_id, const char *segname, const char *sectname) {
+    if (plcrash_async_strncmp(plcrash_async_macho_section_names[section_id].segname, segname, fldsiz(section_64, segname)) != 0)
+        return false;
+
+    return plcrash_async_strncmp(plcrash_async_macho_section_names[section_id].sectname, sectname, fldsiz(section_64, sectname)) == 0;
+}
+
+/**
+ * @internal
+ *
+ * Populate @a image's load command summary in a single pass over its load commands. If the summary can not be
+ * fully populated, it is left marked as invalid, and all accessors will fall back to walking the load commands.
+ *
+ * @param image An image with mapped load commands and a computed vmaddr slide.
+ *
+ * @warning This method is not async safe.
+ */
+static void plcrash_nasync_macho_build_summary (plcrash_async_macho_t *image) {
+    plcrash_async_macho_summary_t *summary = &image->summary;
+    uint32_t segment_type = image->m64 ? LC_SEGMENT_64 : LC_SEGMENT;
+    struct load_command *cmd = NULL;
+
+    memset(summary, 0, sizeof(*summary));
+    summary->valid = false;
+    summary->uuid_offset = PLCRASH_ASYNC_MACHO_SUMMARY_NONE;
+    summary->symtab_offset = PLCRASH_ASYNC_MACHO_SUMMARY_NONE;
+    summary->dysymtab_offset = PLCRASH_ASYNC_MACHO_SUMMARY_NONE;
+
+    /* The iterator verifies each returned command; commands it can not reach are equally unreachable by a walk */
+    while ((cmd = plcrash_async_macho_next_command(image, cmd)) != NULL) {
+        uint32_t offset = (uint32_t) ((uintptr_t) cmd - image->load_cmds.address);
+        uint32_t type = image->byteorder->swap32(cmd->cmd);
+
+        if (type == LC_UUID && summary->uuid_offset == PLCRASH_ASYNC_MACHO_SUMMARY_NONE) {
+            summary->uuid_offset = offset;
+        } else if (type == LC_SYMTAB && summary->symtab_offset == PLCRASH_ASYNC_MACHO_SUMMARY_NONE) {
+            summary->symtab_offset = offset;
+        } else if (type == LC_DYSYMTAB && summary->dysymtab_offset == PLCRASH_ASYNC_MACHO_SUMMARY_NONE) {
+            summary->dysymtab_offset = offset;
+        }
+
+        if (type != segment_type)
+            continue;
+
+        if (summary->segment_count == PLCRASH_ASYNC_MACHO_SUMMARY_SEGMENTS) {
+            PLCF_DEBUG("Too many segments to summarize in %s", PLCF_DEBUG_IMAGE_NAME(image));
+            return;
+        }
+
+        size_t cmd_size = image->m64 ? sizeof(struct segment_command_64) : sizeof(struct segment_command);
+        if (!plcrash_async_mobject_verify_local_pointer(&image->load_cmds, (uintptr_t) cmd, 0, cmd_size)) {
+            PLCF_DEBUG("LC_SEGMENT command was too short in %s", PLCF_DEBUG_IMAGE_NAME(image));
+            return;
+        }
+
+        /* Only the first segment of a given name is visible to lookups; its sections are the ones recorded */
+        const char *segname = image->m64 ? ((struct segment_command_64 *) cmd)->segname : ((struct segment_command *) cmd)->segname;
+        bool duplicate = false;
+        for (uint32_t i = 0; i < summary->segment_count; i++) {
+            if (plcrash_async_strncmp(segname, summary->segments[i].segname, sizeof(summary->segments[i].segname)) == 0) {
+                duplicate = true;
+                break;
+            }
+        }
+
+        plcrash_async_macho_summary_segment_t *entry = &summary->segments[summary->segment_count++];
+        memcpy(entry->segname, segname, sizeof(entry->segname));
+        entry->cmd_offset = offset;
+
+        if (duplicate)
+            continue;
+
+        /* Record any well-known sections */
+        uintptr_t cursor = (uintptr_t) cmd;
+        uint32_t nsects = plcrash_async_macho_read_sections_count(image, &cursor);
+        for (uint32_t i = 0; i < nsects; i++) {
+            const char *sectname;
+            pl_vm_address_t sectaddr;
+            pl_vm_size_t sectsize;
+            if (!plcrash_async_macho_read_section(image, &cursor, &sectname, &sectaddr, &sectsize)) {
+                PLCF_DEBUG("Section table entry outside of expected range in %s", PLCF_DEBUG_IMAGE_NAME(image));
+                return;
+            }
+
+            for (int id = 0; id < PLCRASH_ASYNC_MACHO_SECTION_COUNT; id++) {
+                plcrash_async_macho_summary_section_t *section = &summary->sections[id];
+                if (section->present || !plcrash_async_macho_section_id_matches((plcrash_async_macho_section_id_t) id, segname, sectname))
+                    continue;
+
+                section->present = true;
+                section->address = sectaddr;
+                section->size = sectsize;
+            }
+        }
+    }
+
+    summary->valid = true;
+}
+
 /**
  * Find and map a named section within a named segment, initializing @a mobj.
  * It is the caller's responsibility to dealloc @a mobj after a successful
@@ -537,6 +721,20 @@ static bool plcrash_async_macho_read_section (plcrash_async_macho_t *image, uint
  * @return Returns PLCRASH_ESUCCESS on success, PLCRASH_ENOTFOUND if the section is not found, or an error result on failure.
  */
 plcrash_error_t plcrash_async_macho_map_section (plcrash_async_macho_t *image, const char *segname, const char *sectname, plcrash_async_mobject_t *mobj) {
+    /* Well-known sections are answered directly from the summary */
+    if (image->summary.valid) {
+        for (int i = 0; i < PLCRASH_ASYNC_MACHO_SECTION_COUNT; i++) {
+            if (!plcrash_async_macho_section_id_matches((plcrash_async_macho_section_id_t) i, segname, sectname))
+                continue;
+
+            const plcrash_async_macho_summary_section_t *section = &image->summary.sections[i];
+            if (!section->present)
+                return PLCRASH_ENOTFOUND;
+
+            return plcrash_async_mobject_init(mobj, image->task, section->address, section->size, true);
+        }
+    }
+
     void *segment =  plcrash_async_macho_find_segment_cmd(image, segname);
     if (segment == NULL) {
         return PLCRASH_ENOTFOUND;
@@ -868,6 +1066,184 @@ static void plcrash_async_macho_find_best_symbol (plcrash_async_macho_symtab_rea
     }
 }
 
+/*
+ * Append all section-defined, non-debugging symbols from @a symtab to @a entries.
+ *
+ * @param reader The Mach-O symbol table reader from which @a symtab was mapped.
+ * @param symtab The symtab to index. This must be reader->symtab, or a subrange thereof.
+ * @param nsyms The number of nlist entries available via @a symtab.
+ * @param entries The index entry array to which entries will be appended.
+ * @param count On input, the number of entries already in @a entries. On return, the updated entry count.
+ */
+static void plcrash_nasync_macho_symbol_index_append (plcrash_async_macho_symtab_reader_t *reader,
+                                                      void *symtab, uint32_t nsyms,
+                                                      plcrash_async_macho_symbol_index_entry_t *entries,
+                                                      uint32_t *count)
+{
+    size_t nlist_size = reader->image->m64 ? sizeof(struct nlist_64) : sizeof(struct nlist);
+    uint32_t base_index = (uint32_t) (((uintptr_t) symtab - (uintptr_t) reader->symtab) / nlist_size);
+
+    for (uint32_t i = 0; i < nsyms; i++) {
+        plcrash_async_macho_symtab_entry_t entry = plcrash_async_macho_symtab_reader_read(reader, symtab, i);
+
+        /* Apply the same filtering as plcrash_async_macho_find_best_symbol() */
+        if ((entry.n_type & N_TYPE) != N_SECT || ((entry.n_type & N_STAB) != 0))
+            continue;
+
+        entries[*count].n_value = entry.n_value;
+        entries[*count].symtab_index = base_index + i;
+        (*count)++;
+    }
+}
+
+/*
+ * Symbol index sort comparator; orders by ascending n_value.
+ */
+static int plcrash_nasync_macho_symbol_index_compare (const void *a, const void *b) {
+    const plcrash_async_macho_symbol_index_entry_t *lhs = a;
+    const plcrash_async_macho_symbol_index_entry_t *rhs = b;
+
+    if (lhs->n_value < rhs->n_value)
+        return -1;
+    else if (lhs->n_value > rhs->n_value)
+        return 1;
+
+    return 0;
+}
+
+/**
+ * Build an address-sorted symbol index for @a image, allowing plcrash_async_macho_find_symbol_by_pc() to
+ * perform symbol lookups via binary search rather than a linear scan of the symbol table. If an index has
+ * already been built for @a image, no action is taken.
+ *
+ * The index is built from the same symbols, and returns the same results, as the linear symbol table search.
+ *
+ * @param image The image for which a symbol index should be built.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or an appropriate error if the symbol table could not be read or
+ * the index could not be allocated. On failure, symbol lookups will continue to use the linear search.
+ *
+ * @warning This method is not async safe, and must not be called concurrently for the same @a image.
+ */
+plcrash_error_t plcrash_nasync_macho_build_symbol_index (plcrash_async_macho_t *image) {
+    plcrash_error_t retval;
+
+    if (image->symbol_index != NULL)
+        return PLCRASH_ESUCCESS;
+
+    /* Initialize a symbol table reader */
+    plcrash_async_macho_symtab_reader_t reader;
+    retval = plcrash_async_macho_symtab_reader_init(&reader, image);
+    if (retval != PLCRASH_ESUCCESS)
+        return retval;
+
+    /* Allocate enough space for all candidate symbols; the table is trimmed once populated. */
+    size_t capacity;
+    if (reader.symtab_global != NULL && reader.symtab_local != NULL) {
+        capacity = (size_t) reader.nsyms_global + (size_t) reader.nsyms_local;
+    } else {
+        capacity = reader.nsyms;
+    }
+
+    plcrash_async_macho_symbol_index_t *index = malloc(sizeof(*index));
+    plcrash_async_macho_symbol_index_entry_t *entries = malloc(sizeof(*entries) * (capacity > 0 ? capacity : 1));
+    if (index == NULL || entries == NULL) {
+        PLCF_DEBUG("Failed to allocate symbol index for %s", PLCF_DEBUG_IMAGE_NAME(image));
+        free(index);
+        free(entries);
+        plcrash_async_macho_symtab_reader_free(&reader);
+        return PLCRASH_ENOMEM;
+    }
+
+    /* Populate the index in the same order in which plcrash_async_macho_find_symbol_by_pc() performs its linear search */
+    uint32_t count = 0;
+    if (reader.symtab_global != NULL && reader.symtab_local != NULL) {
+        plcrash_nasync_macho_symbol_index_append(&reader, reader.symtab_global, reader.nsyms_global, entries, &count);
+        plcrash_nasync_macho_symbol_index_append(&reader, reader.symtab_local, reader.nsyms_local, entries, &count);
+    } else {
+        plcrash_nasync_macho_symbol_index_append(&reader, reader.symtab, reader.nsyms, entries, &count);
+    }
+
+    plcrash_async_macho_symtab_reader_free(&reader);
+
+    /*
+     * Sort by address. A stable sort is used so that, for any set of symbols sharing an address, the first entry
+     * is the one that the linear search would have selected; we then discard the remainder.
+     */
+    if (mergesort(entries, count, sizeof(*entries), plcrash_nasync_macho_symbol_index_compare) != 0) {
+        PLCF_DEBUG("Failed to sort symbol index for %s", PLCF_DEBUG_IMAGE_NAME(image));
+        free(index);
+        free(entries);
+        return PLCRASH_ENOMEM;
+    }
+
+    uint32_t unique = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (unique > 0 && entries[unique - 1].n_value == entries[i].n_value)
+            continue;
+
+        entries[unique++] = entries[i];
+    }
+
+    if (unique > 0 && unique < capacity) {
+        plcrash_async_macho_symbol_index_entry_t *trimmed = realloc(entries, sizeof(*entries) * unique);
+        if (trimmed != NULL)
+            entries = trimmed;
+    }
+
+    index->entries = entries;
+    index->count = unique;
+
+    /* Ensure the index is fully populated prior to making it visible to async-safe readers. */
+    atomic_thread_fence(memory_order_seq_cst);
+    image->symbol_index = index;
+
+    return PLCRASH_ESUCCESS;
+}
+
+/*
+ * Locate the best symbol table entry for @a slide_pc using @a index. This will return the same entry as
+ * plcrash_async_macho_find_best_symbol().
+ *
+ * @param reader The Mach-O symbol table reader from which symbol entries will be read.
+ * @param index The image's symbol index.
+ * @param slide_pc The PC value for which symbol information should be found. The VM slide
+ * address should have already been applied to this value.
+ * @param found_symbol On success, will be set to the discovered symbol value.
+ *
+ * @return Returns true if a symbol was found, false otherwise.
+ */
+static bool plcrash_async_macho_find_indexed_symbol (plcrash_async_macho_symtab_reader_t *reader,
+                                                     plcrash_async_macho_symbol_index_t *index,
+                                                     pl_vm_address_t slide_pc,
+                                                     plcrash_async_macho_symtab_entry_t *found_symbol)
+{
+    /* Find the first entry with an address greater than slide_pc */
+    uint32_t low = 0;
+    uint32_t high = index->count;
+    while (low < high) {
+        uint32_t mid = low + ((high - low) / 2);
+        if (index->entries[mid].n_value <= slide_pc) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    /* No symbol precedes slide_pc */
+    if (low == 0)
+        return false;
+
+    uint32_t symtab_index = index->entries[low - 1].symtab_index;
+    if (symtab_index >= reader->nsyms) {
+        PLCF_DEBUG("Symbol index entry %" PRIu32 " exceeds symbol table size of %" PRIu32, symtab_index, reader->nsyms);
+        return false;
+    }
+
+    *found_symbol = plcrash_async_macho_symtab_reader_read(reader, reader->symtab, symtab_index);
+    return true;
+}
+
 /**
  * Attempt to locate a symbol address and name for @a pc within @a image. This is performed using best-guess heuristics, and may
  * be incorrect.
@@ -898,7 +1274,11 @@ plcrash_error_t plcrash_async_macho_find_symbol_by_pc (plcrash_async_macho_t *im
     plcrash_async_macho_symtab_entry_t found_symbol;
     bool did_find_symbol;
 
-    if (reader.symtab_global != NULL && reader.symtab_local != NULL) {
+    plcrash_async_macho_symbol_index_t *index = image->symbol_index;
+    if (index != NULL) {
+        /* A symbol index is available; perform a binary search. */
+        did_find_symbol = plcrash_async_macho_find_indexed_symbol(&reader, index, slide_pc, &found_symbol);
+    } else if (reader.symtab_global != NULL && reader.symtab_local != NULL) {
         /* dysymtab is available; use it to constrain our symbol search to the global and local sections of the symbol table. */
         plcrash_async_macho_find_best_symbol(&reader, slide_pc, reader.symtab_global, reader.nsyms_global, &found_symbol, NULL, &did_find_symbol);
         plcrash_async_macho_find_best_symbol(&reader, slide_pc, reader.symtab_local, reader.nsyms_local, &found_symbol, &found_symbol, &did_find_symbol);
@@ -952,6 +1332,11 @@ void plcrash_nasync_macho_free (plcrash_async_macho_t *image) {
     
     plcrash_async_mobject_free(&image->load_cmds);
 
+    if (image->symbol_index != NULL) {
+        free(image->symbol_index->entries);
+        free(image->symbol_index);
+    }
+
     mach_port_mod_refs(mach_task_self(), image->task, MACH_PORT_RIGHT_SEND, -1);
 }
 
@@ -46,6 +46,165 @@ extern "C" {
  * @{
  */
 
+/**
+ * @internal
+ *
+ * A single entry in a Mach-O image's address-sorted symbol index.
+ */
+typedef struct plcrash_async_macho_symbol_index_entry {
+    /** The symbol's unslid address, as defined by the nlist n_value field. */
+    pl_vm_address_t n_value;
+
+    /** The index of the symbol's nlist entry within the image's full symbol table. */
+    uint32_t symtab_index;
+} plcrash_async_macho_symbol_index_entry_t;
+
+/**
+ * @internal
+ *
+ * An address-sorted index of a Mach-O image's symbol table, used to perform PC lookups via binary search.
+ * The index contains at most one entry per address; when multiple symbols share an address, the entry
+ * that a linear search of the symbol table would have preferred is retained.
+ */
+typedef struct plcrash_async_macho_symbol_index {
+    /** The index entries, sorted by ascending n_value. */
+    plcrash_async_macho_symbol_index_entry_t *entries;
+
+    /** The number of entries in @a entries. */
+    uint32_t count;
+} plcrash_async_macho_symbol_index_t;
+
+/** The maximum number of segment commands recorded in a plcrash_async_macho_summary_t. */
+#define PLCRASH_ASYNC_MACHO_SUMMARY_SEGMENTS 16
+
+/** Load command offset used to mark a command as absent from a plcrash_async_macho_summary_t. */
+#define PLCRASH_ASYNC_MACHO_SUMMARY_NONE UINT32_MAX
+
+/**
+ * @internal
+ *
+ * Well-known sections whose locations are recorded in a plcrash_async_macho_summary_t.
+ */
+typedef enum {
+    /** __TEXT,__unwind_info */
+    PLCRASH_ASYNC_MACHO_SECTION_UNWIND_INFO = 0,
+
+    /** __TEXT,__eh_frame */
+    PLCRASH_ASYNC_MACHO_SECTION_EH_FRAME,
+
+    /** __DWARF,__debug_frame */
+    PLCRASH_ASYNC_MACHO_SECTION_DEBUG_FRAME,
+
+    /** __TEXT,__objc_methlist */
+    PLCRASH_ASYNC_MACHO_SECTION_OBJC_METHLIST,
+
+    /** __OBJC,__module_info */
+    PLCRASH_ASYNC_MACHO_SECTION_OBJC_MODULE_INFO,
+
+    /** __DATA,__objc_const */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_CONST,
+
+    /** __DATA,__objc_const_ax */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_CONST_AX,
+
+    /** __DATA,__objc_selrefs */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_SELREFS,
+
+    /** __DATA,__objc_classlist */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_CLASSLIST,
+
+    /** __DATA,__objc_catlist */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_CATLIST,
+
+    /** __DATA,__objc_data */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_OBJC_DATA,
+
+    /** __DATA,__data */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_DATA,
+
+    /** __DATA_CONST,__objc_const */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_CONST_OBJC_CONST,
+
+    /** __DATA_CONST,__objc_classlist */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_CONST_OBJC_CLASSLIST,
+
+    /** __DATA_CONST,__objc_catlist */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_CONST_OBJC_CATLIST,
+
+    /** __DATA_DIRTY,__objc_const */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_DIRTY_OBJC_CONST,
+
+    /** __DATA_DIRTY,__objc_classlist */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_DIRTY_OBJC_CLASSLIST,
+
+    /** __DATA_DIRTY,__objc_catlist */
+    PLCRASH_ASYNC_MACHO_SECTION_DATA_DIRTY_OBJC_CATLIST,
+
+    /** The number of well-known sections. */
+    PLCRASH_ASYNC_MACHO_SECTION_COUNT
+} plcrash_async_macho_section_id_t;
+
+/**
+ * @internal
+ *
+ * A segment command recorded in a plcrash_async_macho_summary_t.
+ */
+typedef struct plcrash_async_macho_summary_segment {
+    /** The segment name. As in the segment command, this is not guaranteed to be NUL terminated. */
+    char segname[16];
+
+    /** The offset of the segment's LC_SEGMENT/LC_SEGMENT_64 command from the start of the mapped load commands. */
+    uint32_t cmd_offset;
+} plcrash_async_macho_summary_segment_t;
+
+/**
+ * @internal
+ *
+ * The location of a well-known section recorded in a plcrash_async_macho_summary_t.
+ */
+typedef struct plcrash_async_macho_summary_section {
+    /** If false, the section is not present in the image, and the remaining fields are undefined. */
+    bool present;
+
+    /** The section's in-memory (slid) address. */
+    pl_vm_address_t address;
+
+    /** The section's size, in bytes. */
+    pl_vm_size_t size;
+} plcrash_async_macho_summary_section_t;
+
+/**
+ * @internal
+ *
+ * A fixed-layout summary of a Mach-O image's load commands, built once by plcrash_nasync_macho_init(). The summary
+ * allows the load command, segment and section accessors to answer lookups without re-walking and re-validating
+ * the image's load commands.
+ */
+typedef struct plcrash_async_macho_summary {
+    /** If false, the summary could not be fully populated (eg, the image declares more than
+     * PLCRASH_ASYNC_MACHO_SUMMARY_SEGMENTS segments, or a section table could not be read), and all accessors
+     * must fall back to walking the load commands. */
+    bool valid;
+
+    /** Offset of the first LC_UUID command, or PLCRASH_ASYNC_MACHO_SUMMARY_NONE. */
+    uint32_t uuid_offset;
+
+    /** Offset of the first LC_SYMTAB command, or PLCRASH_ASYNC_MACHO_SUMMARY_NONE. */
+    uint32_t symtab_offset;
+
+    /** Offset of the first LC_DYSYMTAB command, or PLCRASH_ASYNC_MACHO_SUMMARY_NONE. */
+    uint32_t dysymtab_offset;
+
+    /** The number of entries in @a segments. */
+    uint32_t segment_count;
+
+    /** The image's segment commands, in load command order. */
+    plcrash_async_macho_summary_segment_t segments[PLCRASH_ASYNC_MACHO_SUMMARY_SEGMENTS];
+
+    /** Well-known section locations, indexed by plcrash_async_macho_section_id_t. */
+    plcrash_async_macho_summary_section_t sections[PLCRASH_ASYNC_MACHO_SECTION_COUNT];
+} plcrash_async_macho_summary_t;
+
 /**
  * @internal
  *
@@ -89,6 +248,13 @@ typedef struct plcrash_async_macho {
 
     /** The byte order functions to use for this image */
     const plcrash_async_byteorder_t *byteorder;
+
+    /** Summary of the image's load commands, populated by plcrash_nasync_macho_init(). */
+    plcrash_async_macho_summary_t summary;
+
+    /** The image's address-sorted symbol index, or NULL if no index has been built. The index is
+     * built by plcrash_nasync_macho_build_symbol_index(), and is published only once fully populated. */
+    plcrash_async_macho_symbol_index_t * volatile symbol_index;
 } plcrash_async_macho_t;
 
 // Use only filename in debug logging because PLCF_DEBUG has length limit.
@@ -190,6 +356,7 @@ typedef struct plcrash_async_macho_symtab_reader {
 typedef void (*pl_async_macho_found_symbol_cb)(pl_vm_address_t address, const char *name, void *ctx);
 
 plcrash_error_t plcrash_nasync_macho_init (plcrash_async_macho_t *image, mach_port_t task, const char *name, pl_vm_address_t header);
+plcrash_error_t plcrash_nasync_macho_build_symbol_index (plcrash_async_macho_t *image);
 
 const plcrash_async_byteorder_t *plcrash_async_macho_byteorder (plcrash_async_macho_t *image);
 const struct mach_header *plcrash_async_macho_header (plcrash_async_macho_t *image);
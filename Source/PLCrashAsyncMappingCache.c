@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "PLCrashAsyncMappingCache.h"
+#include "PLCrashAsyncThreadBinding.h"
+
+#include <inttypes.h>
+
+/**
+ * @internal
+ * @ingroup plcrash_async_mapping_cache
+ * @{
+ */
+
+/**
+ * @internal
+ *
+ * Deallocate @a entry's mapping, and mark the entry as unused.
+ */
+static void plcrash_async_mapping_cache_entry_evict (plcrash_async_mapping_cache_entry_t *entry) {
+    kern_return_t kt;
+
+#ifdef PL_HAVE_MACH_VM
+    kt = mach_vm_deallocate(mach_task_self(), entry->vm_address, entry->vm_length);
+#else
+    kt = vm_deallocate(mach_task_self(), entry->vm_address, entry->vm_length);
+#endif
+
+    if (kt != KERN_SUCCESS)
+        PLCF_DEBUG("vm_deallocate() failure: %d", kt);
+
+    mach_port_mod_refs(mach_task_self(), entry->task, MACH_PORT_RIGHT_SEND, -1);
+
+    entry->task = MACH_PORT_NULL;
+    entry->refcount = 0;
+    entry->last_use = 0;
+}
+
+/**
+ * Initialize a new, empty mapping cache.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to initialize. The cache must be freed via plcrash_async_mapping_cache_free().
+ */
+void plcrash_async_mapping_cache_init (plcrash_async_mapping_cache_t *cache) {
+    for (size_t i = 0; i < PLCRASH_ASYNC_MAPPING_CACHE_ENTRIES; i++) {
+        cache->entries[i].task = MACH_PORT_NULL;
+        cache->entries[i].refcount = 0;
+        cache->entries[i].last_use = 0;
+    }
+
+    cache->use_counter = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+}
+
+/**
+ * Search @a cache for a mapping of the page-aligned range starting at @a task_address, acquiring a reference to the
+ * mapping if found.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to search.
+ * @param task The task from which the range is to be mapped.
+ * @param task_address The page-aligned task-relative address of the range.
+ * @param length The page-rounded length of the range.
+ * @param require_full If true, only a mapping of the entire range will be returned. If false, a mapping that was
+ * previously truncated while mapping the same range may also be returned; see plcrash_async_mobject_init().
+ *
+ * @return Returns the matching entry, or NULL if not found. The caller is responsible for releasing the returned entry
+ * via plcrash_async_mapping_cache_release().
+ */
+plcrash_async_mapping_cache_entry_t *plcrash_async_mapping_cache_acquire (plcrash_async_mapping_cache_t *cache,
+                                                                          task_t task,
+                                                                          pl_vm_address_t task_address,
+                                                                          pl_vm_size_t length,
+                                                                          bool require_full)
+{
+    for (size_t i = 0; i < PLCRASH_ASYNC_MAPPING_CACHE_ENTRIES; i++) {
+        plcrash_async_mapping_cache_entry_t *entry = &cache->entries[i];
+        if (entry->task != task || task == MACH_PORT_NULL)
+            continue;
+
+        if (task_address < entry->task_address)
+            continue;
+
+        /* Determine the end of the range covered by the entry. A truncated mapping covers the remainder of its
+         * requested range only if the caller permits short mappings. */
+        pl_vm_address_t offset = task_address - entry->task_address;
+        pl_vm_size_t covered = require_full ? entry->vm_length : entry->requested_length;
+        if (offset >= entry->vm_length || length > covered - offset)
+            continue;
+
+        cache->hits++;
+        entry->refcount++;
+        entry->last_use = ++cache->use_counter;
+        return entry;
+    }
+
+    cache->misses++;
+    return NULL;
+}
+
+/**
+ * Insert a newly created mapping into @a cache, evicting the least recently used unreferenced entry if necessary.
+ * On success, the cache assumes ownership of the mapping, and a single reference is returned to the caller.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache into which the mapping should be inserted.
+ * @param task The task from which the mapping was created.
+ * @param task_address The page-aligned task-relative address of the mapping.
+ * @param requested_length The page-rounded length that was requested when creating the mapping.
+ * @param vm_address The in-process address of the mapping.
+ * @param vm_length The actual length of the mapping.
+ *
+ * @return Returns the new entry, or NULL if all entries are referenced. If NULL is returned, ownership of the mapping
+ * remains with the caller.
+ */
+plcrash_async_mapping_cache_entry_t *plcrash_async_mapping_cache_insert (plcrash_async_mapping_cache_t *cache,
+                                                                         task_t task,
+                                                                         pl_vm_address_t task_address,
+                                                                         pl_vm_size_t requested_length,
+                                                                         pl_vm_address_t vm_address,
+                                                                         pl_vm_size_t vm_length)
+{
+    plcrash_async_mapping_cache_entry_t *victim = NULL;
+
+    /* Find an unused entry, or the least recently used unreferenced entry */
+    for (size_t i = 0; i < PLCRASH_ASYNC_MAPPING_CACHE_ENTRIES; i++) {
+        plcrash_async_mapping_cache_entry_t *entry = &cache->entries[i];
+        if (entry->refcount != 0)
+            continue;
+
+        if (victim == NULL || entry->last_use < victim->last_use)
+            victim = entry;
+    }
+
+    if (victim == NULL)
+        return NULL;
+
+    if (victim->task != MACH_PORT_NULL)
+        plcrash_async_mapping_cache_entry_evict(victim);
+
+    victim->task = task;
+    mach_port_mod_refs(mach_task_self(), task, MACH_PORT_RIGHT_SEND, 1);
+
+    victim->task_address = task_address;
+    victim->requested_length = requested_length;
+    victim->vm_address = vm_address;
+    victim->vm_length = vm_length;
+    victim->refcount = 1;
+    victim->last_use = ++cache->use_counter;
+
+    return victim;
+}
+
+/**
+ * Release a reference to @a entry. The mapping remains cached for reuse until evicted, or until the owning cache
+ * is freed.
+ *
+ * This function is async-safe.
+ *
+ * @param entry An entry previously returned by plcrash_async_mapping_cache_acquire() or
+ * plcrash_async_mapping_cache_insert().
+ */
+void plcrash_async_mapping_cache_release (plcrash_async_mapping_cache_entry_t *entry) {
+    PLCF_ASSERT(entry->refcount > 0);
+    entry->refcount--;
+}
+
+/**
+ * Fetch the mapping statistics for @a cache. This may be used to evaluate the number of mappings avoided by the
+ * cache for diagnostic purposes.
+ *
+ * @param cache The cache to query.
+ * @param hits On return, the number of mapping requests satisfied by the cache.
+ * @param misses On return, the number of mapping requests that required a new mapping.
+ */
+void plcrash_async_mapping_cache_get_stats (plcrash_async_mapping_cache_t *cache, uint64_t *hits, uint64_t *misses) {
+    *hits = cache->hits;
+    *misses = cache->misses;
+}
+
+/**
+ * Free all mappings held by @a cache.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to free. The cache must not be bound, and all memory objects referencing the cache's mappings
+ * must have been freed.
+ */
+void plcrash_async_mapping_cache_free (plcrash_async_mapping_cache_t *cache) {
+    PLCF_DEBUG("Mapping cache: %" PRIu64 " hits, %" PRIu64 " misses", cache->hits, cache->misses);
+
+    for (size_t i = 0; i < PLCRASH_ASYNC_MAPPING_CACHE_ENTRIES; i++) {
+        plcrash_async_mapping_cache_entry_t *entry = &cache->entries[i];
+        if (entry->task == MACH_PORT_NULL)
+            continue;
+
+        PLCF_ASSERT(entry->refcount == 0);
+        plcrash_async_mapping_cache_entry_evict(entry);
+    }
+}
+
+/**
+ * Bind @a cache to the calling thread. Until unbound, memory objects initialized by the calling thread via
+ * plcrash_async_mobject_init() will share mappings held by @a cache.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to bind. If another cache is already bound to the calling thread, @a cache will be used in
+ * its place until unbound.
+ *
+ * @return Returns true on success, or false if @a cache is already bound to the calling thread, or the maximum
+ * number of concurrent thread bindings has been reached, in which case mappings will not be cached.
+ */
+bool plcrash_async_mapping_cache_bind (plcrash_async_mapping_cache_t *cache) {
+    return plcrash_async_thread_bind(PLCRASH_ASYNC_BINDING_MAPPING_CACHE, cache);
+}
+
+/**
+ * Unbind @a cache from the calling thread. If @a cache is not bound to the calling thread, this is a no-op. Memory
+ * objects that reference the cache's mappings remain valid until freed.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to unbind.
+ */
+void plcrash_async_mapping_cache_unbind (plcrash_async_mapping_cache_t *cache) {
+    plcrash_async_thread_unbind(PLCRASH_ASYNC_BINDING_MAPPING_CACHE, cache);
+}
+
+/**
+ * Return the mapping cache bound to the calling thread, if any.
+ *
+ * This function is async-safe.
+ *
+ * @return Returns the bound cache, or NULL if no cache is bound to the calling thread.
+ */
+plcrash_async_mapping_cache_t *plcrash_async_mapping_cache_bound (void) {
+    return plcrash_async_thread_bound(PLCRASH_ASYNC_BINDING_MAPPING_CACHE);
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef PLCRASH_ASYNC_MAPPING_CACHE_H
+#define PLCRASH_ASYNC_MAPPING_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <mach/mach.h>
+
+#include "PLCrashAsync.h"
+
+/**
+ * @internal
+ * @ingroup plcrash_async
+ * @defgroup plcrash_async_mapping_cache Async-Safe Mapping Cache
+ *
+ * Implements a bounded cache of target task page ranges that have been mapped into the current process, allowing
+ * plcrash_async_mobject_t instances to share a single mapping rather than remapping the same range for every lookup.
+ * @{
+ */
+
+/** The maximum number of mappings held by a plcrash_async_mapping_cache_t. */
+#define PLCRASH_ASYNC_MAPPING_CACHE_ENTRIES 32
+
+/**
+ * @internal
+ *
+ * A single cached mapping.
+ */
+typedef struct plcrash_async_mapping_cache_entry {
+    /** The task from which the pages were mapped, or MACH_PORT_NULL if the entry is unused. */
+    task_t task;
+
+    /** The page-aligned task-relative address of the mapping. */
+    pl_vm_address_t task_address;
+
+    /** The requested length of the mapping, in bytes. If the requested range could not be fully mapped, this will
+     * exceed @a vm_length. */
+    pl_vm_size_t requested_length;
+
+    /** The in-process address of the mapping. */
+    pl_vm_address_t vm_address;
+
+    /** The actual length of the mapping, in bytes. */
+    pl_vm_size_t vm_length;
+
+    /** The number of outstanding references to this mapping. An entry may only be evicted if this is 0. */
+    uint32_t refcount;
+
+    /** The value of the cache's use counter at the time of the entry's most recent use. */
+    uint64_t last_use;
+} plcrash_async_mapping_cache_entry_t;
+
+/**
+ * @internal
+ *
+ * A bounded, least-recently-used cache of task mappings. The cache is not thread-safe; it is intended to be bound to
+ * a single thread for the duration of a report, via plcrash_async_mapping_cache_bind().
+ */
+typedef struct plcrash_async_mapping_cache {
+    /** The cache entries. */
+    plcrash_async_mapping_cache_entry_t entries[PLCRASH_ASYNC_MAPPING_CACHE_ENTRIES];
+
+    /** Monotonically increasing use counter, used to determine the least-recently-used entry. */
+    uint64_t use_counter;
+
+    /** The number of mapping requests satisfied by the cache. */
+    uint64_t hits;
+
+    /** The number of mapping requests that required a new mapping. */
+    uint64_t misses;
+} plcrash_async_mapping_cache_t;
+
+void plcrash_async_mapping_cache_init (plcrash_async_mapping_cache_t *cache);
+
+plcrash_async_mapping_cache_entry_t *plcrash_async_mapping_cache_acquire (plcrash_async_mapping_cache_t *cache,
+                                                                          task_t task,
+                                                                          pl_vm_address_t task_address,
+                                                                          pl_vm_size_t length,
+                                                                          bool require_full);
+
+plcrash_async_mapping_cache_entry_t *plcrash_async_mapping_cache_insert (plcrash_async_mapping_cache_t *cache,
+                                                                         task_t task,
+                                                                         pl_vm_address_t task_address,
+                                                                         pl_vm_size_t requested_length,
+                                                                         pl_vm_address_t vm_address,
+                                                                         pl_vm_size_t vm_length);
+
+void plcrash_async_mapping_cache_release (plcrash_async_mapping_cache_entry_t *entry);
+
+void plcrash_async_mapping_cache_get_stats (plcrash_async_mapping_cache_t *cache, uint64_t *hits, uint64_t *misses);
+void plcrash_async_mapping_cache_free (plcrash_async_mapping_cache_t *cache);
+
+bool plcrash_async_mapping_cache_bind (plcrash_async_mapping_cache_t *cache);
+void plcrash_async_mapping_cache_unbind (plcrash_async_mapping_cache_t *cache);
+plcrash_async_mapping_cache_t *plcrash_async_mapping_cache_bound (void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCRASH_ASYNC_MAPPING_CACHE_H */
@@ -42,6 +42,58 @@ extern "C" {
  * @{
  */
 
+/**
+ * @internal
+ *
+ * The number of per-image method indexes retained by a plcrash_async_objc_cache_t.
+ */
+#define PLCRASH_ASYNC_OBJC_METHOD_INDEX_COUNT 8
+
+/**
+ * @internal
+ *
+ * A single method entry within a plcrash_async_objc_method_index_t.
+ */
+typedef struct plcrash_async_objc_method_index_entry {
+    /** The method's IMP. */
+    pl_vm_address_t imp;
+
+    /** The address of the method's class name. */
+    pl_vm_address_t class_name;
+
+    /** The address of the method's name. */
+    pl_vm_address_t method_name;
+
+    /** The order in which the method was found while parsing the image's ObjC data. Used to order entries with equal IMPs. */
+    uint32_t ordinal;
+
+    /** If true, the method is a class (rather than an instance) method. */
+    bool is_class_method;
+} plcrash_async_objc_method_index_entry_t;
+
+/**
+ * @internal
+ *
+ * An IMP-sorted table of all Objective-C methods defined by a single image, built from a single parse of the
+ * image's ObjC metadata.
+ */
+typedef struct plcrash_async_objc_method_index {
+    /** The indexed image, or NULL if this index is unused. */
+    plcrash_async_macho_t *image;
+
+    /** The result of parsing @a image. If not PLCRASH_ESUCCESS, @a entries will be empty. */
+    plcrash_error_t status;
+
+    /** The VM-allocated method entries, sorted by IMP, or NULL if none. */
+    plcrash_async_objc_method_index_entry_t *entries;
+
+    /** The number of valid entries in @a entries. */
+    size_t count;
+
+    /** The number of entries allocated in @a entries. */
+    size_t capacity;
+} plcrash_async_objc_method_index_t;
+
 /**
  * @internal
  *
@@ -119,6 +171,12 @@ typedef struct plcrash_async_objc_cache {
     
     /** Array of class cache values. These are pointers to class_ro data. */
     pl_vm_address_t *classCacheValues;
+
+    /** Per-image method indexes, populated on the first method lookup within each image. */
+    plcrash_async_objc_method_index_t methodIndexes[PLCRASH_ASYNC_OBJC_METHOD_INDEX_COUNT];
+
+    /** The next entry in @a methodIndexes to be (re)used. */
+    size_t nextMethodIndex;
 } plcrash_async_objc_cache_t;
 
 plcrash_error_t plcrash_async_objc_cache_init (plcrash_async_objc_cache_t *context);
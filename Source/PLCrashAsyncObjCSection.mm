@@ -1233,6 +1233,24 @@ static plcrash_error_t pl_async_objc_parse_from_data_section (plcrash_async_mach
     return err;
 }
 
+/**
+ * @internal
+ *
+ * Release all entries held by @a index, and mark it as unused.
+ *
+ * @param index The index to reset.
+ */
+static void method_index_reset (plcrash_async_objc_method_index_t *index) {
+    if (index->entries != NULL)
+        vm_deallocate(mach_task_self(), (vm_address_t) index->entries, index->capacity * sizeof(index->entries[0]));
+
+    index->image = NULL;
+    index->status = PLCRASH_ENOTFOUND;
+    index->entries = NULL;
+    index->count = 0;
+    index->capacity = 0;
+}
+
 /**
  * Initialize an ObjC cache object.
  *
@@ -1253,6 +1271,16 @@ plcrash_error_t plcrash_async_objc_cache_init (plcrash_async_objc_cache_t *cache
     cache->classCacheSize = 0;
     cache->classCacheKeys = NULL;
     cache->classCacheValues = NULL;
+
+    for (size_t i = 0; i < PLCRASH_ASYNC_OBJC_METHOD_INDEX_COUNT; i++) {
+        cache->methodIndexes[i].image = NULL;
+        cache->methodIndexes[i].status = PLCRASH_ENOTFOUND;
+        cache->methodIndexes[i].entries = NULL;
+        cache->methodIndexes[i].count = 0;
+        cache->methodIndexes[i].capacity = 0;
+    }
+    cache->nextMethodIndex = 0;
+
     return PLCRASH_ESUCCESS;
 }
 
@@ -1266,6 +1294,9 @@ void plcrash_async_objc_cache_free (plcrash_async_objc_cache_t *cache) {
 
     if (cache->classCacheKeys != NULL)
         vm_deallocate(mach_task_self(), (vm_address_t)cache->classCacheKeys, cache_allocation_size(cache));
+
+    for (size_t i = 0; i < PLCRASH_ASYNC_OBJC_METHOD_INDEX_COUNT; i++)
+        method_index_reset(&cache->methodIndexes[i]);
 }
 
 /**
@@ -1353,6 +1384,200 @@ static void pl_async_objc_find_method_call_callback (bool isClassMethod, plcrash
     }
 }
 
+/**
+ * @internal
+ *
+ * Context for pl_async_objc_method_index_callback().
+ */
+struct pl_async_objc_method_index_context {
+    /** The index being populated. */
+    plcrash_async_objc_method_index_t *index;
+
+    /** Set to true if the entry table could not be grown. */
+    bool overflow;
+};
+
+/**
+ * Callback used to populate a plcrash_async_objc_method_index_t. The context pointer is a pointer to
+ * pl_async_objc_method_index_context.
+ */
+static void pl_async_objc_method_index_callback (bool isClassMethod, plcrash_async_macho_string_t *className, plcrash_async_macho_string_t *methodName, pl_vm_address_t imp, void *ctx) {
+    struct pl_async_objc_method_index_context *ctxStruct = (struct pl_async_objc_method_index_context *) ctx;
+    plcrash_async_objc_method_index_t *index = ctxStruct->index;
+
+    if (ctxStruct->overflow)
+        return;
+
+    /* Grow the entry table if necessary. We use vm_allocate() here, as malloc is not async-safe. */
+    if (index->count == index->capacity) {
+        size_t capacity = index->capacity > 0 ? index->capacity * 2 : vm_page_size / sizeof(index->entries[0]);
+        vm_address_t addr;
+        kern_return_t kr = vm_allocate(mach_task_self(), &addr, capacity * sizeof(index->entries[0]), VM_FLAGS_ANYWHERE);
+        if (kr != KERN_SUCCESS) {
+            PLCF_DEBUG("vm_allocate failed with error %x, the ObjC method index could not be grown", kr);
+            ctxStruct->overflow = true;
+            return;
+        }
+
+        if (index->entries != NULL) {
+            plcrash_async_memcpy((void *) addr, index->entries, index->count * sizeof(index->entries[0]));
+            vm_deallocate(mach_task_self(), (vm_address_t) index->entries, index->capacity * sizeof(index->entries[0]));
+        }
+
+        index->entries = (plcrash_async_objc_method_index_entry_t *) addr;
+        index->capacity = capacity;
+    }
+
+    plcrash_async_objc_method_index_entry_t *entry = &index->entries[index->count];
+    entry->imp = imp;
+    entry->class_name = className->address;
+    entry->method_name = methodName->address;
+    entry->ordinal = (uint32_t) index->count;
+    entry->is_class_method = isClassMethod;
+    index->count++;
+}
+
+/**
+ * @internal
+ *
+ * Return true if @a lhs sorts before @a rhs; entries are ordered by IMP, and then by the order in which they
+ * were found.
+ */
+static inline bool method_index_entry_less (const plcrash_async_objc_method_index_entry_t *lhs, const plcrash_async_objc_method_index_entry_t *rhs) {
+    if (lhs->imp != rhs->imp)
+        return lhs->imp < rhs->imp;
+
+    return lhs->ordinal < rhs->ordinal;
+}
+
+/**
+ * @internal
+ *
+ * Restore the max-heap property for the subtree rooted at @a root.
+ */
+static void method_index_sift_down (plcrash_async_objc_method_index_entry_t *entries, size_t root, size_t count) {
+    while (true) {
+        size_t child = (root * 2) + 1;
+        if (child >= count)
+            return;
+
+        if (child + 1 < count && method_index_entry_less(&entries[child], &entries[child + 1]))
+            child++;
+
+        if (!method_index_entry_less(&entries[root], &entries[child]))
+            return;
+
+        plcrash_async_objc_method_index_entry_t tmp = entries[root];
+        entries[root] = entries[child];
+        entries[child] = tmp;
+        root = child;
+    }
+}
+
+/**
+ * @internal
+ *
+ * Sort @a entries by IMP. This is implemented as an in-place heapsort, as the standard library sort functions
+ * are not guaranteed to be async-safe.
+ */
+static void method_index_sort (plcrash_async_objc_method_index_entry_t *entries, size_t count) {
+    if (count < 2)
+        return;
+
+    for (size_t i = count / 2; i > 0; i--)
+        method_index_sift_down(entries, i - 1, count);
+
+    for (size_t end = count - 1; end > 0; end--) {
+        plcrash_async_objc_method_index_entry_t tmp = entries[0];
+        entries[0] = entries[end];
+        entries[end] = tmp;
+        method_index_sift_down(entries, 0, end);
+    }
+}
+
+/**
+ * @internal
+ *
+ * Fetch the method index for @a image from @a cache, parsing the image's ObjC metadata and populating a new index
+ * if none exists.
+ *
+ * @param image The image to index.
+ * @param cache The ObjC cache.
+ *
+ * @return Returns the image's index, or NULL if an index could not be allocated. The index's status must be checked
+ * by the caller to determine whether the image's ObjC data was successfully parsed.
+ */
+static plcrash_async_objc_method_index_t *method_index_get (plcrash_async_macho_t *image, plcrash_async_objc_cache_t *cache) {
+    /* Check for an existing index */
+    for (size_t i = 0; i < PLCRASH_ASYNC_OBJC_METHOD_INDEX_COUNT; i++) {
+        if (cache->methodIndexes[i].image == image)
+            return &cache->methodIndexes[i];
+    }
+
+    /* Evict the oldest index */
+    plcrash_async_objc_method_index_t *index = &cache->methodIndexes[cache->nextMethodIndex];
+    cache->nextMethodIndex = (cache->nextMethodIndex + 1) % PLCRASH_ASYNC_OBJC_METHOD_INDEX_COUNT;
+    method_index_reset(index);
+
+    /* Populate the new index */
+    struct pl_async_objc_method_index_context ctx = {
+        .index = index,
+        .overflow = false
+    };
+
+    plcrash_error_t err = plcrash_async_objc_parse(image, cache, pl_async_objc_method_index_callback, &ctx);
+    if (ctx.overflow) {
+        method_index_reset(index);
+        return NULL;
+    }
+
+    index->image = image;
+    index->status = err;
+    if (err == PLCRASH_ESUCCESS) {
+        method_index_sort(index->entries, index->count);
+    } else {
+        index->count = 0;
+    }
+
+    return index;
+}
+
+/**
+ * @internal
+ *
+ * Search @a index for the method that best matches @a imp; this is the method with the highest IMP
+ * that is less than or equal to @a imp.
+ *
+ * @return Returns the matching entry, or NULL if none is found.
+ */
+static const plcrash_async_objc_method_index_entry_t *method_index_find (plcrash_async_objc_method_index_t *index, pl_vm_address_t imp) {
+    /* Find the first entry with an IMP greater than the target */
+    size_t lower = 0;
+    size_t upper = index->count;
+    while (lower < upper) {
+        size_t mid = lower + ((upper - lower) / 2);
+        if (index->entries[mid].imp <= imp) {
+            lower = mid + 1;
+        } else {
+            upper = mid;
+        }
+    }
+
+    if (lower == 0)
+        return NULL;
+
+    /* Walk back to the first-found entry with the best IMP */
+    size_t best = lower - 1;
+    while (best > 0 && index->entries[best - 1].imp == index->entries[best].imp)
+        best--;
+
+    /* An IMP of 0 is never a valid match */
+    if (index->entries[best].imp == 0)
+        return NULL;
+
+    return &index->entries[best];
+}
+
 /**
  * Search for the method that best matches the given code address.
  *
@@ -1362,8 +1587,50 @@ static void pl_async_objc_find_method_call_callback (bool isClassMethod, plcrash
  * @param callback The callback to invoke when the best match is found.
  * @param ctx The context pointer to pass to the callback.
  * @return An error code.
+ *
+ * The image's ObjC metadata is parsed once, on first use, into an IMP-sorted index retained by @a objcContext;
+ * subsequent lookups within the same image are satisfied by a binary search of that index.
  */
 plcrash_error_t plcrash_async_objc_find_method (plcrash_async_macho_t *image, plcrash_async_objc_cache_t *objcContext, pl_vm_address_t imp, plcrash_async_objc_found_method_cb callback, void *ctx) {
+    if (objcContext == NULL)
+        return PLCRASH_EACCESS;
+
+    plcrash_async_objc_method_index_t *index = method_index_get(image, objcContext);
+    if (index != NULL) {
+        if (index->status != PLCRASH_ESUCCESS) {
+            /* Don't log an error if ObjC data was simply not found */
+            if (index->status != PLCRASH_ENOTFOUND)
+                PLCF_DEBUG("pl_async_objc_parse of %p (%s) failure %d", image, PLCF_DEBUG_IMAGE_NAME(image), index->status);
+            return index->status;
+        }
+
+        const plcrash_async_objc_method_index_entry_t *entry = method_index_find(index, imp);
+        if (entry == NULL)
+            return PLCRASH_ENOTFOUND;
+
+        plcrash_async_macho_string_t className;
+        plcrash_async_macho_string_t methodName;
+        plcrash_error_t err;
+
+        if ((err = plcrash_async_macho_string_init(&className, image, entry->class_name)) != PLCRASH_ESUCCESS) {
+            PLCF_DEBUG("plcrash_async_macho_string_init at 0x%llx error %d", (long long)entry->class_name, err);
+            return err;
+        }
+
+        if ((err = plcrash_async_macho_string_init(&methodName, image, entry->method_name)) != PLCRASH_ESUCCESS) {
+            PLCF_DEBUG("plcrash_async_macho_string_init at 0x%llx error %d", (long long)entry->method_name, err);
+            plcrash_async_macho_string_free(&className);
+            return err;
+        }
+
+        callback(entry->is_class_method, &className, &methodName, entry->imp, ctx);
+
+        plcrash_async_macho_string_free(&methodName);
+        plcrash_async_macho_string_free(&className);
+        return PLCRASH_ESUCCESS;
+    }
+
+    /* If the index could not be allocated, fall back on searching the image's ObjC metadata directly */
     struct pl_async_objc_find_method_search_context searchCtx = {
         .searchIMP = imp
     };
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "PLCrashAsyncPageCache.h"
+#include "PLCrashAsyncThreadBinding.h"
+
+#include <inttypes.h>
+
+/**
+ * @internal
+ * @ingroup plcrash_async_page_cache
+ * @{
+ */
+
+/**
+ * Initialize a new page cache, allocating its page storage.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to initialize. The cache must be freed via plcrash_async_page_cache_free().
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or PLCRASH_ENOMEM if page storage could not be allocated.
+ */
+plcrash_error_t plcrash_async_page_cache_init (plcrash_async_page_cache_t *cache) {
+    cache->page_size = vm_page_size;
+    plcrash_async_page_cache_reset(cache);
+
+    vm_address_t pages;
+    kern_return_t kr = vm_allocate(mach_task_self(), &pages, (vm_size_t) (cache->page_size * PLCRASH_ASYNC_PAGE_CACHE_PAGES), VM_FLAGS_ANYWHERE);
+    if (kr != KERN_SUCCESS) {
+        PLCF_DEBUG("vm_allocate failed for page cache storage: %d", kr);
+        cache->pages = NULL;
+        return PLCRASH_ENOMEM;
+    }
+
+    cache->pages = (uint8_t *) pages;
+    return PLCRASH_ESUCCESS;
+}
+
+/**
+ * Discard all cached pages and reset the cache's statistics, retaining its page storage. This allows a cache
+ * allocated ahead of time to be reused for each report.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to reset.
+ */
+void plcrash_async_page_cache_reset (plcrash_async_page_cache_t *cache) {
+    cache->use_counter = 0;
+    cache->last_entry = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+    plcrash_async_page_cache_flush(cache);
+}
+
+/**
+ * Discard all cached pages. This should be called whenever the previously cached target memory may have been
+ * modified.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to flush.
+ */
+void plcrash_async_page_cache_flush (plcrash_async_page_cache_t *cache) {
+    for (size_t i = 0; i < PLCRASH_ASYNC_PAGE_CACHE_PAGES; i++) {
+        cache->entries[i].task = MACH_PORT_NULL;
+        cache->entries[i].address = 0;
+        cache->entries[i].last_use = 0;
+    }
+}
+
+/**
+ * @internal
+ *
+ * Return the cached contents of the page at @a page_address, reading the page from @a task if it is not already
+ * cached.
+ *
+ * @param cache The cache to search.
+ * @param task The task from which the page should be read.
+ * @param page_address The page-aligned address of the page to be returned.
+ *
+ * @return Returns a pointer to the page's contents, or NULL if the page could not be read.
+ */
+static uint8_t *plcrash_async_page_cache_get_page (plcrash_async_page_cache_t *cache, task_t task, pl_vm_address_t page_address) {
+    plcrash_async_page_cache_entry_t *entry;
+    size_t victim = 0;
+
+    /* Check the most recently used entry first; consecutive reads are typically from the same page. */
+    entry = &cache->entries[cache->last_entry];
+    if (entry->task == task && entry->address == page_address) {
+        cache->hits++;
+        entry->last_use = ++cache->use_counter;
+        return cache->pages + (cache->last_entry * cache->page_size);
+    }
+
+    /* Search the remaining entries, noting the least recently used entry for eviction. Unused entries have a
+     * last_use of 0, and will be selected first. */
+    for (size_t i = 0; i < PLCRASH_ASYNC_PAGE_CACHE_PAGES; i++) {
+        entry = &cache->entries[i];
+        if (entry->task == task && entry->address == page_address) {
+            cache->hits++;
+            cache->last_entry = i;
+            entry->last_use = ++cache->use_counter;
+            return cache->pages + (i * cache->page_size);
+        }
+
+        if (entry->last_use < cache->entries[victim].last_use)
+            victim = i;
+    }
+
+    /* Read the page into the evicted entry */
+    cache->misses++;
+
+    entry = &cache->entries[victim];
+    uint8_t *data = cache->pages + (victim * cache->page_size);
+    if (plcrash_async_task_memcpy_uncached(task, page_address, 0, data, cache->page_size) != PLCRASH_ESUCCESS) {
+        entry->task = MACH_PORT_NULL;
+        entry->last_use = 0;
+        return NULL;
+    }
+
+    entry->task = task;
+    entry->address = page_address;
+    entry->last_use = ++cache->use_counter;
+    cache->last_entry = victim;
+
+    return data;
+}
+
+/**
+ * Copy @a len bytes from @a task at @a address + @a offset to @a dest, reading through @a cache. The semantics
+ * are otherwise identical to plcrash_async_task_memcpy().
+ *
+ * Pages that can not be read in their entirety are not cached; reads from those pages are passed directly to the
+ * target task.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache through which data should be read.
+ * @param task The task from which data will be read.
+ * @param address The base address from which data will be read.
+ * @param offset The offset from @a address at which data will be read.
+ * @param dest The destination address to which copied data will be written.
+ * @param len The number of bytes to be read.
+ *
+ * @return On success, returns PLCRASH_ESUCCESS. See plcrash_async_task_memcpy() for the possible error values.
+ */
+plcrash_error_t plcrash_async_page_cache_memcpy (plcrash_async_page_cache_t *cache, task_t task, pl_vm_address_t address, pl_vm_off_t offset, void *dest, pl_vm_size_t len) {
+    pl_vm_address_t target;
+    uint8_t *output = dest;
+
+    if (cache->pages == NULL)
+        return plcrash_async_task_memcpy_uncached(task, address, offset, dest, len);
+
+    /* Compute the target address and check for overflow */
+    if (!plcrash_async_address_apply_offset(address, offset, &target))
+        return PLCRASH_ENOMEM;
+
+    while (len > 0) {
+        pl_vm_address_t page_address = target & ~((pl_vm_address_t) cache->page_size - 1);
+        pl_vm_size_t page_offset = target - page_address;
+        pl_vm_size_t count = cache->page_size - page_offset;
+        if (count > len)
+            count = len;
+
+        uint8_t *page = plcrash_async_page_cache_get_page(cache, task, page_address);
+        if (page == NULL)
+            return plcrash_async_task_memcpy_uncached(task, target, 0, output, len);
+
+        plcrash_async_memcpy(output, page + page_offset, count);
+        output += count;
+        target += count;
+        len -= count;
+    }
+
+    return PLCRASH_ESUCCESS;
+}
+
+/**
+ * Fetch the page read statistics for @a cache. This may be used to evaluate the number of target task reads
+ * avoided by the cache for diagnostic purposes.
+ *
+ * @param cache The cache to query.
+ * @param hits On return, the number of page reads satisfied by the cache.
+ * @param misses On return, the number of page reads that required a read from the target task.
+ */
+void plcrash_async_page_cache_get_stats (plcrash_async_page_cache_t *cache, uint64_t *hits, uint64_t *misses) {
+    *hits = cache->hits;
+    *misses = cache->misses;
+}
+
+/**
+ * Free all resources associated with @a cache.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to free. The cache must not be bound.
+ */
+void plcrash_async_page_cache_free (plcrash_async_page_cache_t *cache) {
+    PLCF_DEBUG("Page cache: %" PRIu64 " hits, %" PRIu64 " misses", cache->hits, cache->misses);
+
+    if (cache->pages != NULL) {
+        vm_deallocate(mach_task_self(), (vm_address_t) cache->pages, (vm_size_t) (cache->page_size * PLCRASH_ASYNC_PAGE_CACHE_PAGES));
+        cache->pages = NULL;
+    }
+}
+
+/**
+ * Bind @a cache to the calling thread. Until unbound, all plcrash_async_task_memcpy() reads performed by the calling
+ * thread will be read through @a cache.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to bind. If another cache is already bound to the calling thread, @a cache will be used in
+ * its place until unbound.
+ *
+ * @return Returns true on success, or false if @a cache is already bound to the calling thread, or the maximum
+ * number of concurrent thread bindings has been reached, in which case reads will not be cached.
+ */
+bool plcrash_async_page_cache_bind (plcrash_async_page_cache_t *cache) {
+    return plcrash_async_thread_bind(PLCRASH_ASYNC_BINDING_PAGE_CACHE, cache);
+}
+
+/**
+ * Unbind @a cache from the calling thread. If @a cache is not bound to the calling thread, this is a no-op.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to unbind.
+ */
+void plcrash_async_page_cache_unbind (plcrash_async_page_cache_t *cache) {
+    plcrash_async_thread_unbind(PLCRASH_ASYNC_BINDING_PAGE_CACHE, cache);
+}
+
+/**
+ * Return the page cache bound to the calling thread, if any.
+ *
+ * This function is async-safe.
+ *
+ * @return Returns the bound cache, or NULL if no cache is bound to the calling thread.
+ */
+plcrash_async_page_cache_t *plcrash_async_page_cache_bound (void) {
+    return plcrash_async_thread_bound(PLCRASH_ASYNC_BINDING_PAGE_CACHE);
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef PLCRASH_ASYNC_PAGE_CACHE_H
+#define PLCRASH_ASYNC_PAGE_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <mach/mach.h>
+
+#include "PLCrashAsync.h"
+
+/**
+ * @internal
+ * @ingroup plcrash_async
+ * @defgroup plcrash_async_page_cache Async-Safe Remote Page Cache
+ *
+ * Implements a fixed-capacity cache of target task pages, allowing the many small stack reads performed while
+ * unwinding to be satisfied without a kernel round-trip per read.
+ * @{
+ */
+
+/** The number of pages held by a plcrash_async_page_cache_t. */
+#define PLCRASH_ASYNC_PAGE_CACHE_PAGES 16
+
+/**
+ * @internal
+ *
+ * A single cached page.
+ */
+typedef struct plcrash_async_page_cache_entry {
+    /** The task from which the page was read, or MACH_PORT_NULL if the entry is unused. */
+    task_t task;
+
+    /** The page-aligned target address of the cached page. */
+    pl_vm_address_t address;
+
+    /** The value of the cache's use counter at the time of the entry's most recent use. */
+    uint64_t last_use;
+} plcrash_async_page_cache_entry_t;
+
+/**
+ * @internal
+ *
+ * A fixed-capacity, least-recently-used cache of pages read from a target task.
+ *
+ * The cache's contents are assumed to remain valid for the cache's lifetime; it should only be used to read memory
+ * that will not be modified while cached, such as the stacks of suspended threads. The cache is not thread-safe.
+ */
+typedef struct plcrash_async_page_cache {
+    /** The size of a cached page. */
+    pl_vm_size_t page_size;
+
+    /** Backing storage for PLCRASH_ASYNC_PAGE_CACHE_PAGES pages of @a page_size bytes, allocated via vm_allocate(). */
+    uint8_t *pages;
+
+    /** The cache entries; the entry at index n corresponds to the page at @a pages + (n * @a page_size). */
+    plcrash_async_page_cache_entry_t entries[PLCRASH_ASYNC_PAGE_CACHE_PAGES];
+
+    /** Monotonically increasing use counter, used to determine the least-recently-used entry. */
+    uint64_t use_counter;
+
+    /** The index of the most recently used entry. */
+    size_t last_entry;
+
+    /** The number of page reads satisfied by the cache. */
+    uint64_t hits;
+
+    /** The number of page reads that required a read from the target task. */
+    uint64_t misses;
+} plcrash_async_page_cache_t;
+
+plcrash_error_t plcrash_async_page_cache_init (plcrash_async_page_cache_t *cache);
+void plcrash_async_page_cache_reset (plcrash_async_page_cache_t *cache);
+void plcrash_async_page_cache_flush (plcrash_async_page_cache_t *cache);
+plcrash_error_t plcrash_async_page_cache_memcpy (plcrash_async_page_cache_t *cache, task_t task, pl_vm_address_t address, pl_vm_off_t offset, void *dest, pl_vm_size_t len);
+void plcrash_async_page_cache_get_stats (plcrash_async_page_cache_t *cache, uint64_t *hits, uint64_t *misses);
+void plcrash_async_page_cache_free (plcrash_async_page_cache_t *cache);
+
+bool plcrash_async_page_cache_bind (plcrash_async_page_cache_t *cache);
+void plcrash_async_page_cache_unbind (plcrash_async_page_cache_t *cache);
+plcrash_async_page_cache_t *plcrash_async_page_cache_bound (void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCRASH_ASYNC_PAGE_CACHE_H */
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+
+#include "PLCrashAsyncStringTable.h"
+
+/**
+ * @internal
+ * @ingroup plcrash_async_string_table
+ * @{
+ */
+
+/** The size of the storage allocated for a string table. */
+#define PLCRASH_ASYNC_STRING_TABLE_STORAGE_SIZE ((PLCRASH_ASYNC_STRING_TABLE_MAX_ENTRIES * sizeof(plcrash_async_string_table_entry_t)) + \
+    (PLCRASH_ASYNC_STRING_TABLE_BUCKETS * sizeof(uint32_t)) + PLCRASH_ASYNC_STRING_TABLE_DATA_SIZE)
+
+/**
+ * Initialize a new, empty string table, allocating its storage. Storage pages are zero-filled on first use, and
+ * so the cost of a table is proportional to the number of strings interned.
+ *
+ * This function is async-safe.
+ *
+ * @param table The table to initialize. The table must be freed via plcrash_async_string_table_free().
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or PLCRASH_ENOMEM if storage could not be allocated.
+ */
+plcrash_error_t plcrash_async_string_table_init (plcrash_async_string_table_t *table) {
+    table->count = 0;
+    table->data_length = 0;
+
+    vm_address_t storage;
+    kern_return_t kr = vm_allocate(mach_task_self(), &storage, (vm_size_t) PLCRASH_ASYNC_STRING_TABLE_STORAGE_SIZE, VM_FLAGS_ANYWHERE);
+    if (kr != KERN_SUCCESS) {
+        PLCF_DEBUG("vm_allocate failed for string table storage: %d", kr);
+        table->storage = NULL;
+        table->entries = NULL;
+        table->buckets = NULL;
+        table->data = NULL;
+        return PLCRASH_ENOMEM;
+    }
+
+    table->storage = (void *) storage;
+    table->entries = (plcrash_async_string_table_entry_t *) storage;
+    table->buckets = (uint32_t *) (table->entries + PLCRASH_ASYNC_STRING_TABLE_MAX_ENTRIES);
+    table->data = (char *) (table->buckets + PLCRASH_ASYNC_STRING_TABLE_BUCKETS);
+
+    return PLCRASH_ESUCCESS;
+}
+
+/**
+ * @internal
+ *
+ * Compute the hash of a (prefix, string) pair.
+ */
+static uint32_t plcrash_async_string_table_hash (uint32_t prefix, const char *str, size_t len) {
+    /* FNV-1a, seeded with the prefix index */
+    uint32_t hash = 2166136261U ^ prefix;
+    hash *= 16777619U;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t) str[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/**
+ * Return the index of the entry with the given @a prefix and string, adding a new entry if no such entry exists.
+ *
+ * This function is async-safe.
+ *
+ * @param table The string table.
+ * @param prefix The 1-based index of the entry's prefix entry, or 0 if none.
+ * @param str The entry's string. This need not be NUL-terminated, and must not contain NUL bytes.
+ * @param len The length of @a str.
+ *
+ * @return Returns the 1-based index of the entry, or 0 if the table's storage is unavailable or exhausted.
+ */
+uint32_t plcrash_async_string_table_intern (plcrash_async_string_table_t *table, uint32_t prefix, const char *str, size_t len) {
+    if (table->storage == NULL || prefix > table->count)
+        return 0;
+
+    uint32_t hash = plcrash_async_string_table_hash(prefix, str, len);
+    uint32_t bucket = hash & (PLCRASH_ASYNC_STRING_TABLE_BUCKETS - 1);
+
+    /* Search for an existing entry; the table is never more than half full, and so an unused bucket will be found */
+    while (table->buckets[bucket] != 0) {
+        uint32_t index = table->buckets[bucket];
+        plcrash_async_string_table_entry_t *entry = &table->entries[index - 1];
+
+        if (entry->hash == hash && entry->prefix == prefix && entry->length == len && plcrash_async_strncmp(table->data + entry->offset, str, len) == 0)
+            return index;
+
+        bucket = (bucket + 1) & (PLCRASH_ASYNC_STRING_TABLE_BUCKETS - 1);
+    }
+
+    /* Add a new entry, if space is available */
+    if (table->count == PLCRASH_ASYNC_STRING_TABLE_MAX_ENTRIES || PLCRASH_ASYNC_STRING_TABLE_DATA_SIZE - table->data_length < len + 1)
+        return 0;
+
+    plcrash_async_string_table_entry_t *entry = &table->entries[table->count];
+    entry->prefix = prefix;
+    entry->offset = (uint32_t) table->data_length;
+    entry->length = (uint32_t) len;
+    entry->hash = hash;
+
+    plcrash_async_memcpy(table->data + table->data_length, str, len);
+    table->data[table->data_length + len] = '\0';
+    table->data_length += len + 1;
+
+    table->count++;
+    table->buckets[bucket] = table->count;
+
+    return table->count;
+}
+
+/**
+ * Intern a file system path as a chain of entries, one per path component, each prefixed by the entry for its
+ * parent directory. Paths that share a directory prefix share the entries for that prefix.
+ *
+ * This function is async-safe.
+ *
+ * @param table The string table.
+ * @param path The NUL-terminated path to intern.
+ *
+ * @return Returns the 1-based index of the entry for the full path, or 0 if the path could not be interned.
+ */
+uint32_t plcrash_async_string_table_intern_path (plcrash_async_string_table_t *table, const char *path) {
+    uint32_t index = 0;
+    size_t start = 0;
+    size_t i;
+
+    for (i = 0; path[i] != '\0'; i++) {
+        /* Each directory component includes its trailing separator */
+        if (path[i] != '/')
+            continue;
+
+        if ((index = plcrash_async_string_table_intern(table, index, path + start, i + 1 - start)) == 0)
+            return 0;
+        start = i + 1;
+    }
+
+    /* The final component; a path ending in a separator is fully interned by the loop above, but the empty path
+     * must still be represented by an entry. */
+    if (start < i || i == 0)
+        index = plcrash_async_string_table_intern(table, index, path + start, i - start);
+
+    return index;
+}
+
+/**
+ * Return the number of entries in @a table.
+ *
+ * @param table The string table.
+ */
+uint32_t plcrash_async_string_table_count (plcrash_async_string_table_t *table) {
+    return table->count;
+}
+
+/**
+ * Fetch an entry from @a table.
+ *
+ * This function is async-safe.
+ *
+ * @param table The string table.
+ * @param index The 1-based index of the entry.
+ * @param prefix On return, the 1-based index of the entry's prefix entry, or 0 if none.
+ * @param length On return, the length of the entry's string.
+ *
+ * @return Returns the entry's NUL-terminated string, excluding the value of its prefix entry, or NULL if @a index
+ * is not a valid entry index.
+ */
+const char *plcrash_async_string_table_get (plcrash_async_string_table_t *table, uint32_t index, uint32_t *prefix, size_t *length) {
+    if (index == 0 || index > table->count)
+        return NULL;
+
+    plcrash_async_string_table_entry_t *entry = &table->entries[index - 1];
+    *prefix = entry->prefix;
+    *length = entry->length;
+    return table->data + entry->offset;
+}
+
+/**
+ * Free all storage associated with @a table.
+ *
+ * This function is async-safe.
+ *
+ * @param table The table to free.
+ */
+void plcrash_async_string_table_free (plcrash_async_string_table_t *table) {
+    if (table->storage != NULL) {
+        vm_deallocate(mach_task_self(), (vm_address_t) table->storage, (vm_size_t) PLCRASH_ASYNC_STRING_TABLE_STORAGE_SIZE);
+        table->storage = NULL;
+    }
+}
+
+/**
+ * @}
+ */
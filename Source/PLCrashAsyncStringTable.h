@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+
+#ifndef PLCRASH_ASYNC_STRING_TABLE_H
+#define PLCRASH_ASYNC_STRING_TABLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "PLCrashAsync.h"
+
+/**
+ * @internal
+ * @ingroup plcrash_async
+ * @defgroup plcrash_async_string_table Async-Safe String Interning
+ *
+ * Implements a fixed-capacity table of interned strings, allowing strings that recur within a crash report (such as
+ * symbol names and image path prefixes) to be written once and referenced by index.
+ * @{
+ */
+
+/** The maximum number of entries that may be held by a plcrash_async_string_table_t. */
+#define PLCRASH_ASYNC_STRING_TABLE_MAX_ENTRIES 16384
+
+/** The number of hash buckets in a plcrash_async_string_table_t. Must be a power of two. */
+#define PLCRASH_ASYNC_STRING_TABLE_BUCKETS (PLCRASH_ASYNC_STRING_TABLE_MAX_ENTRIES * 2)
+
+/** The number of bytes available for string data in a plcrash_async_string_table_t. */
+#define PLCRASH_ASYNC_STRING_TABLE_DATA_SIZE (512 * 1024)
+
+/**
+ * @internal
+ *
+ * A string table entry. An entry's value is the value of its prefix entry (if any), followed by its own string.
+ */
+typedef struct plcrash_async_string_table_entry {
+    /** The 1-based index of the entry's prefix entry, or 0 if none. */
+    uint32_t prefix;
+
+    /** The offset of the entry's NUL-terminated string within the table's string data. */
+    uint32_t offset;
+
+    /** The length of the entry's string, excluding the trailing NUL. */
+    uint32_t length;
+
+    /** The entry's hash value. */
+    uint32_t hash;
+} plcrash_async_string_table_entry_t;
+
+/**
+ * @internal
+ *
+ * A fixed-capacity table of interned strings, indexed from 1 in the order in which they were interned. Entries are
+ * never removed. The table is not thread-safe.
+ */
+typedef struct plcrash_async_string_table {
+    /** Backing storage for the entries, hash buckets, and string data, allocated via vm_allocate(). */
+    void *storage;
+
+    /** The table entries; the entry with index n is at entries[n - 1]. */
+    plcrash_async_string_table_entry_t *entries;
+
+    /** Open-addressed hash buckets, each holding an entry index, or 0 if unused. */
+    uint32_t *buckets;
+
+    /** NUL-terminated entry strings. */
+    char *data;
+
+    /** The number of entries. */
+    uint32_t count;
+
+    /** The number of bytes of @a data in use. */
+    size_t data_length;
+} plcrash_async_string_table_t;
+
+plcrash_error_t plcrash_async_string_table_init (plcrash_async_string_table_t *table);
+uint32_t plcrash_async_string_table_intern (plcrash_async_string_table_t *table, uint32_t prefix, const char *str, size_t len);
+uint32_t plcrash_async_string_table_intern_path (plcrash_async_string_table_t *table, const char *path);
+uint32_t plcrash_async_string_table_count (plcrash_async_string_table_t *table);
+const char *plcrash_async_string_table_get (plcrash_async_string_table_t *table, uint32_t index, uint32_t *prefix, size_t *length);
+void plcrash_async_string_table_free (plcrash_async_string_table_t *table);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCRASH_ASYNC_STRING_TABLE_H */
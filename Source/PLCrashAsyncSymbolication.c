@@ -29,6 +29,7 @@
 #include "PLCrashAsyncSymbolication.h"
 
 #include <inttypes.h>
+#include <string.h>
 
 /**
  * @internal
@@ -60,18 +61,216 @@ static void objc_symbol_callback (bool isClassMethod, plcrash_async_macho_string
  * @return An error code.
  */
 plcrash_error_t plcrash_async_symbol_cache_init (plcrash_async_symbol_cache_t *cache) {
+    cache->entries = NULL;
+    cache->names = NULL;
+    cache->names_length = 0;
+    cache->entries_failed = false;
+    cache->hits = 0;
+    cache->misses = 0;
+
     return plcrash_async_objc_cache_init(&cache->objc_cache);
 }
 
+/**
+ * @internal
+ *
+ * Return the total size of the PC lookup table allocation, including name storage.
+ */
+static size_t symbol_cache_allocation_size (void) {
+    return (sizeof(plcrash_async_symbol_cache_entry_t) * PLCRASH_ASYNC_SYMBOL_CACHE_ENTRIES) + PLCRASH_ASYNC_SYMBOL_CACHE_NAME_BYTES;
+}
+
+/**
+ * @internal
+ *
+ * Allocate the PC lookup table, if not already allocated.
+ *
+ * @return Returns true if the table is available, or false if it could not be allocated.
+ */
+static bool symbol_cache_allocate (plcrash_async_symbol_cache_t *cache) {
+    if (cache->entries != NULL)
+        return true;
+
+    if (cache->entries_failed)
+        return false;
+
+    /* vm_allocate() is used, as malloc is not async-safe */
+    vm_address_t addr;
+    kern_return_t kr = vm_allocate(mach_task_self(), &addr, symbol_cache_allocation_size(), VM_FLAGS_ANYWHERE);
+    if (kr != KERN_SUCCESS) {
+        PLCF_DEBUG("vm_allocate failed with error %x, the symbol cache could not be initialized", kr);
+        cache->entries_failed = true;
+        return false;
+    }
+
+    /* vm_allocate() returns zero-filled pages; all entries are initially unused */
+    cache->entries = (plcrash_async_symbol_cache_entry_t *) addr;
+    cache->names = (char *) (cache->entries + PLCRASH_ASYNC_SYMBOL_CACHE_ENTRIES);
+    cache->names_length = 0;
+    return true;
+}
+
+/**
+ * Allocate the PC lookup table of @a cache ahead of time. By default, the table is allocated on first use; this
+ * allows a cache that will be used at crash time to be allocated while the process is still in a known-good state.
+ *
+ * @param cache The cache for which the lookup table should be allocated.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or PLCRASH_ENOMEM if the table could not be allocated.
+ */
+plcrash_error_t plcrash_async_symbol_cache_preallocate (plcrash_async_symbol_cache_t *cache) {
+    if (!symbol_cache_allocate(cache))
+        return PLCRASH_ENOMEM;
+
+    return PLCRASH_ESUCCESS;
+}
+
+/**
+ * Discard all cached lookup results and reset the cache's statistics, retaining the PC lookup table storage. This
+ * allows a cache allocated ahead of time to be reused for each report.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to reset.
+ */
+void plcrash_async_symbol_cache_reset (plcrash_async_symbol_cache_t *cache) {
+    if (cache->entries != NULL) {
+        for (size_t i = 0; i < PLCRASH_ASYNC_SYMBOL_CACHE_ENTRIES; i++)
+            cache->entries[i].pc = 0x0;
+    }
+
+    cache->names_length = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+
+    plcrash_async_objc_cache_free(&cache->objc_cache);
+    plcrash_async_objc_cache_init(&cache->objc_cache);
+}
+
+/**
+ * Fetch the PC lookup table statistics for @a cache. This may be used to evaluate the effectiveness of the cache
+ * for diagnostic purposes.
+ *
+ * @param cache The cache to query.
+ * @param hits On return, the number of lookups satisfied by the cache.
+ * @param misses On return, the number of lookups that required a full symbol search.
+ */
+void plcrash_async_symbol_cache_get_stats (plcrash_async_symbol_cache_t *cache, uint64_t *hits, uint64_t *misses) {
+    *hits = cache->hits;
+    *misses = cache->misses;
+}
+
 /**
  * Free a symbol-finding context object.
  *
  * @param cache A pointer to the cache object to free.
  */
 void plcrash_async_symbol_cache_free (plcrash_async_symbol_cache_t *cache) {
+    PLCF_DEBUG("Symbol cache: %" PRIu64 " hits, %" PRIu64 " misses", cache->hits, cache->misses);
+
+    if (cache->entries != NULL)
+        vm_deallocate(mach_task_self(), (vm_address_t) cache->entries, symbol_cache_allocation_size());
+
+    cache->entries = NULL;
+    cache->names = NULL;
+
     plcrash_async_objc_cache_free(&cache->objc_cache);
 }
 
+/**
+ * @internal
+ *
+ * Return the initial PC lookup table index for @a pc.
+ */
+static inline size_t symbol_cache_index (pl_vm_address_t pc) {
+    /* Fibonacci hashing; instruction addresses are frequently aligned, and the low bits are poorly distributed */
+    return (size_t) ((((uint64_t) pc) * 0x9E3779B97F4A7C15ULL) >> 32) & (PLCRASH_ASYNC_SYMBOL_CACHE_ENTRIES - 1);
+}
+
+/**
+ * @internal
+ * The maximum number of entries that will be probed for a given PC.
+ */
+#define SYMBOL_CACHE_MAX_PROBES 8
+
+/**
+ * @internal
+ *
+ * Look up @a pc within the PC lookup table.
+ *
+ * @return Returns the matching entry, or NULL if not found.
+ */
+static const plcrash_async_symbol_cache_entry_t *symbol_cache_lookup (plcrash_async_symbol_cache_t *cache, plcrash_async_symbol_strategy_t strategy, pl_vm_address_t pc) {
+    if (cache->entries == NULL || pc == 0x0)
+        return NULL;
+
+    size_t idx = symbol_cache_index(pc);
+    for (size_t i = 0; i < SYMBOL_CACHE_MAX_PROBES; i++) {
+        const plcrash_async_symbol_cache_entry_t *entry = &cache->entries[(idx + i) & (PLCRASH_ASYNC_SYMBOL_CACHE_ENTRIES - 1)];
+        if (entry->pc == 0x0)
+            return NULL;
+
+        if (entry->pc == pc && entry->strategy == strategy)
+            return entry;
+    }
+
+    return NULL;
+}
+
+/**
+ * @internal
+ *
+ * Record a lookup result in the PC lookup table. The table is a cache; if no free entry is available, or the name
+ * storage is exhausted, the result will not be recorded.
+ *
+ * @param cache The cache.
+ * @param strategy The strategy used for the lookup.
+ * @param pc The PC that was looked up.
+ * @param result The lookup result.
+ * @param symbol_address The symbol address, if @a result is PLCRASH_ESUCCESS.
+ * @param name The NUL-terminated symbol name, if @a result is PLCRASH_ESUCCESS.
+ */
+static void symbol_cache_insert (plcrash_async_symbol_cache_t *cache, plcrash_async_symbol_strategy_t strategy, pl_vm_address_t pc, plcrash_error_t result, pl_vm_address_t symbol_address, const char *name) {
+    if (pc == 0x0)
+        return;
+
+    /* Allocate the table on first use, unless preallocated via plcrash_async_symbol_cache_preallocate() */
+    if (!symbol_cache_allocate(cache))
+        return;
+
+    /* Find a free entry */
+    plcrash_async_symbol_cache_entry_t *entry = NULL;
+    size_t idx = symbol_cache_index(pc);
+    for (size_t i = 0; i < SYMBOL_CACHE_MAX_PROBES; i++) {
+        plcrash_async_symbol_cache_entry_t *candidate = &cache->entries[(idx + i) & (PLCRASH_ASYNC_SYMBOL_CACHE_ENTRIES - 1)];
+        if (candidate->pc == 0x0) {
+            entry = candidate;
+            break;
+        }
+    }
+
+    if (entry == NULL)
+        return;
+
+    /* Copy the name */
+    uint32_t name_offset = 0;
+    if (result == PLCRASH_ESUCCESS) {
+        size_t name_length = strlen(name) + 1;
+        if (name_length > PLCRASH_ASYNC_SYMBOL_CACHE_NAME_BYTES - cache->names_length)
+            return;
+
+        name_offset = (uint32_t) cache->names_length;
+        plcrash_async_memcpy(cache->names + name_offset, name, name_length);
+        cache->names_length += name_length;
+    }
+
+    entry->symbol_address = symbol_address;
+    entry->result = result;
+    entry->strategy = strategy;
+    entry->name_offset = name_offset;
+    entry->pc = pc;
+}
+
 /**
  * Find the best-guess matching symbol name for a given @a pc address, using heuristics based on symbol and @a pc address locality.
  *
@@ -96,6 +295,18 @@ plcrash_error_t plcrash_async_find_symbol (plcrash_async_macho_t *image,
     plcrash_error_t machoErr = PLCRASH_ENOTFOUND;
     plcrash_error_t objcErr = PLCRASH_ENOTFOUND;
 
+    /* Check for a previous lookup of the same PC; the same frames frequently appear across many threads. */
+    const plcrash_async_symbol_cache_entry_t *entry = symbol_cache_lookup(cache, strategy, pc);
+    if (entry != NULL) {
+        cache->hits++;
+
+        if (entry->result == PLCRASH_ESUCCESS)
+            callback(entry->symbol_address, cache->names + entry->name_offset, ctx);
+
+        return entry->result;
+    }
+    cache->misses++;
+
     lookup_ctx.symbol_address = 0x0;
     lookup_ctx.found = false;
 
@@ -109,6 +320,7 @@ plcrash_error_t plcrash_async_find_symbol (plcrash_async_macho_t *image,
 
     if (machoErr != PLCRASH_ESUCCESS && objcErr != PLCRASH_ESUCCESS) {
         PLCF_DEBUG("Could not find symbol for pc 0x%" PRIx64 " in %s", (uint64_t) pc, PLCF_DEBUG_IMAGE_NAME(image));
+        symbol_cache_insert(cache, strategy, pc, PLCRASH_ENOTFOUND, 0x0, NULL);
         return PLCRASH_ENOTFOUND;
     }
 
@@ -116,9 +328,12 @@ plcrash_error_t plcrash_async_find_symbol (plcrash_async_macho_t *image,
      * logged a debug message, not set 'found' */
     if (!lookup_ctx.found) {
         PLCF_DEBUG("Unexpected error occured in symbol lookup callbacks for pc %" PRIx64 " in %s", (uint64_t) pc, PLCF_DEBUG_IMAGE_NAME(image));
+        symbol_cache_insert(cache, strategy, pc, PLCRASH_EINTERNAL, 0x0, NULL);
         return PLCRASH_EINTERNAL;
     }
 
+    symbol_cache_insert(cache, strategy, pc, PLCRASH_ESUCCESS, lookup_ctx.symbol_address, lookup_ctx.buffer);
+
     callback(lookup_ctx.symbol_address, lookup_ctx.buffer, ctx);
     return PLCRASH_ESUCCESS;
 }
@@ -78,6 +78,42 @@ typedef enum {
     PLCRASH_ASYNC_SYMBOL_STRATEGY_ALL = (PLCRASH_ASYNC_SYMBOL_STRATEGY_SYMBOL_TABLE|PLCRASH_ASYNC_SYMBOL_STRATEGY_OBJC)
 } plcrash_async_symbol_strategy_t;
 
+/**
+ * @internal
+ *
+ * The number of entries in a plcrash_async_symbol_cache_t PC lookup table. Must be a power of two.
+ */
+#define PLCRASH_ASYNC_SYMBOL_CACHE_ENTRIES 1024
+
+/**
+ * @internal
+ *
+ * The number of bytes reserved for symbol names within a plcrash_async_symbol_cache_t PC lookup table.
+ */
+#define PLCRASH_ASYNC_SYMBOL_CACHE_NAME_BYTES (64 * 1024)
+
+/**
+ * @internal
+ *
+ * A cached symbol lookup result.
+ */
+typedef struct plcrash_async_symbol_cache_entry {
+    /** The PC for which the symbol was looked up, or 0x0 if this entry is unused. */
+    pl_vm_address_t pc;
+
+    /** The start address of the symbol. Only valid if @a result is PLCRASH_ESUCCESS. */
+    pl_vm_address_t symbol_address;
+
+    /** The lookup result. */
+    plcrash_error_t result;
+
+    /** The strategy with which the lookup was performed. */
+    plcrash_async_symbol_strategy_t strategy;
+
+    /** The offset of the NUL-terminated symbol name within the cache's name storage. Only valid if @a result is PLCRASH_ESUCCESS. */
+    uint32_t name_offset;
+} plcrash_async_symbol_cache_entry_t;
+
 /**
  * @internal
  *
@@ -90,9 +126,34 @@ typedef enum {
 typedef struct plcrash_async_symbol_cache {
     /** Objective-C look-up cache. */
     plcrash_async_objc_cache_t objc_cache;
+
+    /**
+     * Open-addressed PC lookup table of PLCRASH_ASYNC_SYMBOL_CACHE_ENTRIES entries, or NULL if not yet allocated. The
+     * table and its name storage are allocated as a single fixed-size region on first use, or ahead of time via
+     * plcrash_async_symbol_cache_preallocate().
+     */
+    plcrash_async_symbol_cache_entry_t *entries;
+
+    /** Symbol name storage, of PLCRASH_ASYNC_SYMBOL_CACHE_NAME_BYTES bytes. */
+    char *names;
+
+    /** The number of bytes of @a names in use. */
+    size_t names_length;
+
+    /** If true, allocation of the lookup table failed, and should not be retried. */
+    bool entries_failed;
+
+    /** The number of lookups satisfied by the PC lookup table. */
+    uint64_t hits;
+
+    /** The number of lookups not satisfied by the PC lookup table. */
+    uint64_t misses;
 } plcrash_async_symbol_cache_t;
 
 plcrash_error_t plcrash_async_symbol_cache_init (plcrash_async_symbol_cache_t *cache);
+plcrash_error_t plcrash_async_symbol_cache_preallocate (plcrash_async_symbol_cache_t *cache);
+void plcrash_async_symbol_cache_reset (plcrash_async_symbol_cache_t *cache);
+void plcrash_async_symbol_cache_get_stats (plcrash_async_symbol_cache_t *cache, uint64_t *hits, uint64_t *misses);
 void plcrash_async_symbol_cache_free (plcrash_async_symbol_cache_t *cache);
 
 
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "PLCrashAsyncThreadBinding.h"
+#include "PLCrashAsync.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+/**
+ * @internal
+ * @ingroup plcrash_async_thread_binding
+ * @{
+ */
+
+/**
+ * @internal
+ *
+ * The value of plcrash_async_thread_binding_t::thread while a slot is being populated. This is never a valid
+ * pthread_t, and so a claimed slot will not be matched by any thread until its binding has been published.
+ */
+#define PLCRASH_ASYNC_THREAD_BINDING_CLAIMED UINTPTR_MAX
+
+/**
+ * @internal
+ *
+ * A single thread binding.
+ */
+typedef struct plcrash_async_thread_binding {
+    /** The bound thread, 0 if the slot is unused, or PLCRASH_ASYNC_THREAD_BINDING_CLAIMED while the binding is
+     * being populated. */
+    _Atomic(uintptr_t) thread;
+
+    /** The binding type. This is only read by the bound thread. */
+    plcrash_async_binding_type_t type;
+
+    /** The bound value. This is only read by the bound thread. */
+    void *value;
+
+    /** The order in which the binding was published; a binding shadows any earlier binding of the same type. */
+    uint64_t sequence;
+} plcrash_async_thread_binding_t;
+
+/** Active thread bindings. */
+static plcrash_async_thread_binding_t thread_bindings[PLCRASH_ASYNC_THREAD_BINDING_MAX];
+
+/** The number of active thread bindings, allowing lookups to return without scanning when no bindings exist. */
+static atomic_uint thread_binding_count = 0;
+
+/** The sequence number assigned to the most recently published binding. */
+static _Atomic(uint64_t) thread_binding_sequence = 0;
+
+/**
+ * @internal
+ *
+ * Return the most recently published binding of @a type for @a thread, optionally restricted to bindings of
+ * @a value.
+ *
+ * @param thread The bound thread.
+ * @param type The binding type.
+ * @param match_value If true, only bindings of @a value will be returned.
+ * @param value The bound value to match, if @a match_value is true.
+ */
+static plcrash_async_thread_binding_t *plcrash_async_thread_binding_find (uintptr_t thread, plcrash_async_binding_type_t type, bool match_value, void *value) {
+    plcrash_async_thread_binding_t *result = NULL;
+
+    for (size_t i = 0; i < PLCRASH_ASYNC_THREAD_BINDING_MAX; i++) {
+        plcrash_async_thread_binding_t *binding = &thread_bindings[i];
+        if (atomic_load_explicit(&binding->thread, memory_order_acquire) != thread || binding->type != type)
+            continue;
+
+        if (match_value && binding->value != value)
+            continue;
+
+        if (result == NULL || binding->sequence > result->sequence)
+            result = binding;
+    }
+
+    return result;
+}
+
+/**
+ * Bind @a value to the calling thread. Until unbound, plcrash_async_thread_bound() will return @a value when called
+ * from the calling thread with the given @a type.
+ *
+ * Bindings of the same type nest; the most recent binding shadows any earlier binding until it is unbound. This
+ * ensures that a report written while another report is in progress on the same thread -- such as a crash
+ * report triggered while generating a live report -- never observes the interrupted report's state.
+ *
+ * This function is async-safe.
+ *
+ * @param type The binding type.
+ * @param value The value to be bound. The value must not already be bound to the calling thread.
+ *
+ * @return Returns true on success, or false if @a value is already bound to the calling thread with the given
+ * @a type, or the maximum number of concurrent bindings has been reached.
+ */
+bool plcrash_async_thread_bind (plcrash_async_binding_type_t type, void *value) {
+    uintptr_t self = (uintptr_t) pthread_self();
+
+    /* A value bound twice would remain visible after being unbound by its inner binding */
+    if (plcrash_async_thread_binding_find(self, type, true, value) != NULL) {
+        PLCF_DEBUG("Value is already bound to the calling thread");
+        return false;
+    }
+
+    for (size_t i = 0; i < PLCRASH_ASYNC_THREAD_BINDING_MAX; i++) {
+        plcrash_async_thread_binding_t *binding = &thread_bindings[i];
+        uintptr_t expected = 0;
+
+        if (atomic_load_explicit(&binding->thread, memory_order_relaxed) != 0)
+            continue;
+
+        if (!atomic_compare_exchange_strong(&binding->thread, &expected, PLCRASH_ASYNC_THREAD_BINDING_CLAIMED))
+            continue;
+
+        /* Populate the binding prior to publishing it; a signal handler running on this thread may perform a
+         * lookup at any point. */
+        binding->type = type;
+        binding->value = value;
+        binding->sequence = atomic_fetch_add(&thread_binding_sequence, 1) + 1;
+        atomic_fetch_add(&thread_binding_count, 1);
+        atomic_store_explicit(&binding->thread, self, memory_order_release);
+        return true;
+    }
+
+    PLCF_DEBUG("Exceeded the maximum number of thread bindings");
+    return false;
+}
+
+/**
+ * Remove the calling thread's binding of @a value. If @a value is not bound to the calling thread, this is a no-op.
+ *
+ * This function is async-safe.
+ *
+ * @param type The binding type.
+ * @param value The bound value.
+ */
+void plcrash_async_thread_unbind (plcrash_async_binding_type_t type, void *value) {
+    plcrash_async_thread_binding_t *binding = plcrash_async_thread_binding_find((uintptr_t) pthread_self(), type, true, value);
+    if (binding == NULL)
+        return;
+
+    /* Unpublish the binding prior to releasing the slot */
+    atomic_store_explicit(&binding->thread, PLCRASH_ASYNC_THREAD_BINDING_CLAIMED, memory_order_release);
+    binding->value = NULL;
+    atomic_fetch_sub(&thread_binding_count, 1);
+    atomic_store_explicit(&binding->thread, 0, memory_order_release);
+}
+
+/**
+ * Return the most recently bound value of the given @a type bound to the calling thread, if any.
+ *
+ * This function is async-safe.
+ *
+ * @param type The binding type.
+ *
+ * @return Returns the bound value, or NULL if no value of @a type is bound to the calling thread.
+ */
+void *plcrash_async_thread_bound (plcrash_async_binding_type_t type) {
+    if (atomic_load_explicit(&thread_binding_count, memory_order_relaxed) == 0)
+        return NULL;
+
+    plcrash_async_thread_binding_t *binding = plcrash_async_thread_binding_find((uintptr_t) pthread_self(), type, false, NULL);
+    if (binding == NULL)
+        return NULL;
+
+    return binding->value;
+}
+
+/**
+ * @}
+ */
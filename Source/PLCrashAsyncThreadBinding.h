@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef PLCRASH_ASYNC_THREAD_BINDING_H
+#define PLCRASH_ASYNC_THREAD_BINDING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+/**
+ * @internal
+ * @ingroup plcrash_async
+ * @defgroup plcrash_async_thread_binding Async-Safe Thread Bindings
+ *
+ * Associates per-thread state, such as report-scoped caches, with the calling thread. This allows low-level
+ * async-safe primitives to consult state owned by a higher-level caller without threading that state through
+ * every intermediate API.
+ * @{
+ */
+
+/**
+ * @internal
+ *
+ * Supported thread binding types. A thread may have multiple bindings of the same type, in which case the most
+ * recent binding is used.
+ */
+typedef enum {
+    /** A plcrash_async_page_cache_t. */
+    PLCRASH_ASYNC_BINDING_PAGE_CACHE = 0,
+
+    /** A plcrash_async_mapping_cache_t. */
+    PLCRASH_ASYNC_BINDING_MAPPING_CACHE = 1,
+
+    /** A plframe_unwind_plan_cache_t. */
+    PLCRASH_ASYNC_BINDING_UNWIND_PLAN_CACHE = 2,
+} plcrash_async_binding_type_t;
+
+/** The maximum number of bindings that may be concurrently active across all threads. */
+#define PLCRASH_ASYNC_THREAD_BINDING_MAX 64
+
+bool plcrash_async_thread_bind (plcrash_async_binding_type_t type, void *value);
+void plcrash_async_thread_unbind (plcrash_async_binding_type_t type, void *value);
+void *plcrash_async_thread_bound (plcrash_async_binding_type_t type);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCRASH_ASYNC_THREAD_BINDING_H */
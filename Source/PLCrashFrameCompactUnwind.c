@@ -26,13 +26,99 @@
 
 
 #include "PLCrashFrameCompactUnwind.h"
+#include "PLCrashFrameDWARFUnwind.h"
+#include "PLCrashFrameUnwindPlan.h"
 #include "PLCrashAsyncCompactUnwindEncoding.h"
 #include "PLCrashFeatureConfig.h"
 
 #include <inttypes.h>
+#include <stdlib.h>
 
 #if PLCRASH_FEATURE_UNWIND_DWARF
 
+/**
+ * @internal
+ *
+ * Persistent per-image compact unwind state. The image's __unwind_info section is mapped once, and the CFE reader
+ * initialized against it, allowing per-frame lookups to proceed directly to the two-level binary search.
+ */
+struct plframe_compact_unwind_context {
+    /** The mapped __unwind_info section. */
+    plcrash_async_mobject_t section;
+
+    /** A CFE reader backed by @a section. */
+    plcrash_async_cfe_reader_t reader;
+};
+
+/**
+ * @internal
+ *
+ * Map the __unwind_info section from @a image.
+ *
+ * @param image The image from which the __unwind_info section should be mapped.
+ * @param mobj On success, will be initialized with the section mapping. The caller is responsible for
+ * freeing the mapping via plcrash_async_mobject_free().
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, PLCRASH_ENOTFOUND if the image has no __unwind_info section, or
+ * another plcrash_error_t error code if the section could not be mapped.
+ */
+static plcrash_error_t plframe_compact_unwind_map_section (plcrash_async_macho_t *image, plcrash_async_mobject_t *mobj) {
+    plcrash_error_t err = plcrash_async_macho_map_section(image, SEG_TEXT, "__unwind_info", mobj);
+    if (err != PLCRASH_ESUCCESS && err != PLCRASH_ENOTFOUND)
+        PLCF_DEBUG("Could not map the compact unwind info section for image %s: %d", image->name, err);
+
+    return err;
+}
+
+/**
+ * Create a persistent compact unwind context for @a image, mapping the image's __unwind_info section and initializing
+ * a CFE reader. The context may be supplied to plframe_cursor_read_compact_unwind() via the image's plcrash_async_image_t
+ * record.
+ *
+ * @param image The image for which a context should be created.
+ *
+ * @return Returns the new context, or NULL if the image contains no compact unwind data, or the context could not
+ * be created. The context must be freed via plframe_nasync_compact_unwind_context_free().
+ *
+ * @warning This method is not async safe.
+ */
+plframe_compact_unwind_context_t *plframe_nasync_compact_unwind_context_new (plcrash_async_macho_t *image) {
+    plframe_compact_unwind_context_t *context = malloc(sizeof(*context));
+    plcrash_error_t err;
+
+    if (context == NULL)
+        return NULL;
+
+    /* The lack of __unwind_info is not an error */
+    if (plframe_compact_unwind_map_section(image, &context->section) != PLCRASH_ESUCCESS) {
+        free(context);
+        return NULL;
+    }
+
+    cpu_type_t cputype = image->byteorder->swap32(image->header.cputype);
+    if ((err = plcrash_async_cfe_reader_init(&context->reader, &context->section, cputype)) != PLCRASH_ESUCCESS) {
+        PLCF_DEBUG("Could not parse the compact unwind info section for image '%s': %d", image->name, err);
+        plcrash_async_mobject_free(&context->section);
+        free(context);
+        return NULL;
+    }
+
+    return context;
+}
+
+/**
+ * Free all resources associated with @a context.
+ *
+ * @param context The context to be freed.
+ *
+ * @warning This method is not async safe.
+ */
+void plframe_nasync_compact_unwind_context_free (plframe_compact_unwind_context_t *context) {
+    plcrash_async_cfe_reader_free(&context->reader);
+    plcrash_async_mobject_free(&context->section);
+    free(context);
+}
+
 /**
  * Attempt to fetch next frame using compact frame unwinding data from @a image_list.
  *
@@ -72,36 +158,97 @@ plframe_error_t plframe_cursor_read_compact_unwind (task_t task,
         goto cleanup;
     }
     
-    /* Map the unwind section */
-    plcrash_async_mobject_t unwind_mobj;
-    err = plcrash_async_macho_map_section(&image->macho_image, SEG_TEXT, "__unwind_info", &unwind_mobj);
-    if (err != PLCRASH_ESUCCESS) {
-        if (err != PLCRASH_ENOTFOUND)
-            PLCF_DEBUG("Could not map the compact unwind info section for image %s: %d", image->macho_image.name, err);
+    /* Skip images known to lack compact unwind data */
+    plframe_unwind_plan_cache_t *plan_cache = plframe_unwind_plan_cache_bound();
+    if (plcrash_async_image_reader_unsupported(image, PLCRASH_ASYNC_IMAGE_READER_COMPACT_UNWIND)) {
+        if (plan_cache != NULL)
+            plframe_unwind_plan_cache_note_skipped(plan_cache);
         result = PLFRAME_ENOTSUP;
         goto cleanup;
     }
 
-    /* Initialize the CFE reader. */
+    /* Find the encoding entry (if any), using a cached plan or the image's persistent reader if available */
     cpu_type_t cputype = image->macho_image.byteorder->swap32(image->macho_image.header.cputype);
-    plcrash_async_cfe_reader_t reader;
+    pl_vm_address_t function_base;
+    pl_vm_address_t function_end = 0;
+    uint32_t encoding;
 
-    err = plcrash_async_cfe_reader_init(&reader, &unwind_mobj, cputype);
-    if (err != PLCRASH_ESUCCESS) {
-        PLCF_DEBUG("Could not parse the compact unwind info section for image '%s': %d", image->macho_image.name, err);
-        result = PLFRAME_EINVAL;
-        goto cleanup_mobject;
+    const plframe_unwind_plan_t *cached_plan = NULL;
+    if (plan_cache != NULL) {
+        cached_plan = plframe_unwind_plan_cache_lookup(plan_cache, task, (pl_vm_address_t) pc, PLFRAME_UNWIND_PLAN_TYPE_COMPACT);
+
+        /* Skip PCs previously found to have no entry */
+        if (cached_plan == NULL && plframe_unwind_plan_cache_lookup(plan_cache, task, (pl_vm_address_t) pc, PLFRAME_UNWIND_PLAN_TYPE_COMPACT_NONE) != NULL) {
+            plframe_unwind_plan_cache_note_skipped(plan_cache);
+            result = PLFRAME_ENOTSUP;
+            goto cleanup;
+        }
+    }
+
+    plframe_compact_unwind_context_t *context = image->compact_unwind;
+    if (cached_plan != NULL) {
+        function_base = cached_plan->compact.function_base;
+        encoding = cached_plan->compact.encoding;
+        err = PLCRASH_ESUCCESS;
+    } else if (context != NULL) {
+        err = plcrash_async_cfe_reader_find_pc(&context->reader, (pl_vm_address_t)(pc - image->macho_image.header_addr), &function_base, &function_end, &encoding);
+    } else {
+        plcrash_async_mobject_t unwind_mobj;
+        plcrash_async_cfe_reader_t reader;
+
+        /* Map the unwind section; if the image has none, record that for subsequent frames */
+        if ((err = plframe_compact_unwind_map_section(&image->macho_image, &unwind_mobj)) != PLCRASH_ESUCCESS) {
+            if (err == PLCRASH_ENOTFOUND)
+                plcrash_async_image_set_reader_unsupported(image, PLCRASH_ASYNC_IMAGE_READER_COMPACT_UNWIND);
+            result = PLFRAME_ENOTSUP;
+            goto cleanup;
+        }
+
+        /* Initialize the CFE reader. */
+        err = plcrash_async_cfe_reader_init(&reader, &unwind_mobj, cputype);
+        if (err != PLCRASH_ESUCCESS) {
+            PLCF_DEBUG("Could not parse the compact unwind info section for image '%s': %d", image->macho_image.name, err);
+            plcrash_async_mobject_free(&unwind_mobj);
+            result = PLFRAME_EINVAL;
+            goto cleanup;
+        }
+
+        err = plcrash_async_cfe_reader_find_pc(&reader, (pl_vm_address_t)(pc - image->macho_image.header_addr), &function_base, &function_end, &encoding);
+        plcrash_async_cfe_reader_free(&reader);
+        plcrash_async_mobject_free(&unwind_mobj);
     }
 
-    /* Find the encoding entry (if any) and free the reader */
-    pl_vm_address_t function_base;
-    uint32_t encoding;
-    err = plcrash_async_cfe_reader_find_pc(&reader, (pl_vm_address_t)(pc - image->macho_image.header_addr), &function_base, &encoding);
-    plcrash_async_cfe_reader_free(&reader);
     if (err != PLCRASH_ESUCCESS) {
         PLCF_DEBUG("Did not find CFE entry for PC 0x%" PRIx64 ": %d", (uint64_t) pc, err);
+
+        /* Record the negative result for subsequent visits to this PC */
+        if (plan_cache != NULL && err == PLCRASH_ENOTFOUND) {
+            plframe_unwind_plan_t plan;
+            plcrash_async_memset(&plan, 0, sizeof(plan));
+            plan.type = PLFRAME_UNWIND_PLAN_TYPE_COMPACT_NONE;
+            plframe_unwind_plan_cache_insert(plan_cache, task, (pl_vm_address_t) pc, (pl_vm_address_t) pc + 1, &plan);
+        }
+
         result = PLFRAME_ENOTSUP;
-        goto cleanup_mobject;
+        goto cleanup;
+    }
+
+    /* Cache the result for all PCs within the entry's function. The encoding describes the entire function, and any
+     * other return address within it -- eg, recursive calls -- may share the plan. */
+    if (plan_cache != NULL && cached_plan == NULL) {
+        plframe_unwind_plan_t plan;
+        plan.type = PLFRAME_UNWIND_PLAN_TYPE_COMPACT;
+        plan.compact.function_base = function_base;
+        plan.compact.encoding = encoding;
+
+        pl_vm_address_t range_start = (pl_vm_address_t) image->macho_image.header_addr + function_base;
+        pl_vm_address_t range_end = (pl_vm_address_t) image->macho_image.header_addr + function_end;
+        if (range_start > pc || range_end <= pc) {
+            /* Malformed entry table; restrict the plan to this PC */
+            range_start = (pl_vm_address_t) pc;
+            range_end = (pl_vm_address_t) pc + 1;
+        }
+        plframe_unwind_plan_cache_insert(plan_cache, task, range_start, range_end, &plan);
     }
     
     /* Decode the entry */
@@ -110,7 +257,7 @@ plframe_error_t plframe_cursor_read_compact_unwind (task_t task,
     if (err != PLCRASH_ESUCCESS) {
         PLCF_DEBUG("Could not decode CFE encoding 0x%" PRIx32 " for PC 0x%" PRIx64 ": %d", encoding, (uint64_t) pc, err);
         result = PLFRAME_ENOTSUP;
-        goto cleanup_mobject;
+        goto cleanup;
     }
 
     /* Skip entries for which no unwind information is unavailable */
@@ -119,6 +266,12 @@ plframe_error_t plframe_cursor_read_compact_unwind (task_t task,
         goto cleanup_cfe_entry;
     }
     
+    /* Entries that defer to DWARF provide the FDE's __eh_frame offset; use it to decode the FDE directly. */
+    if (plcrash_async_cfe_entry_type(&entry) == PLCRASH_ASYNC_CFE_ENTRY_TYPE_DWARF) {
+        result = plframe_cursor_read_dwarf_unwind_fde(task, image, (pl_vm_off_t) plcrash_async_cfe_entry_stack_offset(&entry), current_frame, previous_frame, next_frame);
+        goto cleanup_cfe_entry;
+    }
+
     /* Compute the in-core function address */
     pl_vm_address_t function_address;
     if (!plcrash_async_address_apply_offset(image->macho_image.header_addr, function_base, &function_address)) {
@@ -139,8 +292,6 @@ plframe_error_t plframe_cursor_read_compact_unwind (task_t task,
 
 cleanup_cfe_entry:
     plcrash_async_cfe_entry_free(&entry);
-cleanup_mobject:
-    plcrash_async_mobject_free(&unwind_mobj);
 cleanup:
     plcrash_async_image_list_set_reading(image_list, false);
     return result;
@@ -37,6 +37,16 @@
 extern "C" {
 #endif
 
+/**
+ * @internal
+ *
+ * Opaque per-image compact unwind context.
+ */
+typedef struct plframe_compact_unwind_context plframe_compact_unwind_context_t;
+
+plframe_compact_unwind_context_t *plframe_nasync_compact_unwind_context_new (plcrash_async_macho_t *image);
+void plframe_nasync_compact_unwind_context_free (plframe_compact_unwind_context_t *context);
+
 plframe_error_t plframe_cursor_read_compact_unwind (task_t task,
                                                     plcrash_async_image_list_t *image_list,
                                                     const plframe_stackframe_t *current_frame,
@@ -26,6 +26,7 @@
 
 
 #include "PLCrashFrameDWARFUnwind.h"
+#include "PLCrashFrameUnwindPlan.h"
 
 #include "PLCrashAsyncMachOImage.h"
 
@@ -45,11 +46,236 @@ using namespace plcrash::async;
 /**
  * @internal
  *
- * Attempt to fetch next frame using compact frame unwinding data from @a image.
+ * Persistent per-image DWARF unwind state. The image's DWARF section is mapped once, and an FDE lookup
+ * table is built, allowing per-frame FDE lookups to be performed via binary search.
+ */
+struct plframe_dwarf_unwind_context {
+    /** The mapped eh_frame or debug_frame section. */
+    plcrash_async_mobject_t section;
+
+    /** True if @a section is a debug_frame section, false if it is an eh_frame section. */
+    bool is_debug_frame;
+
+    /** A frame reader backed by @a section. */
+    dwarf_frame_reader reader;
+};
+
+/**
+ * @internal
+ *
+ * Map the eh_frame or debug_frame DWARF section from @a image. Apple doesn't seem to use debug_frame at all;
+ * as such, we prefer eh_frame, but allow falling back on debug_frame.
+ *
+ * @param image The image from which the DWARF section should be mapped.
+ * @param mobj On success, will be initialized with the section mapping. The caller is responsible for
+ * freeing the mapping via plcrash_async_mobject_free().
+ * @param is_debug_frame On success, will be set to true if the mapped section is a debug_frame section.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, PLCRASH_ENOTFOUND if neither section is available, or another
+ * plcrash_error_t error code if a section could not be mapped.
+ */
+static plcrash_error_t plframe_dwarf_map_section (plcrash_async_macho_t *image, plcrash_async_mobject_t *mobj, bool *is_debug_frame) {
+    plcrash_error_t eh_err, debug_err;
+
+    if ((eh_err = plcrash_async_macho_map_section(image, "__TEXT", "__eh_frame", mobj)) == PLCRASH_ESUCCESS) {
+        *is_debug_frame = false;
+        return PLCRASH_ESUCCESS;
+    }
+
+    if ((debug_err = plcrash_async_macho_map_section(image, "__DWARF", "__debug_frame", mobj)) == PLCRASH_ESUCCESS) {
+        *is_debug_frame = true;
+        return PLCRASH_ESUCCESS;
+    }
+
+    /* Report ENOTFOUND only if both sections are definitively absent */
+    if (eh_err != PLCRASH_ENOTFOUND)
+        return eh_err;
+
+    return debug_err;
+}
+
+/**
+ * Create a persistent DWARF unwind context for @a image, mapping the image's DWARF section and building an FDE lookup
+ * table. The context may be supplied to plframe_cursor_read_dwarf_unwind() via the image's plcrash_async_image_t record.
+ *
+ * @param image The image for which a context should be created.
+ *
+ * @return Returns the new context, or NULL if the image contains no DWARF unwind data, or the context could not
+ * be created. The context must be freed via plframe_nasync_dwarf_unwind_context_free().
+ *
+ * @warning This method is not async safe.
+ */
+plframe_dwarf_unwind_context_t *plframe_nasync_dwarf_unwind_context_new (plcrash_async_macho_t *image) {
+    plframe_dwarf_unwind_context_t *context = new plframe_dwarf_unwind_context_t();
+    plcrash_error_t err;
+
+    /* The lack of debug_frame/eh_frame is not an error */
+    if (plframe_dwarf_map_section(image, &context->section, &context->is_debug_frame) != PLCRASH_ESUCCESS) {
+        delete context;
+        return NULL;
+    }
+
+    if ((err = context->reader.init(&context->section, image->byteorder, image->m64, context->is_debug_frame)) != PLCRASH_ESUCCESS) {
+        PLCF_DEBUG("Could not initialize a DWARF parser for %s: %d", PLCF_DEBUG_IMAGE_NAME(image), err);
+        plframe_nasync_dwarf_unwind_context_free(context);
+        return NULL;
+    }
+
+    if ((err = context->reader.nasync_build_fde_table()) != PLCRASH_ESUCCESS) {
+        PLCF_DEBUG("Could not build a DWARF FDE table for %s: %d", PLCF_DEBUG_IMAGE_NAME(image), err);
+        plframe_nasync_dwarf_unwind_context_free(context);
+        return NULL;
+    }
+
+    return context;
+}
+
+/**
+ * Free all resources associated with @a context.
+ *
+ * @param context The context to be freed.
+ *
+ * @warning This method is not async safe.
+ */
+void plframe_nasync_dwarf_unwind_context_free (plframe_dwarf_unwind_context_t *context) {
+    context->reader.nasync_free_fde_table();
+    plcrash_async_mobject_free(&context->section);
+    delete context;
+}
+
+/**
+ * @internal
+ *
+ * Normalize the evaluated @a cfa_state into an unwind plan.
+ *
+ * @param cfa_state The evaluated CFA state.
+ * @param cie_info The CIE from which @a cfa_state was derived.
+ * @param plan The plan to be initialized.
+ *
+ * @return Returns true on success, or false if @a cfa_state can not be represented by a plframe_unwind_plan_t (eg,
+ * it defines no CFA, or saves more than PLFRAME_UNWIND_PLAN_MAX_REGISTERS registers).
+ */
+template<typename machine_ptr, typename machine_ptr_s>
+static bool plframe_dwarf_plan_from_state (dwarf_cfa_state<machine_ptr, machine_ptr_s> *cfa_state, plcrash_async_dwarf_cie_info_t *cie_info, plframe_unwind_plan_t *plan) {
+    dwarf_cfa_rule<machine_ptr, machine_ptr_s> cfa_rule = cfa_state->get_cfa_rule();
+
+    plan->type = PLFRAME_UNWIND_PLAN_TYPE_DWARF;
+    switch (cfa_rule.type()) {
+        case DWARF_CFA_STATE_CFA_TYPE_UNDEFINED:
+            return false;
+
+        case DWARF_CFA_STATE_CFA_TYPE_REGISTER:
+            plan->dwarf.cfa_type = PLFRAME_UNWIND_PLAN_CFA_REGISTER;
+            plan->dwarf.cfa_regnum = cfa_rule.register_number();
+            plan->dwarf.cfa_offset = cfa_rule.register_offset();
+            break;
+
+        case DWARF_CFA_STATE_CFA_TYPE_REGISTER_SIGNED:
+            plan->dwarf.cfa_type = PLFRAME_UNWIND_PLAN_CFA_REGISTER_SIGNED;
+            plan->dwarf.cfa_regnum = cfa_rule.register_number();
+            plan->dwarf.cfa_offset = (uint64_t) (int64_t) cfa_rule.register_offset_signed();
+            break;
+
+        case DWARF_CFA_STATE_CFA_TYPE_EXPRESSION:
+            plan->dwarf.cfa_type = PLFRAME_UNWIND_PLAN_CFA_EXPRESSION;
+            plan->dwarf.cfa_expression_address = cfa_rule.expression_address();
+            plan->dwarf.cfa_expression_length = cfa_rule.expression_length();
+            break;
+    }
+
+    plan->dwarf.return_address_register = cie_info->return_address_register;
+    plan->dwarf.register_count = 0;
+
+    dwarf_cfa_state_iterator<machine_ptr, machine_ptr_s> iter = dwarf_cfa_state_iterator<machine_ptr, machine_ptr_s>(cfa_state);
+    dwarf_cfa_state_regnum_t regnum;
+    plcrash_dwarf_cfa_reg_rule_t rule;
+    machine_ptr value;
+    while (iter.next(&regnum, &rule, &value)) {
+        if (plan->dwarf.register_count == PLFRAME_UNWIND_PLAN_MAX_REGISTERS)
+            return false;
+
+        plframe_unwind_plan_register_t *reg = &plan->dwarf.registers[plan->dwarf.register_count++];
+        reg->regnum = regnum;
+        reg->rule = (uint8_t) rule;
+        reg->value = value;
+    }
+
+    return true;
+}
+
+/**
+ * @internal
+ *
+ * Apply a cached DWARF unwind @a plan to @a current_frame, initializing @a next_frame.
+ *
+ * @param task The task containing the target frame stack.
+ * @param plan A DWARF unwind plan derived for the current frame's PC.
+ * @param byteorder The target's byte order.
+ * @param current_frame The current stack frame.
+ * @param next_frame The new frame to be initialized.
+ *
+ * @tparam machine_ptr The native machine pointer type for the target data.
+ * @tparam machine_ptr_s The native machine signed pointer type for the target data.
+ *
+ * @return Returns PLFRAME_ESUCCESS on success, or PLFRAME_ENOFRAME if the plan could not be applied.
+ */
+template<typename machine_ptr, typename machine_ptr_s>
+static plframe_error_t plframe_dwarf_apply_plan (task_t task,
+                                                 const plframe_unwind_plan_t *plan,
+                                                 const plcrash_async_byteorder_t *byteorder,
+                                                 const plframe_stackframe_t *current_frame,
+                                                 plframe_stackframe_t *next_frame)
+{
+    plcrash::async::dwarf_cfa_state<machine_ptr, machine_ptr_s> cfa_state;
+    plcrash_error_t err;
+
+    switch (plan->dwarf.cfa_type) {
+        case PLFRAME_UNWIND_PLAN_CFA_REGISTER:
+            cfa_state.set_cfa_register(plan->dwarf.cfa_regnum, (machine_ptr) plan->dwarf.cfa_offset);
+            break;
+
+        case PLFRAME_UNWIND_PLAN_CFA_REGISTER_SIGNED:
+            cfa_state.set_cfa_register_signed(plan->dwarf.cfa_regnum, (machine_ptr_s) (int64_t) plan->dwarf.cfa_offset);
+            break;
+
+        case PLFRAME_UNWIND_PLAN_CFA_EXPRESSION:
+            cfa_state.set_cfa_expression(plan->dwarf.cfa_expression_address, plan->dwarf.cfa_expression_length);
+            break;
+    }
+
+    for (uint8_t i = 0; i < plan->dwarf.register_count; i++) {
+        const plframe_unwind_plan_register_t *reg = &plan->dwarf.registers[i];
+        if (!cfa_state.set_register(reg->regnum, (plcrash_dwarf_cfa_reg_rule_t) reg->rule, (machine_ptr) reg->value)) {
+            PLCF_DEBUG("Could not restore register 0x%" PRIx32 " from a cached unwind plan", reg->regnum);
+            return PLFRAME_INTERNAL;
+        }
+    }
+
+    /* Only the return address register is consulted when applying the CFA state */
+    plcrash_async_dwarf_cie_info_t cie_info;
+    plcrash_async_memset(&cie_info, 0, sizeof(cie_info));
+    cie_info.return_address_register = plan->dwarf.return_address_register;
+
+    if ((err = cfa_state.apply_state(task, &cie_info, &current_frame->thread_state, byteorder, &next_frame->thread_state)) != PLCRASH_ESUCCESS) {
+        PLCF_DEBUG("Failed to apply cached CFA state: %d", err);
+        return PLFRAME_ENOFRAME;
+    }
+
+    return PLFRAME_ESUCCESS;
+}
+
+/**
+ * @internal
+ *
+ * Attempt to fetch next frame using DWARF unwinding data from @a dwarf_section.
  *
  * @param task The task containing the target frame stack.
  * @param pc The current frame's PC value.
  * @param image The Mach-O image for the current stack frame.
+ * @param dwarf_section The mapped eh_frame or debug_frame section from @a image.
+ * @param reader A frame reader backed by @a dwarf_section.
+ * @param fde_offset The section-relative offset of the FDE for @a pc, or 0 if unknown. See dwarf_frame_reader::find_fde().
+ * @param plan_cache The unwind plan cache in which the evaluated CFA state should be stored, or NULL.
  * @param current_frame The current stack frame.
  * @param previous_frame The previous stack frame, or NULL if this is the first frame.
  * @param next_frame The new frame to be initialized.
@@ -63,21 +289,16 @@ template<typename machine_ptr, typename machine_ptr_s>
 static plframe_error_t plframe_cursor_read_dwarf_unwind_int (task_t task,
                                                              machine_ptr pc,
                                                              plcrash_async_macho_t *image,
+                                                             plcrash_async_mobject_t *dwarf_section,
+                                                             dwarf_frame_reader *reader,
+                                                             pl_vm_off_t fde_offset,
+                                                             plframe_unwind_plan_cache_t *plan_cache,
                                                              const plframe_stackframe_t *current_frame,
                                                              const plframe_stackframe_t *previous_frame,
                                                              plframe_stackframe_t *next_frame)
 {
     gnu_ehptr_reader<machine_ptr> ptr_state(image->byteorder);
 
-    /* Mapped DWARF sections; only one of eh_frame/debug_frame will be mapped */
-    plcrash_async_mobject_t eh_frame;
-    plcrash_async_mobject_t debug_frame;
-    plcrash_async_mobject_t *dwarf_section = NULL;
-    bool is_debug_frame = false;
-    
-    /* Reader state */
-    dwarf_frame_reader reader;
-
     plcrash_async_dwarf_fde_info_t fde_info;
     bool did_init_fde = false;
     
@@ -86,49 +307,27 @@ static plframe_error_t plframe_cursor_read_dwarf_unwind_int (task_t task,
     
     /* CFA evaluation stack */
     plcrash::async::dwarf_cfa_state<machine_ptr, machine_ptr_s> cfa_state;
+
+    /* The CFA table rows described by the evaluated initial and FDE instructions */
+    machine_ptr cie_row_start, cie_row_end;
+    machine_ptr fde_row_start, fde_row_end;
     
     plframe_error_t result;
     plcrash_error_t err;
-        
-    /*
-     * Map the eh_frame or debug_frame DWARF sections. Apple doesn't seem to use debug_frame at all;
-     * as such, we prefer eh_frame, but allow falling back on debug_frame.
-     */
-    {
-        err = plcrash_async_macho_map_section(image, "__TEXT", "__eh_frame", &eh_frame);
-        if (err == PLCRASH_ESUCCESS) {
-            dwarf_section = &eh_frame;
-        }
-        
-        if (dwarf_section == NULL) {
-            err = plcrash_async_macho_map_section(image, "__DWARF", "__debug_frame", &debug_frame);
-            if (err == PLCRASH_ESUCCESS) {
-                dwarf_section = &debug_frame;
-                is_debug_frame = true;
-            }
-        }
-        
-        /* If neither, there's nothing to do */
-        if (dwarf_section == NULL) {
-            /* The lack of debug_frame/eh_frame is not an error, but we can't proceed. */
-            result = PLFRAME_ENOFRAME;
-            goto cleanup;
-        }
-    }
-    
-    /* Initialize the reader. */
-    if ((err = reader.init(dwarf_section, image->byteorder, image->m64, is_debug_frame)) != PLCRASH_ESUCCESS) {
-        PLCF_DEBUG("Could not initialize a %s DWARF parser for the current frame pc 0x%" PRIx64 " in %s: %d", (is_debug_frame ? "debug_frame" : "eh_frame"), (uint64_t) pc, PLCF_DEBUG_IMAGE_NAME(image), err);
-        result = PLFRAME_EINVAL;
-        goto cleanup;
-    }
     
     /* Find the FDE (if any) */
     {
-        err = reader.find_fde(0x0 /* offset hint */, (pl_vm_address_t) pc, &fde_info);
+        err = reader->find_fde(fde_offset, (pl_vm_address_t) pc, &fde_info);
         if (err != PLCRASH_ESUCCESS) {
-            if (err != PLCRASH_ENOTFOUND)
+            if (err != PLCRASH_ENOTFOUND) {
                 PLCF_DEBUG("Failed to find FDE the current frame pc 0x%" PRIx64 " in %s: %d", (uint64_t) pc, PLCF_DEBUG_IMAGE_NAME(image), err);
+            } else if (plan_cache != NULL) {
+                /* Record the negative result for subsequent visits to this PC */
+                plframe_unwind_plan_t plan;
+                plcrash_async_memset(&plan, 0, sizeof(plan));
+                plan.type = PLFRAME_UNWIND_PLAN_TYPE_DWARF_NONE;
+                plframe_unwind_plan_cache_insert(plan_cache, task, (pl_vm_address_t) pc, (pl_vm_address_t) pc + 1, &plan);
+            }
             result = PLFRAME_ENOTSUP;
             goto cleanup;
         }
@@ -160,7 +359,7 @@ static plframe_error_t plframe_cursor_read_dwarf_unwind_int (task_t task,
         PLCF_ASSERT(fde_info.pc_start < std::numeric_limits<machine_ptr>::max());
 
         /* Initial instructions */
-        err = cfa_state.eval_program(dwarf_section, pc, (uint32_t)fde_info.pc_start, &cie_info, &ptr_state, image->byteorder, plcrash_async_mobject_base_address(dwarf_section), cie_info.initial_instructions_offset, cie_info.initial_instructions_length);
+        err = cfa_state.eval_program(dwarf_section, pc, (uint32_t)fde_info.pc_start, &cie_info, &ptr_state, image->byteorder, plcrash_async_mobject_base_address(dwarf_section), cie_info.initial_instructions_offset, cie_info.initial_instructions_length, &cie_row_start, &cie_row_end);
         if (err != PLCRASH_ESUCCESS) {
             PLCF_DEBUG("Failed to evaluate CFA at offset of 0x%" PRIx64 ": %d", (uint64_t) fde_info.instructions_offset, err);
             result = PLFRAME_ENOTSUP;
@@ -168,7 +367,7 @@ static plframe_error_t plframe_cursor_read_dwarf_unwind_int (task_t task,
         }
         
         /*  FDE instructions */
-        err = cfa_state.eval_program(dwarf_section, pc, (uint32_t)fde_info.pc_start, &cie_info, &ptr_state, image->byteorder, plcrash_async_mobject_base_address(dwarf_section), fde_info.instructions_offset, fde_info.instructions_length);
+        err = cfa_state.eval_program(dwarf_section, pc, (uint32_t)fde_info.pc_start, &cie_info, &ptr_state, image->byteorder, plcrash_async_mobject_base_address(dwarf_section), fde_info.instructions_offset, fde_info.instructions_length, &fde_row_start, &fde_row_end);
         if (err != PLCRASH_ESUCCESS) {
             PLCF_DEBUG("Failed to evaluate CFA at offset of 0x%" PRIx64 ": %d", (uint64_t) fde_info.instructions_offset, err);
             result = PLFRAME_ENOTSUP;
@@ -176,6 +375,34 @@ static plframe_error_t plframe_cursor_read_dwarf_unwind_int (task_t task,
         }
     }
     
+    /* Cache the evaluated state for all PCs within the CFA table row containing this PC; the state is identical for
+     * any PC within the row, which is bounded by the FDE's range and by any location advanced past by either program. */
+    if (plan_cache != NULL) {
+        plframe_unwind_plan_t plan;
+        if (plframe_dwarf_plan_from_state<machine_ptr, machine_ptr_s>(&cfa_state, &cie_info, &plan)) {
+            uint64_t range_start = fde_info.pc_start;
+            uint64_t range_end = fde_info.pc_end;
+
+            if (cie_row_start > range_start)
+                range_start = cie_row_start;
+            if (fde_row_start > range_start)
+                range_start = fde_row_start;
+
+            if (cie_row_end != 0 && cie_row_end < range_end)
+                range_end = cie_row_end;
+            if (fde_row_end != 0 && fde_row_end < range_end)
+                range_end = fde_row_end;
+
+            /* Fall back on caching the plan for this PC alone if the row can not be determined */
+            if (range_start > pc || range_end <= pc) {
+                range_start = pc;
+                range_end = (uint64_t) pc + 1;
+            }
+
+            plframe_unwind_plan_cache_insert(plan_cache, task, (pl_vm_address_t) range_start, (pl_vm_address_t) range_end, &plan);
+        }
+    }
+
     /* Apply the frame delta -- this may fail. */
     if ((err = cfa_state.apply_state(task, &cie_info, &current_frame->thread_state, image->byteorder, &next_frame->thread_state)) == PLCRASH_ESUCCESS) {
         result = PLFRAME_ESUCCESS;
@@ -187,9 +414,6 @@ static plframe_error_t plframe_cursor_read_dwarf_unwind_int (task_t task,
     // Fall-through
     
 cleanup:
-    if (dwarf_section != NULL)
-        plcrash_async_mobject_free(dwarf_section);
-    
     if (did_init_cie)
         plcrash_async_dwarf_cie_info_free(&cie_info);
     
@@ -200,7 +424,115 @@ cleanup:
 }
 
 /**
- * Attempt to fetch next frame using compact frame unwinding data from @a image_list.
+ * @internal
+ *
+ * Attempt to fetch next frame using DWARF unwinding data from @a image.
+ *
+ * @param task The task containing the target frame stack.
+ * @param pc The current frame's PC value.
+ * @param image The image containing @a pc.
+ * @param fde_offset The __eh_frame section-relative offset of the FDE for @a pc, or 0 if unknown. The offset will be ignored
+ * if the image's DWARF data is provided via a debug_frame section.
+ * @param current_frame The current stack frame.
+ * @param previous_frame The previous stack frame, or NULL if this is the first frame.
+ * @param next_frame The new frame to be initialized.
+ *
+ * @return Returns PLFRAME_ESUCCESS on success, PLFRAME_ENOFRAME is no additional frames are available, or a standard plframe_error_t code if an error occurs.
+ */
+static plframe_error_t plframe_cursor_read_dwarf_unwind_image (task_t task,
+                                                               plcrash_greg_t pc,
+                                                               plcrash_async_image_t *image,
+                                                               pl_vm_off_t fde_offset,
+                                                               const plframe_stackframe_t *current_frame,
+                                                               const plframe_stackframe_t *previous_frame,
+                                                               plframe_stackframe_t *next_frame)
+{
+    plframe_error_t ferr;
+
+    /* Skip images known to lack DWARF unwind data */
+    plframe_unwind_plan_cache_t *plan_cache = plframe_unwind_plan_cache_bound();
+    if (plcrash_async_image_reader_unsupported(image, PLCRASH_ASYNC_IMAGE_READER_DWARF_UNWIND)) {
+        if (plan_cache != NULL)
+            plframe_unwind_plan_cache_note_skipped(plan_cache);
+        return PLFRAME_ENOFRAME;
+    }
+
+    /* Use a cached plan for this PC, if available */
+    if (plan_cache != NULL) {
+        const plframe_unwind_plan_t *plan = plframe_unwind_plan_cache_lookup(plan_cache, task, (pl_vm_address_t) pc, PLFRAME_UNWIND_PLAN_TYPE_DWARF);
+        if (plan != NULL) {
+            if (image->macho_image.m64)
+                return plframe_dwarf_apply_plan<uint64_t, int64_t>(task, plan, image->macho_image.byteorder, current_frame, next_frame);
+            else
+                return plframe_dwarf_apply_plan<uint32_t, int32_t>(task, plan, image->macho_image.byteorder, current_frame, next_frame);
+        }
+
+        /* Skip PCs previously found to have no FDE */
+        if (plframe_unwind_plan_cache_lookup(plan_cache, task, (pl_vm_address_t) pc, PLFRAME_UNWIND_PLAN_TYPE_DWARF_NONE) != NULL) {
+            plframe_unwind_plan_cache_note_skipped(plan_cache);
+            return PLFRAME_ENOTSUP;
+        }
+    }
+
+    /* Use the image's persistent DWARF context, if available; otherwise, map the DWARF section for this frame. */
+    plframe_dwarf_unwind_context_t *context = image->dwarf_unwind;
+    plcrash_async_mobject_t *dwarf_section;
+    dwarf_frame_reader *reader;
+    bool is_debug_frame;
+
+    plcrash_async_mobject_t local_section;
+    dwarf_frame_reader local_reader;
+    bool did_map_section = false;
+
+    if (context != NULL) {
+        dwarf_section = &context->section;
+        reader = &context->reader;
+        is_debug_frame = context->is_debug_frame;
+    } else {
+        plcrash_error_t err;
+        if ((err = plframe_dwarf_map_section(&image->macho_image, &local_section, &is_debug_frame)) != PLCRASH_ESUCCESS) {
+            /* The lack of debug_frame/eh_frame is not an error, but we can't proceed; record it for subsequent frames. */
+            if (err == PLCRASH_ENOTFOUND)
+                plcrash_async_image_set_reader_unsupported(image, PLCRASH_ASYNC_IMAGE_READER_DWARF_UNWIND);
+            return PLFRAME_ENOFRAME;
+        }
+        did_map_section = true;
+
+        if ((err = local_reader.init(&local_section, image->macho_image.byteorder, image->macho_image.m64, is_debug_frame)) != PLCRASH_ESUCCESS) {
+            PLCF_DEBUG("Could not initialize a %s DWARF parser for the current frame pc 0x%" PRIx64 " in %s: %d", (is_debug_frame ? "debug_frame" : "eh_frame"), (uint64_t) pc, PLCF_DEBUG_IMAGE_NAME((&image->macho_image)), err);
+            plcrash_async_mobject_free(&local_section);
+            return PLFRAME_EINVAL;
+        }
+
+        dwarf_section = &local_section;
+        reader = &local_reader;
+    }
+
+    /* FDE offsets supplied by the compact unwind encoding are relative to __eh_frame */
+    if (is_debug_frame)
+        fde_offset = 0x0;
+
+    /* Perform the actual read */
+    if (image->macho_image.m64) {
+        /* Could only happen due to programmer error; eg, an image that doesn't actually match our thread state */
+        PLCF_ASSERT(pc <= UINT64_MAX);
+
+        ferr = plframe_cursor_read_dwarf_unwind_int<uint64_t, int64_t>(task, pc, &image->macho_image, dwarf_section, reader, fde_offset, plan_cache, current_frame, previous_frame, next_frame);
+    } else {
+        /* Could only happen due to programmer error; eg, an image that doesn't actually match our thread state */
+        PLCF_ASSERT(pc <= UINT32_MAX);
+
+        ferr = plframe_cursor_read_dwarf_unwind_int<uint32_t, int32_t>(task, (uint32_t)pc, &image->macho_image, dwarf_section, reader, fde_offset, plan_cache, current_frame, previous_frame, next_frame);
+    }
+
+    if (did_map_section)
+        plcrash_async_mobject_free(&local_section);
+
+    return ferr;
+}
+
+/**
+ * Attempt to fetch next frame using DWARF unwinding data from @a image_list.
  *
  * @param task The task containing the target frame stack.
  * @param image_list The list of images loaded in the target @a task.
@@ -242,21 +574,42 @@ plframe_error_t plframe_cursor_read_dwarf_unwind (task_t task,
         return PLFRAME_ENOTSUP;
     }
     
-    /* Perform the actual read */
-    if (image->macho_image.m64) {
-        /* Could only happen due to programmer error; eg, an image that doesn't actually match our thread state */
-        PLCF_ASSERT(pc <= UINT64_MAX);
+    ferr = plframe_cursor_read_dwarf_unwind_image(task, pc, image, 0x0 /* offset hint */, current_frame, previous_frame, next_frame);
 
-        ferr = plframe_cursor_read_dwarf_unwind_int<uint64_t, int64_t>(task, pc, &image->macho_image, current_frame, previous_frame, next_frame);
-    } else {
-        /* Could only happen due to programmer error; eg, an image that doesn't actually match our thread state */
-        PLCF_ASSERT(pc <= UINT32_MAX);
-
-        ferr = plframe_cursor_read_dwarf_unwind_int<uint32_t, int32_t>(task, (uint32_t)pc, &image->macho_image, current_frame, previous_frame, next_frame);
-    }
-    
     plcrash_async_image_list_set_reading(image_list, false);
     return ferr;
 }
 
+/**
+ * Attempt to fetch next frame using the DWARF FDE found at @a fde_offset within @a image's __eh_frame section. This is
+ * used to resolve compact unwind entries of type PLCRASH_ASYNC_CFE_ENTRY_TYPE_DWARF, which provide the FDE's offset,
+ * allowing the FDE to be decoded directly rather than located via a search of the section.
+ *
+ * @param task The task containing the target frame stack.
+ * @param image The image containing the current frame's PC. The caller must hold a read reference to the image's
+ * containing list; see plcrash_async_image_list_set_reading().
+ * @param fde_offset The __eh_frame section-relative offset of the FDE for the current frame's PC.
+ * @param current_frame The current stack frame.
+ * @param previous_frame The previous stack frame, or NULL if this is the first frame.
+ * @param next_frame The new frame to be initialized.
+ *
+ * @return Returns PLFRAME_ESUCCESS on success, PLFRAME_ENOFRAME is no additional frames are available, or a standard plframe_error_t code if an error occurs.
+ */
+plframe_error_t plframe_cursor_read_dwarf_unwind_fde (task_t task,
+                                                      plcrash_async_image_t *image,
+                                                      pl_vm_off_t fde_offset,
+                                                      const plframe_stackframe_t *current_frame,
+                                                      const plframe_stackframe_t *previous_frame,
+                                                      plframe_stackframe_t *next_frame)
+{
+    /* Fetch the IP. It should always be available */
+    if (!plcrash_async_thread_state_has_reg(&current_frame->thread_state, PLCRASH_REG_IP)) {
+        PLCF_DEBUG("Frame is missing a valid IP register, skipping DWARF unwind");
+        return PLFRAME_EBADFRAME;
+    }
+    plcrash_greg_t pc = plcrash_async_thread_state_get_reg(&current_frame->thread_state, PLCRASH_REG_IP);
+
+    return plframe_cursor_read_dwarf_unwind_image(task, pc, image, fde_offset, current_frame, previous_frame, next_frame);
+}
+
 #endif /* PLCRASH_FEATURE_UNWIND_DWARF */
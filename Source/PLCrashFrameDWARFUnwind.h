@@ -36,6 +36,15 @@
 extern "C" {
 #endif
 
+/**
+ * @internal
+ *
+ * Opaque per-image DWARF unwind context.
+ */
+typedef struct plframe_dwarf_unwind_context plframe_dwarf_unwind_context_t;
+
+plframe_dwarf_unwind_context_t *plframe_nasync_dwarf_unwind_context_new (plcrash_async_macho_t *image);
+void plframe_nasync_dwarf_unwind_context_free (plframe_dwarf_unwind_context_t *context);
 
 plframe_error_t plframe_cursor_read_dwarf_unwind (task_t task,
                                                   plcrash_async_image_list_t *image_list,
@@ -43,6 +52,13 @@ plframe_error_t plframe_cursor_read_dwarf_unwind (task_t task,
                                                   const plframe_stackframe_t *previous_frame,
                                                   plframe_stackframe_t *next_frame);
 
+plframe_error_t plframe_cursor_read_dwarf_unwind_fde (task_t task,
+                                                      plcrash_async_image_t *image,
+                                                      pl_vm_off_t fde_offset,
+                                                      const plframe_stackframe_t *current_frame,
+                                                      const plframe_stackframe_t *previous_frame,
+                                                      plframe_stackframe_t *next_frame);
+
     
 #ifdef __cplusplus
 }
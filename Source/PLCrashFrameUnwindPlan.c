@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "PLCrashFrameUnwindPlan.h"
+#include "PLCrashAsyncThreadBinding.h"
+
+#include <inttypes.h>
+
+/**
+ * @internal
+ * @ingroup plframe_unwind_plan
+ * @{
+ */
+
+/** The total size of a cache's entry storage. */
+#define PLFRAME_UNWIND_PLAN_CACHE_SIZE (sizeof(plframe_unwind_plan_cache_entry_t) * PLFRAME_UNWIND_PLAN_CACHE_ENTRIES)
+
+/**
+ * Initialize a new unwind plan cache, allocating its entry storage.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to initialize. The cache must be freed via plframe_unwind_plan_cache_free().
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or PLCRASH_ENOMEM if entry storage could not be allocated. On failure,
+ * the cache may still be used and freed, but will not retain any plans.
+ */
+plcrash_error_t plframe_unwind_plan_cache_init (plframe_unwind_plan_cache_t *cache) {
+    cache->use_counter = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->skipped = 0;
+
+    /* vm_allocate() returns zero-filled pages; all entries are initially unused */
+    vm_address_t entries;
+    kern_return_t kr = vm_allocate(mach_task_self(), &entries, (vm_size_t) PLFRAME_UNWIND_PLAN_CACHE_SIZE, VM_FLAGS_ANYWHERE);
+    if (kr != KERN_SUCCESS) {
+        PLCF_DEBUG("vm_allocate failed for unwind plan cache storage: %d", kr);
+        cache->entries = NULL;
+        return PLCRASH_ENOMEM;
+    }
+
+    cache->entries = (plframe_unwind_plan_cache_entry_t *) entries;
+    return PLCRASH_ESUCCESS;
+}
+
+/**
+ * Discard all cached plans and reset the cache's statistics, retaining its entry storage. This allows a cache
+ * allocated ahead of time to be reused for each report.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to reset.
+ */
+void plframe_unwind_plan_cache_reset (plframe_unwind_plan_cache_t *cache) {
+    cache->use_counter = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->skipped = 0;
+
+    if (cache->entries != NULL) {
+        for (size_t i = 0; i < PLFRAME_UNWIND_PLAN_CACHE_ENTRIES; i++) {
+            cache->entries[i].task = MACH_PORT_NULL;
+            cache->entries[i].last_use = 0;
+        }
+    }
+}
+
+/**
+ * Look up the plan of @a type cached for the PC range containing @a pc.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to search.
+ * @param task The task to which @a pc belongs.
+ * @param pc The PC for which a plan should be returned.
+ * @param type The type of plan to be returned.
+ *
+ * @return Returns a borrowed reference to the cached plan, or NULL if no plan is cached. The reference is only valid
+ * until the next call to plframe_unwind_plan_cache_insert().
+ */
+const plframe_unwind_plan_t *plframe_unwind_plan_cache_lookup (plframe_unwind_plan_cache_t *cache, task_t task, pl_vm_address_t pc, plframe_unwind_plan_type_t type) {
+    if (cache->entries == NULL)
+        return NULL;
+
+    for (size_t i = 0; i < PLFRAME_UNWIND_PLAN_CACHE_ENTRIES; i++) {
+        plframe_unwind_plan_cache_entry_t *entry = &cache->entries[i];
+        if (entry->task == task && entry->plan.type == type && pc >= entry->pc_start && pc < entry->pc_end) {
+            cache->hits++;
+            entry->last_use = ++cache->use_counter;
+            return &entry->plan;
+        }
+    }
+
+    cache->misses++;
+    return NULL;
+}
+
+/**
+ * Cache @a plan for the PC range [@a pc_start, @a pc_end), replacing any existing plan of the same type starting at
+ * @a pc_start, or otherwise evicting the least recently used plan.
+ *
+ * The range should be the widest over which the plan is known to be valid -- eg, the function described by a compact
+ * unwind entry, or a single row of a DWARF FDE's CFA table -- allowing all PCs within it to share a single entry.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache in which @a plan should be stored.
+ * @param task The task to which the PC range belongs.
+ * @param pc_start The first PC to which @a plan applies.
+ * @param pc_end The end (exclusive) of the PC range to which @a plan applies. Must be greater than @a pc_start.
+ * @param plan The plan to be copied into the cache.
+ */
+void plframe_unwind_plan_cache_insert (plframe_unwind_plan_cache_t *cache, task_t task, pl_vm_address_t pc_start, pl_vm_address_t pc_end, const plframe_unwind_plan_t *plan) {
+    size_t victim = 0;
+
+    if (cache->entries == NULL)
+        return;
+
+    PLCF_ASSERT(pc_end > pc_start);
+
+    /* Unused entries have a last_use of 0, and will be selected first. */
+    for (size_t i = 0; i < PLFRAME_UNWIND_PLAN_CACHE_ENTRIES; i++) {
+        plframe_unwind_plan_cache_entry_t *entry = &cache->entries[i];
+        if (entry->task == task && entry->pc_start == pc_start && entry->plan.type == plan->type) {
+            victim = i;
+            break;
+        }
+
+        if (entry->last_use < cache->entries[victim].last_use)
+            victim = i;
+    }
+
+    plframe_unwind_plan_cache_entry_t *entry = &cache->entries[victim];
+    entry->task = task;
+    entry->pc_start = pc_start;
+    entry->pc_end = pc_end;
+    entry->last_use = ++cache->use_counter;
+    plcrash_async_memcpy(&entry->plan, plan, sizeof(entry->plan));
+}
+
+/**
+ * Fetch the lookup statistics for @a cache. This may be used to evaluate the number of unwind table searches
+ * avoided by the cache for diagnostic purposes.
+ *
+ * @param cache The cache to query.
+ * @param hits On return, the number of lookups satisfied by the cache.
+ * @param misses On return, the number of lookups that were not satisfied by the cache.
+ */
+void plframe_unwind_plan_cache_get_stats (plframe_unwind_plan_cache_t *cache, uint64_t *hits, uint64_t *misses) {
+    *hits = cache->hits;
+    *misses = cache->misses;
+}
+
+/**
+ * Record a frame reader attempt that was skipped, either due to a cached negative result, or because the
+ * reader's unwind data is known to be absent from the target image.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to update.
+ */
+void plframe_unwind_plan_cache_note_skipped (plframe_unwind_plan_cache_t *cache) {
+    cache->skipped++;
+}
+
+/**
+ * Return the number of frame reader attempts recorded as skipped via plframe_unwind_plan_cache_note_skipped().
+ *
+ * @param cache The cache to query.
+ */
+uint64_t plframe_unwind_plan_cache_get_skipped (plframe_unwind_plan_cache_t *cache) {
+    return cache->skipped;
+}
+
+/**
+ * Free all resources associated with @a cache.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to free. The cache must not be bound.
+ */
+void plframe_unwind_plan_cache_free (plframe_unwind_plan_cache_t *cache) {
+    PLCF_DEBUG("Unwind plan cache: %" PRIu64 " hits, %" PRIu64 " misses, %" PRIu64 " reader attempts skipped", cache->hits, cache->misses, cache->skipped);
+
+    if (cache->entries != NULL) {
+        vm_deallocate(mach_task_self(), (vm_address_t) cache->entries, (vm_size_t) PLFRAME_UNWIND_PLAN_CACHE_SIZE);
+        cache->entries = NULL;
+    }
+}
+
+/**
+ * Bind @a cache to the calling thread. Until unbound, the compact unwind and DWARF frame readers will consult and
+ * populate @a cache when called from the calling thread.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to bind. If another cache is already bound to the calling thread, @a cache will be used in
+ * its place until unbound.
+ *
+ * @return Returns true on success, or false if @a cache is already bound to the calling thread, or the maximum
+ * number of concurrent thread bindings has been reached, in which case plans will not be cached.
+ */
+bool plframe_unwind_plan_cache_bind (plframe_unwind_plan_cache_t *cache) {
+    return plcrash_async_thread_bind(PLCRASH_ASYNC_BINDING_UNWIND_PLAN_CACHE, cache);
+}
+
+/**
+ * Unbind @a cache from the calling thread. If @a cache is not bound to the calling thread, this is a no-op.
+ *
+ * This function is async-safe.
+ *
+ * @param cache The cache to unbind.
+ */
+void plframe_unwind_plan_cache_unbind (plframe_unwind_plan_cache_t *cache) {
+    plcrash_async_thread_unbind(PLCRASH_ASYNC_BINDING_UNWIND_PLAN_CACHE, cache);
+}
+
+/**
+ * Return the unwind plan cache bound to the calling thread, if any.
+ *
+ * This function is async-safe.
+ *
+ * @return Returns the bound cache, or NULL if no cache is bound to the calling thread.
+ */
+plframe_unwind_plan_cache_t *plframe_unwind_plan_cache_bound (void) {
+    return plcrash_async_thread_bound(PLCRASH_ASYNC_BINDING_UNWIND_PLAN_CACHE);
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef PLCRASH_FRAME_UNWIND_PLAN_H
+#define PLCRASH_FRAME_UNWIND_PLAN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <mach/mach.h>
+
+#include "PLCrashAsync.h"
+
+/**
+ * @internal
+ * @ingroup plframe_backtrace
+ * @defgroup plframe_unwind_plan Unwind Plan Cache
+ *
+ * Implements a normalized representation of the unwind recipe derived by a frame reader for a given PC, and a
+ * fixed-capacity, async-safe cache of those recipes. Each recipe is cached for the full range of PCs to which it
+ * applies, allowing repeated visits to the same function -- recursive calls, or call sites within a function shared
+ * by different threads -- to skip the unwind table search and evaluation.
+ * @{
+ */
+
+/** The maximum number of saved registers that may be described by a DWARF unwind plan. */
+#define PLFRAME_UNWIND_PLAN_MAX_REGISTERS 32
+
+/** The number of plans held by a plframe_unwind_plan_cache_t. */
+#define PLFRAME_UNWIND_PLAN_CACHE_ENTRIES 64
+
+/**
+ * @internal
+ *
+ * Unwind plan types. Each frame reader caches and consults only plans of its own type.
+ */
+typedef enum {
+    /** A compact unwind plan. */
+    PLFRAME_UNWIND_PLAN_TYPE_COMPACT = 0,
+
+    /** A DWARF unwind plan. */
+    PLFRAME_UNWIND_PLAN_TYPE_DWARF = 1,
+
+    /** A negative result: the image's compact unwind data contains no entry for the PC. */
+    PLFRAME_UNWIND_PLAN_TYPE_COMPACT_NONE = 2,
+
+    /** A negative result: the image's DWARF unwind data contains no FDE for the PC. */
+    PLFRAME_UNWIND_PLAN_TYPE_DWARF_NONE = 3,
+} plframe_unwind_plan_type_t;
+
+/**
+ * @internal
+ *
+ * DWARF canonical frame address rule types.
+ */
+typedef enum {
+    /** CFA = register + unsigned offset. */
+    PLFRAME_UNWIND_PLAN_CFA_REGISTER = 0,
+
+    /** CFA = register + signed offset. */
+    PLFRAME_UNWIND_PLAN_CFA_REGISTER_SIGNED = 1,
+
+    /** CFA = the result of evaluating a DWARF expression. */
+    PLFRAME_UNWIND_PLAN_CFA_EXPRESSION = 2,
+} plframe_unwind_plan_cfa_type_t;
+
+/**
+ * @internal
+ *
+ * A saved register location within a DWARF unwind plan.
+ */
+typedef struct plframe_unwind_plan_register {
+    /** The DWARF register number. */
+    uint32_t regnum;
+
+    /** The DWARF register rule (a plcrash_dwarf_cfa_reg_rule_t value). */
+    uint8_t rule;
+
+    /** The rule's value, zero-extended from the target's machine pointer type. */
+    uint64_t value;
+} plframe_unwind_plan_register_t;
+
+/**
+ * @internal
+ *
+ * A normalized unwind plan for a range of PCs.
+ */
+typedef struct plframe_unwind_plan {
+    /** The plan type. */
+    plframe_unwind_plan_type_t type;
+
+    union {
+        /** Compact unwind plan; valid if @a type is PLFRAME_UNWIND_PLAN_TYPE_COMPACT. */
+        struct {
+            /** The image-relative start address of the function containing the PC. */
+            pl_vm_address_t function_base;
+
+            /** The compact unwind encoding for the function containing the PC. */
+            uint32_t encoding;
+        } compact;
+
+        /** DWARF unwind plan; valid if @a type is PLFRAME_UNWIND_PLAN_TYPE_DWARF. */
+        struct {
+            /** The CFA rule type. */
+            plframe_unwind_plan_cfa_type_t cfa_type;
+
+            /** The CFA register; valid for PLFRAME_UNWIND_PLAN_CFA_REGISTER(_SIGNED) rules. */
+            uint32_t cfa_regnum;
+
+            /** The CFA register offset, sign-extended for PLFRAME_UNWIND_PLAN_CFA_REGISTER_SIGNED rules. */
+            uint64_t cfa_offset;
+
+            /** The target-relative address of the CFA expression; valid for PLFRAME_UNWIND_PLAN_CFA_EXPRESSION rules. */
+            pl_vm_address_t cfa_expression_address;
+
+            /** The length of the CFA expression; valid for PLFRAME_UNWIND_PLAN_CFA_EXPRESSION rules. */
+            pl_vm_size_t cfa_expression_length;
+
+            /** The CIE's return address register. */
+            uint64_t return_address_register;
+
+            /** The number of entries in @a registers. */
+            uint8_t register_count;
+
+            /** Saved register locations. */
+            plframe_unwind_plan_register_t registers[PLFRAME_UNWIND_PLAN_MAX_REGISTERS];
+        } dwarf;
+    };
+} plframe_unwind_plan_t;
+
+/**
+ * @internal
+ *
+ * A single cached plan.
+ */
+typedef struct plframe_unwind_plan_cache_entry {
+    /** The task to which the PC range belongs, or MACH_PORT_NULL if the entry is unused. */
+    task_t task;
+
+    /** The first PC to which @a plan applies. */
+    pl_vm_address_t pc_start;
+
+    /** The end (exclusive) of the PC range to which @a plan applies. */
+    pl_vm_address_t pc_end;
+
+    /** The value of the cache's use counter at the time of the entry's most recent use. */
+    uint64_t last_use;
+
+    /** The cached plan. */
+    plframe_unwind_plan_t plan;
+} plframe_unwind_plan_cache_entry_t;
+
+/**
+ * @internal
+ *
+ * A fixed-capacity, least-recently-used cache of unwind plans, keyed by task, PC range and plan type.
+ *
+ * Plans depend only on the target's loaded images, which are assumed to remain unchanged for the cache's lifetime;
+ * the cache may therefore be shared by all threads walked while writing a single report. The cache is not
+ * thread-safe.
+ */
+typedef struct plframe_unwind_plan_cache {
+    /** Backing storage for PLFRAME_UNWIND_PLAN_CACHE_ENTRIES entries, allocated via vm_allocate(), or NULL if
+     * allocation failed. */
+    plframe_unwind_plan_cache_entry_t *entries;
+
+    /** Monotonically increasing use counter, used to determine the least-recently-used entry. */
+    uint64_t use_counter;
+
+    /** The number of lookups satisfied by the cache. */
+    uint64_t hits;
+
+    /** The number of lookups that were not satisfied by the cache. */
+    uint64_t misses;
+
+    /** The number of frame reader attempts skipped due to a cached negative result, or an image that is known to
+     * lack the reader's unwind data. */
+    uint64_t skipped;
+} plframe_unwind_plan_cache_t;
+
+plcrash_error_t plframe_unwind_plan_cache_init (plframe_unwind_plan_cache_t *cache);
+void plframe_unwind_plan_cache_reset (plframe_unwind_plan_cache_t *cache);
+const plframe_unwind_plan_t *plframe_unwind_plan_cache_lookup (plframe_unwind_plan_cache_t *cache, task_t task, pl_vm_address_t pc, plframe_unwind_plan_type_t type);
+void plframe_unwind_plan_cache_insert (plframe_unwind_plan_cache_t *cache, task_t task, pl_vm_address_t pc_start, pl_vm_address_t pc_end, const plframe_unwind_plan_t *plan);
+void plframe_unwind_plan_cache_get_stats (plframe_unwind_plan_cache_t *cache, uint64_t *hits, uint64_t *misses);
+void plframe_unwind_plan_cache_note_skipped (plframe_unwind_plan_cache_t *cache);
+uint64_t plframe_unwind_plan_cache_get_skipped (plframe_unwind_plan_cache_t *cache);
+void plframe_unwind_plan_cache_free (plframe_unwind_plan_cache_t *cache);
+
+bool plframe_unwind_plan_cache_bind (plframe_unwind_plan_cache_t *cache);
+void plframe_unwind_plan_cache_unbind (plframe_unwind_plan_cache_t *cache);
+plframe_unwind_plan_cache_t *plframe_unwind_plan_cache_bound (void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCRASH_FRAME_UNWIND_PLAN_H */
@@ -78,6 +78,7 @@ static void plframe_cursor_internal_init (plframe_cursor_t *cursor, task_t task,
     cursor->depth = 0;
     cursor->task = task;
     cursor->image_list = image_list;
+    cursor->page_cache = NULL;
     mach_port_mod_refs(mach_task_self(), cursor->task, MACH_PORT_RIGHT_SEND, 1);    
 }
 
@@ -123,6 +124,24 @@ plframe_error_t plframe_cursor_thread_init (plframe_cursor_t *cursor, task_t tas
     return (plframe_error_t)plcrash_async_thread_state_mach_thread_init(&cursor->frame.thread_state, thread);
 }
 
+/**
+ * Configure a page cache through which all target memory reads performed by the cursor's frame readers will
+ * be made. Any previously cached pages will be discarded.
+ *
+ * The cache is bound to the calling thread only for the duration of each plframe_cursor_next() call; the target
+ * thread's stack must not be modified while the cursor is in use.
+ *
+ * @param cursor The cursor to configure.
+ * @param page_cache The page cache to be used, or NULL to read directly from the target task. This is a borrowed
+ * reference, and must remain valid for the lifetime of the cursor.
+ */
+void plframe_cursor_set_page_cache (plframe_cursor_t *cursor, plcrash_async_page_cache_t *page_cache) {
+    if (page_cache != NULL)
+        plcrash_async_page_cache_flush(page_cache);
+
+    cursor->page_cache = page_cache;
+}
+
 /**
  * Fetch the next frame using the provided frame readers.
  *
@@ -146,12 +165,16 @@ plframe_error_t plframe_cursor_next_with_readers (plframe_cursor_t *cursor, plfr
     /* Read in the next frame using the first successful frame reader. */
     plframe_stackframe_t frame;
     plframe_error_t ferr = PLFRAME_EINVAL; // default return value if reader_count is 0.
+    bool cache_bound = (cursor->page_cache != NULL && plcrash_async_page_cache_bind(cursor->page_cache));
     
     for (size_t i = 0; i < reader_count; i++) {
         ferr = readers[i](cursor->task, cursor->image_list, &cursor->frame, prev_frame, &frame);
         if (ferr == PLFRAME_ESUCCESS)
             break;
     }
+
+    if (cache_bound)
+        plcrash_async_page_cache_unbind(cursor->page_cache);
     
     if (ferr != PLFRAME_ESUCCESS) {
         return ferr;
@@ -40,6 +40,7 @@
 
 #include "PLCrashAsyncThread.h"
 #include "PLCrashAsyncImageList.h"
+#include "PLCrashAsyncPageCache.h"
 
 /* Configure supported targets based on the host build architecture. There's currently
  * no deployed architecture on which simultaneous support for different processor families
@@ -131,6 +132,10 @@ typedef struct plframe_cursor {
     
     /** The task's current image list. This is a borrowed reference, and must remain valid for the lifetime of the cursor. */
     plcrash_async_image_list_t *image_list;
+
+    /** The page cache through which frame readers read target memory, or NULL. This is a borrowed reference. See
+     * plframe_cursor_set_page_cache(). */
+    plcrash_async_page_cache_t *page_cache;
     
     /** The current frame depth. If the depth is 0, the cursor has not been stepped, and the remainder of this
      * structure should be considered uninitialized. */
@@ -164,6 +169,7 @@ const char *plframe_strerror (plframe_error_t error);
 
 plframe_error_t plframe_cursor_init (plframe_cursor_t *cursor, task_t task, plcrash_async_thread_state_t *thread_state, plcrash_async_image_list_t *image_list);
 plframe_error_t plframe_cursor_thread_init (plframe_cursor_t *cursor, task_t task, thread_t thread, plcrash_async_image_list_t *image_list);
+void plframe_cursor_set_page_cache (plframe_cursor_t *cursor, plcrash_async_page_cache_t *page_cache);
 
 char const *plframe_cursor_get_regname (plframe_cursor_t *cursor, plcrash_regnum_t regnum);
 size_t plframe_cursor_get_regcount (plframe_cursor_t *cursor);
@@ -41,6 +41,7 @@ extern "C" {
 #import "PLCrashFrameWalker.h"
     
 #import "PLCrashAsyncSymbolication.h"
+#import "PLCrashFrameUnwindPlan.h"
 #import "PLCrashLogWriterEncoding.h"
 
 #include <uuid/uuid.h>
@@ -159,6 +160,31 @@ typedef struct plcrash_log_writer {
     /** Custom user data */
     PLProtobufCBinaryData custom_data;
 
+    /** The number of worker threads to be used to unwind and symbolicate threads, or 0 to unwind serially. */
+    uint32_t unwind_workers;
+
+    /** If true, thread stack frames are written as packed, image-relative frames (report format v2). */
+    bool packed_frames;
+
+    /** If true, binary image paths and symbol names are written to a report string table (report format v2). */
+    bool string_table;
+
+    /** Report caches allocated ahead of time via plcrash_log_writer_preallocate_caches(), and reset prior to writing
+     * each report. */
+    struct {
+        /** If true, the caches have been allocated; otherwise, caches are allocated while writing each report. */
+        bool allocated;
+
+        /** Symbol lookup cache. */
+        plcrash_async_symbol_cache_t symbol_cache;
+
+        /** Unwind plan cache. */
+        plframe_unwind_plan_cache_t plan_cache;
+
+        /** Stack page cache. If its storage could not be allocated, stack memory will be read directly. */
+        plcrash_async_page_cache_t page_cache;
+    } caches;
+
 } plcrash_log_writer_t;
 
 /**
@@ -227,6 +253,14 @@ void plcrash_log_writer_set_exception (plcrash_log_writer_t *writer, NSException
 
 void plcrash_log_writer_set_custom_data (plcrash_log_writer_t *writer, NSData *custom_data);
 
+void plcrash_log_writer_set_unwind_workers (plcrash_log_writer_t *writer, uint32_t worker_count);
+
+void plcrash_log_writer_set_packed_frames (plcrash_log_writer_t *writer, bool enable);
+
+void plcrash_log_writer_set_string_table (plcrash_log_writer_t *writer, bool enable);
+
+plcrash_error_t plcrash_log_writer_preallocate_caches (plcrash_log_writer_t *writer);
+
 plcrash_error_t plcrash_log_writer_write (plcrash_log_writer_t *writer,
                                           thread_t crashed_thread,
                                           plcrash_async_image_list_t *image_list,
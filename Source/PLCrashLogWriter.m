@@ -48,8 +48,12 @@
 
 #import "PLCrashLogWriter.h"
 #import "PLCrashLogWriterEncoding.h"
+#import "PLCrashReport.pb-enc.h"
 #import "PLCrashAsyncSignalInfo.h"
 #import "PLCrashAsyncSymbolication.h"
+#import "PLCrashParallelUnwind.h"
+#import "PLCrashFrameUnwindPlan.h"
+#import "PLCrashAsyncStringTable.h"
 
 #import "PLCrashSysctl.h"
 #import "PLCrashProcessInfo.h"
@@ -106,6 +110,9 @@ enum {
     /** CrashReport.symbol.end_address */
     PLCRASH_PROTO_SYMBOL_END_ADDRESS = 3,
 
+    /** CrashReport.symbol.name_ref */
+    PLCRASH_PROTO_SYMBOL_NAME_REF = 4,
+
 
     /** CrashReport.threads */
     PLCRASH_PROTO_THREADS_ID = 3,
@@ -156,6 +163,9 @@ enum {
     /** CrashReport.BinaryImage.code_type */
     PLCRASH_PROTO_BINARY_IMAGE_CODE_TYPE_ID = 5,
 
+    /** CrashReport.BinaryImage.name_ref */
+    PLCRASH_PROTO_BINARY_IMAGE_NAME_REF_ID = 6,
+
     
     /** CrashReport.exception */
     PLCRASH_PROTO_EXCEPTION_ID = 5,
@@ -528,6 +538,104 @@ void plcrash_log_writer_set_custom_data (plcrash_log_writer_t *writer, NSData *c
     }
 }
 
+/**
+ * Enable parallel unwinding and symbolication of the report's threads, using @a worker_count worker threads in
+ * addition to the calling thread.
+ *
+ * When enabled, all thread stacks are walked concurrently while the task's threads are suspended; the threads
+ * are then resumed prior to symbolication, which is also performed concurrently. This substantially reduces the
+ * time for which threads remain suspended when generating a live report.
+ *
+ * @param writer The writer instance.
+ * @param worker_count The number of worker threads to use, or 0 to unwind threads serially.
+ *
+ * @warning Parallel unwinding requires allocation and thread creation, and must only be enabled for writers used
+ * to generate live reports; it must never be enabled for a writer used from a crash handler.
+ */
+void plcrash_log_writer_set_unwind_workers (plcrash_log_writer_t *writer, uint32_t worker_count) {
+    writer->unwind_workers = worker_count;
+}
+
+/**
+ * Enable or disable packed, image-relative stack frames (report format v2).
+ *
+ * When enabled, each thread's stack frames are written as a packed sequence of (binary image index, image-relative
+ * offset) pairs, with frame symbols written to a separate table of symbol records, rather than as individual
+ * StackFrame messages. The report's file header is written with #PLCRASH_REPORT_FILE_VERSION_2.
+ *
+ * Frame image indices refer to a snapshot of the image list taken while the task's threads are suspended, from
+ * which the report's binary images are also written. If the snapshot can not be allocated, individual StackFrame
+ * messages are written instead.
+ *
+ * Packed frames are disabled by default.
+ *
+ * @param writer The writer instance.
+ * @param enable If true, write packed stack frames.
+ */
+void plcrash_log_writer_set_packed_frames (plcrash_log_writer_t *writer, bool enable) {
+    writer->packed_frames = enable;
+}
+
+/**
+ * Enable or disable the report string table (report format v2).
+ *
+ * When enabled, binary image paths and symbol names are interned in a report-level string table, and referenced
+ * by index; image paths are interned one path component at a time, and so directory prefixes shared between
+ * images are written once. The report's file header is written with #PLCRASH_REPORT_FILE_VERSION_2.
+ *
+ * If the string table's fixed capacity is exhausted, any remaining strings are written inline, and the report is
+ * still written as format v2. The string table is
+ * disabled by default.
+ *
+ * @param writer The writer instance.
+ * @param enable If true, write a report string table.
+ */
+void plcrash_log_writer_set_string_table (plcrash_log_writer_t *writer, bool enable) {
+    writer->string_table = enable;
+}
+
+/**
+ * Allocate the writer's symbol, unwind plan, and stack page caches ahead of time. By default, these caches are
+ * allocated each time a report is written; a writer that will be used from a crash handler should preallocate its
+ * caches while the process is still in a known-good state, avoiding allocation at crash time. Preallocated caches
+ * are reset prior to writing each report, and freed by plcrash_log_writer_free().
+ *
+ * The page cache is optional; if its storage can not be allocated, stack memory will be read directly.
+ *
+ * @param writer The writer instance.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or PLCRASH_ENOMEM if the caches could not be allocated, in which
+ * case they will continue to be allocated for each report.
+ *
+ * @warning This method is not async safe.
+ */
+plcrash_error_t plcrash_log_writer_preallocate_caches (plcrash_log_writer_t *writer) {
+    plcrash_error_t err;
+
+    if (writer->caches.allocated)
+        return PLCRASH_ESUCCESS;
+
+    if ((err = plcrash_async_symbol_cache_init(&writer->caches.symbol_cache)) != PLCRASH_ESUCCESS)
+        return err;
+
+    if ((err = plcrash_async_symbol_cache_preallocate(&writer->caches.symbol_cache)) != PLCRASH_ESUCCESS) {
+        plcrash_async_symbol_cache_free(&writer->caches.symbol_cache);
+        return err;
+    }
+
+    if ((err = plframe_unwind_plan_cache_init(&writer->caches.plan_cache)) != PLCRASH_ESUCCESS) {
+        plframe_unwind_plan_cache_free(&writer->caches.plan_cache);
+        plcrash_async_symbol_cache_free(&writer->caches.symbol_cache);
+        return err;
+    }
+
+    /* The page cache remains usable if its storage can not be allocated; reads will be passed directly to the target */
+    plcrash_async_page_cache_init(&writer->caches.page_cache);
+    writer->caches.allocated = true;
+
+    return PLCRASH_ESUCCESS;
+}
+
 /**
  * Close the plcrash_writer_t output.
  *
@@ -575,8 +683,23 @@ void plcrash_log_writer_free (plcrash_log_writer_t *writer) {
     if (writer->custom_data.data) {
         plprotobuf_cbinary_data_free(&writer->custom_data);
     }
+
+    /* Free the preallocated caches */
+    if (writer->caches.allocated) {
+        plcrash_async_symbol_cache_free(&writer->caches.symbol_cache);
+        plframe_unwind_plan_cache_free(&writer->caches.plan_cache);
+        plcrash_async_page_cache_free(&writer->caches.page_cache);
+        writer->caches.allocated = false;
+    }
 }
 
+/**
+ * @internal
+ * The size of the stack-allocated staging buffer used to encode frame, register, and binary image messages; see
+ * plcrash_writer_message_t. Messages that do not fit are written field by field.
+ */
+#define PLCRASH_WRITER_STAGING_SIZE 512
+
 /**
  * @internal
  *
@@ -792,13 +915,15 @@ static size_t plcrash_writer_write_thread_register (plcrash_async_file_t *file,
  * Write all thread backtrace register messages
  *
  * @param file Output file
- * @param task The task from which @a uap was derived. All memory accesses will be mapped from this task.
- * @param cursor The cursor from which to acquire frame registers.
+ * @param thread_state The thread state from which to acquire register values.
  */
-static size_t plcrash_writer_write_thread_registers (plcrash_async_file_t *file, task_t task, plframe_cursor_t *cursor) {
-    PLCF_UNUSED_IN_RELEASE plframe_error_t frame_err;
-    uint32_t regCount = (uint32_t) plframe_cursor_get_regcount(cursor);
+static size_t plcrash_writer_write_thread_state_registers (plcrash_async_file_t *file, const plcrash_async_thread_state_t *thread_state) {
+    uint32_t regCount = (uint32_t) plcrash_async_thread_state_get_reg_count(thread_state);
+    uint8_t staging[PLCRASH_WRITER_STAGING_SIZE];
+    plcrash_writer_message_t msg;
     size_t rv = 0;
+
+    plcrash_writer_message_init(&msg, staging, sizeof(staging));
     
     /* Write out register messages */
     for (int i = 0; i < regCount; i++) {
@@ -807,26 +932,57 @@ static size_t plcrash_writer_write_thread_registers (plcrash_async_file_t *file,
         uint32_t msgsize;
 
         /* Fetch the register value */
-        if ((frame_err = plframe_cursor_get_reg(cursor, i, &regVal)) != PLFRAME_ESUCCESS) {
+        if (plcrash_async_thread_state_has_reg(thread_state, i)) {
+            regVal = plcrash_async_thread_state_get_reg(thread_state, i);
+        } else {
             // Should never happen
-            PLCF_DEBUG("Could not fetch register %i value: %s", i, plframe_strerror(frame_err));
+            PLCF_DEBUG("Could not fetch register %i value", i);
             regVal = 0;
         }
 
         /* Fetch the register name */
-        regname = plframe_cursor_get_regname(cursor, i);
+        regname = plcrash_async_thread_state_get_reg_name(thread_state, i);
+
+        /* Stage the register message, flushing any previously staged registers if the staging buffer is full */
+        uint64_t uint64val = regVal;
+        size_t namelen = strlen(regname);
+        size_t body = plcrash_pb_crash_report_thread_register_value__name_size(namelen) + plcrash_pb_crash_report_thread_register_value__value_size(uint64val);
+        size_t reserve = plcrash_pb_crash_report_thread__registers_size(body);
+        if (!plcrash_writer_message_reserve(&msg, reserve)) {
+            rv += plcrash_writer_message_write(file, &msg);
+            plcrash_writer_message_init(&msg, staging, sizeof(staging));
+        }
 
-        /* Get the register message size */
+        if (plcrash_writer_message_reserve(&msg, reserve)) {
+            plcrash_pb_crash_report_thread__registers_pack_header(&msg, body);
+            plcrash_pb_crash_report_thread_register_value__name_pack(&msg, regname, namelen);
+            plcrash_pb_crash_report_thread_register_value__value_pack(&msg, uint64val);
+            continue;
+        }
+
+        /* Otherwise, fall back on writing the message directly */
         msgsize = (uint32_t) plcrash_writer_write_thread_register(NULL, regname, regVal);
-        
-        /* Write the header and message */
         rv += plcrash_writer_pack(file, PLCRASH_PROTO_THREAD_REGISTERS_ID, PLPROTOBUF_C_TYPE_MESSAGE, &msgsize);
         rv += plcrash_writer_write_thread_register(file, regname, regVal);
     }
-    
+
+    rv += plcrash_writer_message_write(file, &msg);
     return rv;
 }
 
+/**
+ * @internal
+ *
+ * Write all thread backtrace register messages
+ *
+ * @param file Output file
+ * @param task The task from which @a uap was derived. All memory accesses will be mapped from this task.
+ * @param cursor The cursor from which to acquire frame registers.
+ */
+static size_t plcrash_writer_write_thread_registers (plcrash_async_file_t *file, task_t task, plframe_cursor_t *cursor) {
+    return plcrash_writer_write_thread_state_registers(file, &cursor->frame.thread_state);
+}
+
 /**
  * @internal
  *
@@ -835,40 +991,111 @@ static size_t plcrash_writer_write_thread_registers (plcrash_async_file_t *file,
  * @param file Output file
  * @param name The symbol name
  * @param start_address The symbol start address
+ * @param name_ref The string table index of the symbol name, or 0 if the name is to be written inline.
  */
-static size_t plcrash_writer_write_symbol (plcrash_async_file_t *file, const char *name, uint64_t start_address) {
+static size_t plcrash_writer_write_symbol (plcrash_async_file_t *file, const char *name, uint64_t start_address, uint32_t name_ref) {
     size_t rv = 0;
     
     /* name */
-    rv += plcrash_writer_pack(file, PLCRASH_PROTO_SYMBOL_NAME, PLPROTOBUF_C_TYPE_STRING, name);
+    rv += plcrash_writer_pack(file, PLCRASH_PROTO_SYMBOL_NAME, PLPROTOBUF_C_TYPE_STRING, name_ref != 0 ? "" : name);
     
     /* start_address */
     rv += plcrash_writer_pack(file, PLCRASH_PROTO_SYMBOL_START_ADDRESS, PLPROTOBUF_C_TYPE_UINT64, &start_address);
+
+    /* name_ref */
+    if (name_ref != 0)
+        rv += plcrash_writer_pack(file, PLCRASH_PROTO_SYMBOL_NAME_REF, PLPROTOBUF_C_TYPE_UINT32, &name_ref);
     
     return rv;
 }
 
 /**
  * @internal
- * Symbol lookup callback context
+ * Maximum length of a resolved frame symbol name, including the trailing NUL. Names are already truncated to this
+ * length by the async symbolication implementation.
+ */
+#define MAX_FRAME_SYMBOL_NAME_LENGTH 256
+
+/**
+ * @internal
+ * A frame's resolved symbol. The symbol is resolved once per frame, and then used both to determine the
+ * size of the frame message and to write it.
  */
-struct pl_symbol_cb_ctx {
-    /** File to use for writing out a symbol entry. May be NULL. */
-    plcrash_async_file_t *file;
+struct pl_frame_symbol {
+    /** If true, a symbol was found for the frame. */
+    bool found;
+
+    /** The symbol's start address. */
+    uint64_t start_address;
 
-    /** Size of the symbol entry, to be written by the callback function upon writing an entry. */
-    uint32_t msgsize;
+    /** The NUL-terminated symbol name. */
+    char name[MAX_FRAME_SYMBOL_NAME_LENGTH];
+
+    /** The string table index of the symbol name, or 0 if the name is to be written inline. */
+    uint32_t name_ref;
 };
 
 /**
  * @internal
  *
- * pl_async_macho_found_symbol_cb callback implementation. Writes the result to the file available via @a ctx,
- * which must be a valid pl_symbol_cb_ctx structure.
+ * Intern a resolved frame symbol's name, populating symbol->name_ref.
+ *
+ * @param strings The report string table, or NULL if symbol names are to be written inline.
+ * @param symbol The resolved symbol.
+ */
+static void plcrash_writer_intern_frame_symbol (plcrash_async_string_table_t *strings, struct pl_frame_symbol *symbol) {
+    symbol->name_ref = 0;
+    if (strings != NULL && symbol->found)
+        symbol->name_ref = plcrash_async_string_table_intern(strings, 0, symbol->name, strlen(symbol->name));
+}
+
+/**
+ * @internal
+ *
+ * plcrash_async_found_symbol_cb callback implementation. Copies the result to the pl_frame_symbol structure
+ * available via @a ctx.
  */
-static void plcrash_writer_write_thread_frame_symbol_cb (pl_vm_address_t address, const char *name, void *ctx) {
-    struct pl_symbol_cb_ctx *cb_ctx = ctx;
-    cb_ctx->msgsize = (uint32_t) plcrash_writer_write_symbol(cb_ctx->file, name, address);
+static void plcrash_writer_resolve_frame_symbol_cb (pl_vm_address_t address, const char *name, void *ctx) {
+    struct pl_frame_symbol *symbol = ctx;
+    size_t i;
+
+    for (i = 0; i < sizeof(symbol->name) - 1 && name[i] != '\0'; i++)
+        symbol->name[i] = name[i];
+    symbol->name[i] = '\0';
+
+    symbol->start_address = address;
+    symbol->found = true;
+}
+
+/**
+ * @internal
+ *
+ * Resolve the symbol for a thread backtrace frame.
+ *
+ * @param writer The writer context.
+ * @param pcval The frame PC value.
+ * @param image_list The Mach-O image list.
+ * @param findContext Symbol lookup cache.
+ * @param strings The report string table, or NULL if symbol names are to be written inline.
+ * @param symbol The symbol record to be populated. If no symbol is found, symbol->found will be set to false.
+ */
+static void plcrash_writer_resolve_frame_symbol (plcrash_log_writer_t *writer, uint64_t pcval, plcrash_async_image_list_t *image_list, plcrash_async_symbol_cache_t *findContext, plcrash_async_string_table_t *strings, struct pl_frame_symbol *symbol) {
+    symbol->found = false;
+    symbol->name_ref = 0;
+
+    if (writer->symbol_strategy == PLCRASH_ASYNC_SYMBOL_STRATEGY_NONE)
+        return;
+
+    plcrash_async_image_list_set_reading(image_list, true);
+    plcrash_async_image_t *image = plcrash_async_image_containing_address(image_list, (pl_vm_address_t) pcval);
+
+    /* If the symbol can not be found, our callback will not be called. */
+    if (image != NULL)
+        plcrash_async_find_symbol(&image->macho_image, writer->symbol_strategy, findContext, (pl_vm_address_t) pcval, plcrash_writer_resolve_frame_symbol_cb, symbol);
+
+    plcrash_async_image_list_set_reading(image_list, false);
+
+    plcrash_writer_intern_frame_symbol(strings, symbol);
 }
 
 /**
@@ -878,42 +1105,352 @@ static void plcrash_writer_write_thread_frame_symbol_cb (pl_vm_address_t address
  *
  * @param file Output file
  * @param pcval The frame PC value.
+ * @param symbol The frame's resolved symbol, as returned by plcrash_writer_resolve_frame_symbol().
  */
-static size_t plcrash_writer_write_thread_frame (plcrash_async_file_t *file, plcrash_log_writer_t *writer, uint64_t pcval, plcrash_async_image_list_t *image_list, plcrash_async_symbol_cache_t *findContext) {
+static size_t plcrash_writer_write_thread_frame (plcrash_async_file_t *file, uint64_t pcval, const struct pl_frame_symbol *symbol) {
     size_t rv = 0;
 
     rv += plcrash_writer_pack(file, PLCRASH_PROTO_THREAD_FRAME_PC_ID, PLPROTOBUF_C_TYPE_UINT64, &pcval);
-    
+
+    if (symbol->found) {
+        /* Get the symbol message size */
+        uint32_t msgsize = (uint32_t) plcrash_writer_write_symbol(NULL, symbol->name, symbol->start_address, symbol->name_ref);
+
+        /* Write the header and message */
+        rv += plcrash_writer_pack(file, PLCRASH_PROTO_THREAD_FRAME_SYMBOL_ID, PLPROTOBUF_C_TYPE_MESSAGE, &msgsize);
+        rv += plcrash_writer_write_symbol(file, symbol->name, symbol->start_address, symbol->name_ref);
+    }
+
+    return rv;
+}
+
+/**
+ * @internal
+ *
+ * Write a thread backtrace frame message, including the message header. The message is encoded in a staging buffer
+ * and written with a single write, falling back on plcrash_writer_write_thread_frame() if it does not fit.
+ *
+ * @param file Output file
+ * @param field_id The field identifier to be used for the frame message.
+ * @param pcval The frame PC value.
+ * @param symbol The frame's resolved symbol, as returned by plcrash_writer_resolve_frame_symbol().
+ */
+static size_t plcrash_writer_write_thread_frame_staged (plcrash_async_file_t *file, uint32_t field_id, uint64_t pcval, const struct pl_frame_symbol *symbol) {
+    uint8_t staging[PLCRASH_WRITER_STAGING_SIZE];
+    plcrash_writer_message_t msg;
+    size_t rv = 0;
+
+    plcrash_writer_message_init(&msg, staging, sizeof(staging));
+
+    /* Compute the exact size of the frame and symbol messages */
+    size_t namelen = 0;
+    size_t symbol_size = 0;
+    size_t frame_size = plcrash_pb_crash_report_thread_stack_frame__pc_size(pcval);
+    if (symbol->found) {
+        namelen = symbol->name_ref != 0 ? 0 : strlen(symbol->name);
+        symbol_size = plcrash_pb_crash_report_symbol__name_size(namelen) + plcrash_pb_crash_report_symbol__start_address_size(symbol->start_address);
+        if (symbol->name_ref != 0)
+            symbol_size += plcrash_pb_crash_report_symbol__name_ref_size(symbol->name_ref);
+        frame_size += plcrash_pb_crash_report_thread_stack_frame__symbol_size(symbol_size);
+    }
+
+    if (!plcrash_writer_message_reserve(&msg, plcrash_pb_field_size(field_id, frame_size))) {
+        uint32_t msgsize = (uint32_t) plcrash_writer_write_thread_frame(NULL, pcval, symbol);
+        rv += plcrash_writer_pack(file, field_id, PLPROTOBUF_C_TYPE_MESSAGE, &msgsize);
+        rv += plcrash_writer_write_thread_frame(file, pcval, symbol);
+        return rv;
+    }
+
+    plcrash_pb_put_field_header(&msg, field_id, frame_size);
+    plcrash_pb_crash_report_thread_stack_frame__pc_pack(&msg, pcval);
+
+    if (symbol->found) {
+        plcrash_pb_crash_report_thread_stack_frame__symbol_pack_header(&msg, symbol_size);
+        plcrash_pb_crash_report_symbol__name_pack(&msg, symbol->name, namelen);
+        plcrash_pb_crash_report_symbol__start_address_pack(&msg, symbol->start_address);
+        if (symbol->name_ref != 0)
+            plcrash_pb_crash_report_symbol__name_ref_pack(&msg, symbol->name_ref);
+    }
+
+    return plcrash_writer_message_write(file, &msg);
+}
+
+/**
+ * @internal
+ *
+ * Symbolicate and write a thread backtrace frame message, including the message header.
+ *
+ * @param file Output file
+ * @param writer The writer context.
+ * @param field_id The field identifier to be used for the frame message.
+ * @param pcval The frame PC value.
+ * @param image_list The Mach-O image list.
+ * @param findContext Symbol lookup cache.
+ * @param strings The report string table, or NULL if symbol names are to be written inline.
+ */
+static size_t plcrash_writer_write_thread_frame_message (plcrash_async_file_t *file, plcrash_log_writer_t *writer, uint32_t field_id, uint64_t pcval, plcrash_async_image_list_t *image_list, plcrash_async_symbol_cache_t *findContext, plcrash_async_string_table_t *strings) {
+    struct pl_frame_symbol symbol;
+
+    /* Symbolicate the frame once; the result is used to both size and write the frame. */
+    plcrash_writer_resolve_frame_symbol(writer, pcval, image_list, findContext, strings, &symbol);
+
+    return plcrash_writer_write_thread_frame_staged(file, field_id, pcval, &symbol);
+}
+
+/**
+ * @internal
+ * The number of entries in the plcrash_writer_image_index_t cache.
+ */
+#define PLCRASH_WRITER_IMAGE_INDEX_CACHE_SIZE 16
+
+/**
+ * @internal
+ *
+ * Maps addresses to their binary image's 1-based index within the report's binary_images, as required to write
+ * packed stack frames.
+ *
+ * The image list order is captured once, when the index is initialized, and the report's binary images are written
+ * from this snapshot rather than from the live image list; frame indices and binary images are therefore
+ * consistent even if images are added to or removed from the image list while the report is written, as occurs once
+ * the parallel unwind path has resumed the task's threads. The image list is retained for reading until the index is
+ * freed, ensuring that the snapshotted images are not reclaimed.
+ */
+typedef struct plcrash_writer_image_index {
+    /** The image list from which the snapshot was taken. */
+    plcrash_async_image_list_t *image_list;
+
+    /** The snapshotted images, in the order in which they will be written to the report. */
+    plcrash_async_image_t **images;
+
+    /** The number of entries in images. */
+    uint32_t count;
+
+    /** The size of the vm_allocate()'d images storage, in bytes. */
+    vm_size_t storage_size;
+
+    /** The 1-based index of the image most recently found for each address region, direct-mapped by 4KiB region, or 0
+     * if the entry is unused. */
+    uint32_t cache[PLCRASH_WRITER_IMAGE_INDEX_CACHE_SIZE];
+} plcrash_writer_image_index_t;
+
+/**
+ * @internal
+ *
+ * Initialize an image index, snapshotting the current order of @a image_list. On success, @a image_list will be
+ * retained for reading until the index is freed via plcrash_writer_image_index_free().
+ *
+ * @param index The image index to initialize.
+ * @param image_list The image list from which the report's binary images will be written.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or PLCRASH_ENOMEM if snapshot storage could not be allocated.
+ */
+static plcrash_error_t plcrash_writer_image_index_init (plcrash_writer_image_index_t *index, plcrash_async_image_list_t *image_list) {
+    plcrash_async_memset(index, 0, sizeof(*index));
+    index->image_list = image_list;
+
     plcrash_async_image_list_set_reading(image_list, true);
-    plcrash_async_image_t *image = plcrash_async_image_containing_address(image_list, (pl_vm_address_t) pcval);
-    
-    if (image != NULL && writer->symbol_strategy != PLCRASH_ASYNC_SYMBOL_STRATEGY_NONE) {
-        struct pl_symbol_cb_ctx ctx;
-        plcrash_error_t ret;
-        
-        /* Get the symbol message size. If the symbol can not be found, our callback will not be called. If the symbol is found,
-         * our callback is called and PLCRASH_ESUCCESS is returned. */
-        ctx.file = NULL;
-        ctx.msgsize = 0x0;
-        ret = plcrash_async_find_symbol(&image->macho_image, writer->symbol_strategy, findContext, (pl_vm_address_t) pcval, plcrash_writer_write_thread_frame_symbol_cb, &ctx);
-        if (ret == PLCRASH_ESUCCESS) {
-            /* Write the header and message */
-            rv += plcrash_writer_pack(file, PLCRASH_PROTO_THREAD_FRAME_SYMBOL_ID, PLPROTOBUF_C_TYPE_MESSAGE, &ctx.msgsize);
-
-            ctx.file = file;
-            ret = plcrash_async_find_symbol(&image->macho_image, writer->symbol_strategy, findContext, (pl_vm_address_t) pcval, plcrash_writer_write_thread_frame_symbol_cb, &ctx);
-            if (ret == PLCRASH_ESUCCESS) {
-                rv += ctx.msgsize;
-            } else {
-                /* This should not happen, but it would be very confusing if it did and nothing was logged. */
-                PLCF_DEBUG("Fetching the symbol unexpectedly failed during the second call");
+
+    /* Size the snapshot storage. Images appended after the list has been counted are omitted from the snapshot. */
+    uint32_t capacity = 0;
+    plcrash_async_image_t *image = NULL;
+    while ((image = plcrash_async_image_list_next(image_list, image)) != NULL)
+        capacity++;
+
+    vm_address_t storage;
+    index->storage_size = round_page((capacity > 0 ? capacity : 1) * sizeof(index->images[0]));
+    kern_return_t kr = vm_allocate(mach_task_self(), &storage, index->storage_size, VM_FLAGS_ANYWHERE);
+    if (kr != KERN_SUCCESS) {
+        PLCF_DEBUG("vm_allocate failed for image index storage: %d", kr);
+        plcrash_async_image_list_set_reading(image_list, false);
+        return PLCRASH_ENOMEM;
+    }
+    index->images = (plcrash_async_image_t **) storage;
+
+    image = NULL;
+    while (index->count < capacity && (image = plcrash_async_image_list_next(image_list, image)) != NULL)
+        index->images[index->count++] = image;
+
+    return PLCRASH_ESUCCESS;
+}
+
+/**
+ * @internal
+ *
+ * Free an image index initialized via plcrash_writer_image_index_init(), releasing the image list.
+ */
+static void plcrash_writer_image_index_free (plcrash_writer_image_index_t *index) {
+    vm_deallocate(mach_task_self(), (vm_address_t) index->images, index->storage_size);
+    plcrash_async_image_list_set_reading(index->image_list, false);
+}
+
+/**
+ * @internal
+ *
+ * Find the snapshotted binary image containing @a pc.
+ *
+ * @param index The image index.
+ * @param pc The address to look up.
+ * @param base_address On return, the base address of the image, or 0 if no image was found.
+ *
+ * @return Returns the image's 1-based index within the report's binary images, or 0 if @a pc is not within a
+ * snapshotted image.
+ */
+static uint32_t plcrash_writer_image_index_find (plcrash_writer_image_index_t *index, uint64_t pc, uint64_t *base_address) {
+    *base_address = 0;
+
+    /* Check the image most recently found within the same region; frames are typically clustered within a few images */
+    size_t slot = (size_t) (pc >> 12) % PLCRASH_WRITER_IMAGE_INDEX_CACHE_SIZE;
+    uint32_t result = index->cache[slot];
+    if (result == 0 || !plcrash_async_macho_contains_address(&index->images[result - 1]->macho_image, (pl_vm_address_t) pc)) {
+        /* Search the snapshot in the order used to write the report's binary images */
+        result = 0;
+        for (uint32_t i = 0; i < index->count; i++) {
+            if (plcrash_async_macho_contains_address(&index->images[i]->macho_image, (pl_vm_address_t) pc)) {
+                result = i + 1;
+                break;
             }
         }
+
+        if (result == 0)
+            return 0;
+
+        index->cache[slot] = result;
     }
 
-    plcrash_async_image_list_set_reading(image_list, false);
+    *base_address = (uintptr_t) index->images[result - 1]->macho_image.header_addr;
+    return result;
+}
+
+/**
+ * @internal
+ *
+ * Write a frame symbol record, including the message header.
+ *
+ * @param file Output file
+ * @param frame The index of the symbol's frame within the thread's packed frames.
+ * @param symbol The frame's resolved symbol.
+ * @param base_address The base address of the frame's binary image, or 0 if the frame is not within an image.
+ */
+static size_t plcrash_writer_write_frame_symbol (plcrash_async_file_t *file, uint32_t frame, const struct pl_frame_symbol *symbol, uint64_t base_address) {
+    uint8_t staging[PLCRASH_WRITER_STAGING_SIZE];
+    plcrash_writer_message_t msg;
+
+    size_t namelen = symbol->name_ref != 0 ? 0 : strlen(symbol->name);
+    uint64_t start_offset = symbol->start_address - base_address;
+    size_t size = plcrash_pb_crash_report_thread_frame_symbol__frame_size(frame) +
+        plcrash_pb_crash_report_thread_frame_symbol__name_size(namelen) +
+        plcrash_pb_crash_report_thread_frame_symbol__start_offset_size(start_offset);
+    if (symbol->name_ref != 0)
+        size += plcrash_pb_crash_report_thread_frame_symbol__name_ref_size(symbol->name_ref);
+
+    /* Symbol names are bounded by MAX_FRAME_SYMBOL_NAME_LENGTH, and will always fit */
+    plcrash_writer_message_init(&msg, staging, sizeof(staging));
+    if (!plcrash_writer_message_reserve(&msg, plcrash_pb_crash_report_thread__frame_symbols_size(size))) {
+        PLCF_DEBUG("Frame symbol exceeds the staging buffer size; omitting symbol for frame %u", frame);
+        return 0;
+    }
+
+    plcrash_pb_crash_report_thread__frame_symbols_pack_header(&msg, size);
+    plcrash_pb_crash_report_thread_frame_symbol__frame_pack(&msg, frame);
+    plcrash_pb_crash_report_thread_frame_symbol__name_pack(&msg, symbol->name, namelen);
+    plcrash_pb_crash_report_thread_frame_symbol__start_offset_pack(&msg, start_offset);
+    if (symbol->name_ref != 0)
+        plcrash_pb_crash_report_thread_frame_symbol__name_ref_pack(&msg, symbol->name_ref);
+
+    return plcrash_writer_message_write(file, &msg);
+}
+
+/**
+ * @internal
+ *
+ * Packed stack frame writer state for a single thread (report format v2).
+ *
+ * Each frame's (image index, offset) pair is appended to a staging buffer, which is written as a chunk of the
+ * thread's packed_frames field whenever it fills; a packed field may be split across any number of chunks. Symbol
+ * records are written as each frame is added.
+ */
+typedef struct plcrash_writer_packed_frames {
+    /** The report's image index. */
+    plcrash_writer_image_index_t *images;
+
+    /** Pending frame pairs. */
+    plcrash_writer_message_t msg;
+
+    /** Backing storage for msg. */
+    uint8_t staging[PLCRASH_WRITER_STAGING_SIZE];
+
+    /** The number of frames added. */
+    uint32_t frame_count;
+} plcrash_writer_packed_frames_t;
+
+/**
+ * @internal
+ *
+ * Initialize a packed stack frame writer.
+ *
+ * @param frames The writer state to initialize.
+ * @param images The report's image index.
+ */
+static void plcrash_writer_packed_frames_init (plcrash_writer_packed_frames_t *frames, plcrash_writer_image_index_t *images) {
+    frames->images = images;
+    frames->frame_count = 0;
+    plcrash_writer_message_init(&frames->msg, frames->staging, sizeof(frames->staging));
+}
+
+/**
+ * @internal
+ *
+ * Write any pending frame pairs as a packed_frames chunk.
+ *
+ * @param file Output file
+ * @param frames The packed frame writer.
+ */
+static size_t plcrash_writer_packed_frames_flush (plcrash_async_file_t *file, plcrash_writer_packed_frames_t *frames) {
+    uint8_t header[PLCRASH_WRITER_MESSAGE_HEADER_SIZE];
+    plcrash_writer_message_t msg;
+    size_t rv = 0;
+
+    if (frames->msg.length == 0)
+        return 0;
+
+    plcrash_writer_message_init(&msg, header, sizeof(header));
+    plcrash_pb_crash_report_thread__packed_frames_pack_header(&msg, frames->msg.length);
+
+    rv += plcrash_writer_message_write(file, &msg);
+    rv += plcrash_writer_message_write(file, &frames->msg);
+
+    plcrash_writer_message_init(&frames->msg, frames->staging, sizeof(frames->staging));
+    return rv;
+}
+
+/**
+ * @internal
+ *
+ * Add a frame to a thread's packed frames, writing its symbol record (if any) and any pending frame pairs that
+ * must be flushed to make room for the frame. Pending frames must be written with plcrash_writer_packed_frames_flush()
+ * once all frames have been added.
+ *
+ * @param file Output file
+ * @param frames The packed frame writer.
+ * @param pcval The frame PC value.
+ * @param symbol The frame's resolved symbol.
+ */
+static size_t plcrash_writer_packed_frames_add (plcrash_async_file_t *file, plcrash_writer_packed_frames_t *frames, uint64_t pcval, const struct pl_frame_symbol *symbol) {
+    size_t rv = 0;
+    uint64_t base_address;
+    uint32_t image_index = plcrash_writer_image_index_find(frames->images, pcval, &base_address);
+    uint64_t offset = pcval - base_address;
+
+    if (!plcrash_writer_message_reserve(&frames->msg, plcrash_pb_varint_size(image_index) + plcrash_pb_varint_size(offset)))
+        rv += plcrash_writer_packed_frames_flush(file, frames);
 
+    plcrash_pb_put_varint(&frames->msg, image_index);
+    plcrash_pb_put_varint(&frames->msg, offset);
 
+    if (symbol->found)
+        rv += plcrash_writer_write_frame_symbol(file, frames->frame_count, symbol, base_address);
+
+    frames->frame_count++;
     return rv;
 }
 
@@ -930,6 +1467,10 @@ static size_t plcrash_writer_write_thread_frame (plcrash_async_file_t *file, plc
  * @a thread is the currently executing thread, <em>must</em> be non-NULL.
  * @param image_list The Mach-O image list.
  * @param findContext Symbol lookup cache.
+ * @param pageCache Page cache through which stack memory will be read, or NULL.
+ * @param images If non-NULL, the frames will be written as packed, image-relative frames (report format v2)
+ * using this image index.
+ * @param strings The report string table, or NULL if symbol names are to be written inline.
  * @param crashed If true, mark this as a crashed thread.
  */
 static size_t plcrash_writer_write_thread (plcrash_async_file_t *file,
@@ -940,11 +1481,15 @@ static size_t plcrash_writer_write_thread (plcrash_async_file_t *file,
                                            plcrash_async_thread_state_t *thread_ctx,
                                            plcrash_async_image_list_t *image_list,
                                            plcrash_async_symbol_cache_t *findContext,
+                                           plcrash_async_page_cache_t *pageCache,
+                                           plcrash_writer_image_index_t *images,
+                                           plcrash_async_string_table_t *strings,
                                            bool crashed)
 {
     size_t rv = 0;
     plframe_cursor_t cursor;
     plframe_error_t ferr;
+    plcrash_writer_packed_frames_t packed;
 
     /* A context must be supplied when walking the current thread */
     PLCF_ASSERT(task != mach_task_self() || thread_ctx != NULL || thread != pl_mach_thread_self());
@@ -979,13 +1524,16 @@ static size_t plcrash_writer_write_thread (plcrash_async_file_t *file,
                 PLCF_DEBUG("An error occured initializing the frame cursor: %s", plframe_strerror(ferr));
                 return rv;
             }
+
+            plframe_cursor_set_page_cache(&cursor, pageCache);
         }
 
+        if (images != NULL)
+            plcrash_writer_packed_frames_init(&packed, images);
+
         /* Walk the stack, limiting the total number of frames that are output. */
         uint32_t frame_count = 0;
         while ((ferr = plframe_cursor_next(&cursor)) == PLFRAME_ESUCCESS && frame_count < MAX_THREAD_FRAMES) {
-            uint32_t frame_size;
-            
             /* On the first frame, dump registers for the crashed thread */
             if (frame_count == 0 && crashed) {
                 rv += plcrash_writer_write_thread_registers(file, task, &cursor);
@@ -998,14 +1546,19 @@ static size_t plcrash_writer_write_thread (plcrash_async_file_t *file,
                 break;
             }
 
-            /* Determine the size */
-            frame_size = (uint32_t) plcrash_writer_write_thread_frame(NULL, writer, pc, image_list, findContext);
-            
-            rv += plcrash_writer_pack(file, PLCRASH_PROTO_THREAD_FRAMES_ID, PLPROTOBUF_C_TYPE_MESSAGE, &frame_size);
-            rv += plcrash_writer_write_thread_frame(file, writer, pc, image_list, findContext);
+            if (images != NULL) {
+                struct pl_frame_symbol symbol;
+                plcrash_writer_resolve_frame_symbol(writer, pc, image_list, findContext, strings, &symbol);
+                rv += plcrash_writer_packed_frames_add(file, &packed, pc, &symbol);
+            } else {
+                rv += plcrash_writer_write_thread_frame_message(file, writer, PLCRASH_PROTO_THREAD_FRAMES_ID, pc, image_list, findContext, strings);
+            }
             frame_count++;
         }
 
+        if (images != NULL)
+            rv += plcrash_writer_packed_frames_flush(file, &packed);
+
         /* Did we reach the end successfully? */
         if (ferr != PLFRAME_ENOFRAME) {
             /* This is non-fatal, and in some circumstances -could- be caused by reaching the end of the stack if the
@@ -1019,6 +1572,75 @@ static size_t plcrash_writer_write_thread (plcrash_async_file_t *file,
 }
 
 
+/**
+ * @internal
+ *
+ * Write a thread message from a thread previously unwound and symbolicated via the parallel unwind engine.
+ *
+ * @param file Output file
+ * @param thread_number The thread's index number.
+ * @param thread The unwound thread.
+ * @param images If non-NULL, the frames will be written as packed, image-relative frames (report format v2)
+ * using this image index.
+ * @param strings The report string table, or NULL if symbol names are to be written inline.
+ * @param crashed If true, mark this as a crashed thread.
+ */
+static size_t plcrash_writer_write_unwound_thread (plcrash_async_file_t *file,
+                                                   uint32_t thread_number,
+                                                   const plcrash_parallel_unwind_thread_t *thread,
+                                                   plcrash_writer_image_index_t *images,
+                                                   plcrash_async_string_table_t *strings,
+                                                   bool crashed)
+{
+    size_t rv = 0;
+    plcrash_writer_packed_frames_t packed;
+
+    /* Write the thread ID */
+    rv += plcrash_writer_pack(file, PLCRASH_PROTO_THREAD_THREAD_NUMBER_ID, PLPROTOBUF_C_TYPE_UINT32, &thread_number);
+
+    /* Note crashed status */
+    rv += plcrash_writer_pack(file, PLCRASH_PROTO_THREAD_CRASHED_ID, PLPROTOBUF_C_TYPE_BOOL, &crashed);
+
+    /* Dump registers for the crashed thread; the first frame's registers are those of the initial thread state */
+    if (thread->frame_count > 0 && crashed)
+        rv += plcrash_writer_write_thread_state_registers(file, &thread->thread_state);
+
+    /* Write out the stack frames */
+    if (images != NULL)
+        plcrash_writer_packed_frames_init(&packed, images);
+
+    for (uint32_t i = 0; i < thread->frame_count; i++) {
+        const plcrash_parallel_unwind_frame_t *frame = &thread->frames[i];
+        struct pl_frame_symbol symbol;
+
+        symbol.found = false;
+        if (frame->symbol_name != NULL) {
+            size_t len;
+            for (len = 0; len < sizeof(symbol.name) - 1 && frame->symbol_name[len] != '\0'; len++)
+                symbol.name[len] = frame->symbol_name[len];
+            symbol.name[len] = '\0';
+
+            symbol.start_address = frame->symbol_start;
+            symbol.found = true;
+        }
+        plcrash_writer_intern_frame_symbol(strings, &symbol);
+
+        if (images != NULL) {
+            rv += plcrash_writer_packed_frames_add(file, &packed, frame->pc, &symbol);
+        } else {
+            rv += plcrash_writer_write_thread_frame_staged(file, PLCRASH_PROTO_THREAD_FRAMES_ID, frame->pc, &symbol);
+        }
+    }
+
+    if (images != NULL)
+        rv += plcrash_writer_packed_frames_flush(file, &packed);
+
+    if (thread->error != PLFRAME_ENOFRAME)
+        PLCF_DEBUG("Terminated stack walking early: %s", plframe_strerror(thread->error));
+
+    return rv;
+}
+
 /**
  * @internal
  *
@@ -1026,8 +1648,9 @@ static size_t plcrash_writer_write_thread (plcrash_async_file_t *file,
  *
  * @param file Output file
  * @param image Mach-O image.
+ * @param name_ref The string table index of the image name, or 0 if the name is to be written inline.
  */
-static size_t plcrash_writer_write_binary_image (plcrash_async_file_t *file, plcrash_async_macho_t *image) {
+static size_t plcrash_writer_write_binary_image (plcrash_async_file_t *file, plcrash_async_macho_t *image, uint32_t name_ref) {
     size_t rv = 0;
 
     /* Fetch the CPU types. Note that the wire format represents these as 64-bit unsigned integers.
@@ -1050,7 +1673,9 @@ static size_t plcrash_writer_write_binary_image (plcrash_async_file_t *file, plc
     }
 
     /* Name */
-    rv += plcrash_writer_pack(file, PLCRASH_PROTO_BINARY_IMAGE_NAME_ID, PLPROTOBUF_C_TYPE_STRING, image->name);
+    rv += plcrash_writer_pack(file, PLCRASH_PROTO_BINARY_IMAGE_NAME_ID, PLPROTOBUF_C_TYPE_STRING, name_ref != 0 ? "" : image->name);
+    if (name_ref != 0)
+        rv += plcrash_writer_pack(file, PLCRASH_PROTO_BINARY_IMAGE_NAME_REF_ID, PLPROTOBUF_C_TYPE_UINT32, &name_ref);
 
     /* UUID */
     struct uuid_command *uuid;
@@ -1074,6 +1699,128 @@ static size_t plcrash_writer_write_binary_image (plcrash_async_file_t *file, plc
     return rv;
 }
 
+/**
+ * @internal
+ *
+ * Write a binary image message, including the message header. The message is encoded in a staging buffer and
+ * written with a single write, falling back on plcrash_writer_write_binary_image() if it does not fit.
+ *
+ * @param file Output file
+ * @param image Mach-O image.
+ * @param strings The report string table, or NULL if the image name is to be written inline.
+ */
+static size_t plcrash_writer_write_binary_image_message (plcrash_async_file_t *file, plcrash_async_macho_t *image, plcrash_async_string_table_t *strings) {
+    uint8_t staging[PLCRASH_WRITER_STAGING_SIZE];
+    plcrash_writer_message_t msg;
+
+    plcrash_writer_message_init(&msg, staging, sizeof(staging));
+
+    /* Fetch the CPU types. Note that the wire format represents these as 64-bit unsigned integers.
+     * We explicitly cast to an equivalently sized unsigned type to prevent improper sign extension. */
+    uint64_t cpu_type = (uint32_t) image->byteorder->swap32(image->header.cputype);
+    uint64_t cpu_subtype = (uint32_t) image->byteorder->swap32(image->header.cpusubtype);
+    uint64_t mach_size = image->text_size;
+    uint64_t base_addr = (uintptr_t) image->header_addr;
+    uint32_t name_ref = strings != NULL ? plcrash_async_string_table_intern_path(strings, image->name) : 0;
+    size_t namelen = name_ref != 0 ? 0 : strlen(image->name);
+
+    /* Compute the exact size of the image and processor messages */
+    struct uuid_command *uuid = plcrash_async_macho_find_command(image, LC_UUID);
+    size_t processor_size = plcrash_pb_crash_report_processor__encoding_size(PLCrashReportProcessorTypeEncodingMach) +
+        plcrash_pb_crash_report_processor__type_size(cpu_type) +
+        plcrash_pb_crash_report_processor__subtype_size(cpu_subtype);
+    size_t image_size = plcrash_pb_crash_report_binary_image__size_size(mach_size) +
+        plcrash_pb_crash_report_binary_image__base_address_size(base_addr) +
+        plcrash_pb_crash_report_binary_image__name_size(namelen) +
+        plcrash_pb_crash_report_binary_image__code_type_size(processor_size);
+    if (uuid != NULL)
+        image_size += plcrash_pb_crash_report_binary_image__uuid_size(sizeof(uuid->uuid));
+    if (name_ref != 0)
+        image_size += plcrash_pb_crash_report_binary_image__name_ref_size(name_ref);
+
+    if (!plcrash_writer_message_reserve(&msg, plcrash_pb_crash_report__binary_images_size(image_size))) {
+        uint32_t size = (uint32_t) plcrash_writer_write_binary_image(NULL, image, name_ref);
+        size_t rv = plcrash_writer_pack(file, PLCRASH_PROTO_BINARY_IMAGES_ID, PLPROTOBUF_C_TYPE_MESSAGE, &size);
+        rv += plcrash_writer_write_binary_image(file, image, name_ref);
+        return rv;
+    }
+
+    /* Fields are packed in the order used by plcrash_writer_write_binary_image() */
+    plcrash_pb_crash_report__binary_images_pack_header(&msg, image_size);
+    plcrash_pb_crash_report_binary_image__size_pack(&msg, mach_size);
+    plcrash_pb_crash_report_binary_image__base_address_pack(&msg, base_addr);
+    plcrash_pb_crash_report_binary_image__name_pack(&msg, image->name, namelen);
+    if (name_ref != 0)
+        plcrash_pb_crash_report_binary_image__name_ref_pack(&msg, name_ref);
+
+    if (uuid != NULL)
+        plcrash_pb_crash_report_binary_image__uuid_pack(&msg, uuid->uuid, sizeof(uuid->uuid));
+
+    /* Processor info */
+    plcrash_pb_crash_report_binary_image__code_type_pack_header(&msg, processor_size);
+    plcrash_pb_crash_report_processor__encoding_pack(&msg, PLCrashReportProcessorTypeEncodingMach);
+    plcrash_pb_crash_report_processor__type_pack(&msg, cpu_type);
+    plcrash_pb_crash_report_processor__subtype_pack(&msg, cpu_subtype);
+
+    return plcrash_writer_message_write(file, &msg);
+}
+
+/**
+ * @internal
+ *
+ * Write the entries of the report string table. Entries are encoded in a staging buffer and written in batches;
+ * an entry that does not fit within the staging buffer is written directly.
+ *
+ * @param file Output file
+ * @param strings The report string table.
+ */
+static size_t plcrash_writer_write_string_table (plcrash_async_file_t *file, plcrash_async_string_table_t *strings) {
+    uint8_t staging[PLCRASH_WRITER_STAGING_SIZE];
+    plcrash_writer_message_t msg;
+    size_t rv = 0;
+
+    plcrash_writer_message_init(&msg, staging, sizeof(staging));
+
+    uint32_t count = plcrash_async_string_table_count(strings);
+    for (uint32_t i = 1; i <= count; i++) {
+        uint32_t prefix;
+        size_t len;
+        const char *suffix = plcrash_async_string_table_get(strings, i, &prefix, &len);
+
+        size_t entry_size = plcrash_pb_crash_report_string_table_entry__suffix_size(len);
+        if (prefix != 0)
+            entry_size += plcrash_pb_crash_report_string_table_entry__prefix_size(prefix);
+
+        size_t size = plcrash_pb_crash_report__string_table_size(entry_size);
+        if (!plcrash_writer_message_reserve(&msg, size)) {
+            rv += plcrash_writer_message_write(file, &msg);
+            plcrash_writer_message_init(&msg, staging, sizeof(staging));
+        }
+
+        if (plcrash_writer_message_reserve(&msg, size)) {
+            plcrash_pb_crash_report__string_table_pack_header(&msg, entry_size);
+            if (prefix != 0)
+                plcrash_pb_crash_report_string_table_entry__prefix_pack(&msg, prefix);
+            plcrash_pb_crash_report_string_table_entry__suffix_pack(&msg, suffix, len);
+        } else {
+            /* Write the entry header and suffix length from the (empty) staging buffer, followed by the suffix */
+            plcrash_pb_crash_report__string_table_pack_header(&msg, entry_size);
+            if (prefix != 0)
+                plcrash_pb_crash_report_string_table_entry__prefix_pack(&msg, prefix);
+            plcrash_pb_put_tag(&msg, PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__SUFFIX_TAG, PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__SUFFIX_TAG_SIZE);
+            plcrash_pb_put_varint(&msg, len);
+
+            rv += plcrash_writer_message_write(file, &msg);
+            plcrash_async_file_write(file, suffix, len);
+            rv += len;
+
+            plcrash_writer_message_init(&msg, staging, sizeof(staging));
+        }
+    }
+
+    rv += plcrash_writer_message_write(file, &msg);
+    return rv;
+}
 
 /**
  * @internal
@@ -1082,8 +1829,11 @@ static size_t plcrash_writer_write_binary_image (plcrash_async_file_t *file, plc
  *
  * @param file Output file
  * @param writer Writer containing exception data
+ * @param image_list The Mach-O image list.
+ * @param findContext Symbol lookup cache.
+ * @param strings The report string table, or NULL if symbol names are to be written inline.
  */
-static size_t plcrash_writer_write_exception (plcrash_async_file_t *file, plcrash_log_writer_t *writer, plcrash_async_image_list_t *image_list, plcrash_async_symbol_cache_t *findContext) {
+static size_t plcrash_writer_write_exception (plcrash_async_file_t *file, plcrash_log_writer_t *writer, plcrash_async_image_list_t *image_list, plcrash_async_symbol_cache_t *findContext, plcrash_async_string_table_t *strings) {
     size_t rv = 0;
 
     /* Write the name and reason */
@@ -1095,12 +1845,8 @@ static size_t plcrash_writer_write_exception (plcrash_async_file_t *file, plcras
     uint32_t frame_count = 0;
     for (size_t i = 0; i < writer->uncaught_exception.callstack_count && frame_count < MAX_THREAD_FRAMES; i++) {
         uint64_t pc = (uint64_t)(uintptr_t) writer->uncaught_exception.callstack[i];
-        
-        /* Determine the size */
-        uint32_t frame_size = (uint32_t) plcrash_writer_write_thread_frame(NULL, writer, pc, image_list, findContext);
-        
-        rv += plcrash_writer_pack(file, PLCRASH_PROTO_EXCEPTION_FRAMES_ID, PLPROTOBUF_C_TYPE_MESSAGE, &frame_size);
-        rv += plcrash_writer_write_thread_frame(file, writer, pc, image_list, findContext);
+
+        rv += plcrash_writer_write_thread_frame_message(file, writer, PLCRASH_PROTO_EXCEPTION_FRAMES_ID, pc, image_list, findContext, strings);
         frame_count++;
     }
 
@@ -1211,6 +1957,55 @@ static size_t plcrash_writer_write_report_info (plcrash_async_file_t *file, plcr
     return rv;
 }
 
+/**
+ * @internal
+ *
+ * Allocate parallel unwind state for up to @a thread_count threads, and spawn the writer's configured unwind workers.
+ *
+ * @param writer The writer context.
+ * @param pool The pool to be initialized.
+ * @param thread_count The maximum number of threads to be unwound.
+ *
+ * @return Returns the allocated thread records, or NULL if the parallel unwind engine could not be initialized, in
+ * which case threads should be unwound serially. The result must be freed via plcrash_writer_parallel_unwind_free().
+ */
+static plcrash_parallel_unwind_thread_t *plcrash_writer_parallel_unwind_prepare (plcrash_log_writer_t *writer, plcrash_parallel_unwind_pool_t *pool, mach_msg_type_number_t thread_count) {
+    plcrash_parallel_unwind_thread_t *threads = calloc(thread_count > 0 ? thread_count : 1, sizeof(threads[0]));
+    if (threads == NULL)
+        return NULL;
+
+    for (mach_msg_type_number_t i = 0; i < thread_count; i++) {
+        if (plcrash_nasync_parallel_unwind_thread_init(&threads[i], MAX_THREAD_FRAMES) != PLCRASH_ESUCCESS) {
+            for (mach_msg_type_number_t j = 0; j < i; j++)
+                plcrash_nasync_parallel_unwind_thread_free(&threads[j]);
+            free(threads);
+            return NULL;
+        }
+    }
+
+    if (plcrash_nasync_parallel_unwind_pool_init(pool, writer->unwind_workers) != PLCRASH_ESUCCESS) {
+        for (mach_msg_type_number_t i = 0; i < thread_count; i++)
+            plcrash_nasync_parallel_unwind_thread_free(&threads[i]);
+        free(threads);
+        return NULL;
+    }
+
+    return threads;
+}
+
+/**
+ * @internal
+ *
+ * Free the parallel unwind state allocated by plcrash_writer_parallel_unwind_prepare().
+ */
+static void plcrash_writer_parallel_unwind_free (plcrash_parallel_unwind_pool_t *pool, plcrash_parallel_unwind_thread_t *threads, mach_msg_type_number_t thread_count) {
+    plcrash_nasync_parallel_unwind_pool_free(pool);
+
+    for (mach_msg_type_number_t i = 0; i < thread_count; i++)
+        plcrash_nasync_parallel_unwind_thread_free(&threads[i]);
+    free(threads);
+}
+
 /**
  * Write the crash report. All other running threads are suspended while the crash report is generated.
  *
@@ -1245,22 +2040,120 @@ plcrash_error_t plcrash_log_writer_write (plcrash_log_writer_t *writer,
         thread_count = 0;
     }
     
+    /* If enabled, prepare the parallel unwind engine. This requires allocation and thread creation, and so must be
+     * done prior to suspending the task's threads; as the thread list has already been fetched, the engine's own
+     * worker threads will be neither suspended nor reported. */
+    plcrash_parallel_unwind_pool_t unwind_pool;
+    plcrash_parallel_unwind_thread_t *unwound_threads = NULL;
+    size_t unwound_count = 0;
+    if (writer->unwind_workers > 0)
+        unwound_threads = plcrash_writer_parallel_unwind_prepare(writer, &unwind_pool, thread_count);
+
     /* Suspend all but the current thread. */
     for (mach_msg_type_number_t i = 0; i < thread_count; i++) {
         if (threads[i] != pl_mach_thread_self())
             thread_suspend(threads[i]);
     }
+    bool threads_suspended = true;
+
+    /* If enabled, snapshot the image list order used to write packed stack frames. This must be done while the task's
+     * threads are suspended, as they may be resumed by the parallel unwind path before any frames are written. If
+     * snapshot storage can not be allocated, individual frames will be written. */
+    plcrash_writer_image_index_t image_index;
+    plcrash_writer_image_index_t *packed_images = NULL;
+    if (writer->packed_frames && plcrash_writer_image_index_init(&image_index, image_list) == PLCRASH_ESUCCESS)
+        packed_images = &image_index;
+
+    /* Walk all thread stacks in parallel; once complete, the suspended threads are no longer required, and may be
+     * resumed prior to symbolication. */
+    if (unwound_threads != NULL) {
+        for (mach_msg_type_number_t i = 0; i < thread_count; i++) {
+            if (pl_mach_thread_self() == threads[i]) {
+                /* Can't log a report for the current thread without a valid context. */
+                if (current_state == NULL)
+                    continue;
+
+                plcrash_async_thread_state_copy(&unwound_threads[unwound_count].thread_state, current_state);
+            } else {
+                plcrash_async_thread_state_mach_thread_init(&unwound_threads[unwound_count].thread_state, threads[i]);
+            }
 
-    /* Set up a symbol-finding context. */
-    plcrash_async_symbol_cache_t findContext;
-    plcrash_error_t err = plcrash_async_symbol_cache_init(&findContext);
-    /* Abort if it failed, although that should never actually happen, ever. */
-    if (err != PLCRASH_ESUCCESS)
-        return err;
+            unwound_count++;
+        }
+
+        plcrash_parallel_unwind_pool_walk(&unwind_pool, mach_task_self(), image_list, unwound_threads, unwound_count);
+
+        for (mach_msg_type_number_t i = 0; i < thread_count; i++) {
+            if (threads[i] != pl_mach_thread_self())
+                thread_resume(threads[i]);
+        }
+        threads_suspended = false;
+
+        plcrash_nasync_parallel_unwind_pool_symbolicate(&unwind_pool, image_list, writer->symbol_strategy, unwound_threads, unwound_count);
+    }
+
+    /* Set up the report caches. If the caches were allocated ahead of time via plcrash_log_writer_preallocate_caches(),
+     * they are reset and reused; otherwise, they are allocated for the duration of this report. */
+    plcrash_async_symbol_cache_t localSymbolCache;
+    plframe_unwind_plan_cache_t localPlanCache;
+    plcrash_async_page_cache_t localPageCache;
+
+    plcrash_async_symbol_cache_t *findContext;
+    plframe_unwind_plan_cache_t *planCache;
+    plcrash_async_page_cache_t *pageCache;
+    if (writer->caches.allocated) {
+        findContext = &writer->caches.symbol_cache;
+        plcrash_async_symbol_cache_reset(findContext);
+
+        planCache = &writer->caches.plan_cache;
+        plframe_unwind_plan_cache_reset(planCache);
+
+        /* The page cache is used even if its storage could not be allocated, in which case reads are passed directly
+         * to the target. This ensures that it shadows any page cache bound by a report interrupted on this thread. */
+        pageCache = &writer->caches.page_cache;
+        plcrash_async_page_cache_reset(pageCache);
+    } else {
+        /* Set up a symbol-finding context. */
+        findContext = &localSymbolCache;
+        plcrash_error_t err = plcrash_async_symbol_cache_init(findContext);
+        /* Abort if it failed, although that should never actually happen, ever. */
+        if (err != PLCRASH_ESUCCESS) {
+            if (packed_images != NULL)
+                plcrash_writer_image_index_free(packed_images);
+            return err;
+        }
+
+        /* Set up an unwind plan cache, shared by the frame readers across all threads walked for this report. This is
+         * optional; if storage can not be allocated, plans will be derived for every frame. */
+        planCache = &localPlanCache;
+        plframe_unwind_plan_cache_init(planCache);
+
+        /* Set up a page cache for stack walking. This is optional; on failure, stack memory will be read directly. */
+        pageCache = NULL;
+        if (plcrash_async_page_cache_init(&localPageCache) == PLCRASH_ESUCCESS)
+            pageCache = &localPageCache;
+    }
+
+    /* Set up a mapping cache, allowing section mappings to be shared across frames and lookups for the duration
+     * of the report. All memory objects created while bound must be freed prior to freeing the cache. */
+    plcrash_async_mapping_cache_t mappingCache;
+    plcrash_async_mapping_cache_init(&mappingCache);
+    plcrash_async_mapping_cache_bind(&mappingCache);
+
+    /* Share the unwind plan cache with the frame readers across all threads walked for this report */
+    plframe_unwind_plan_cache_bind(planCache);
+
+    /* Set up the report string table, if enabled. If storage can not be allocated, strings will be written inline. */
+    plcrash_async_string_table_t stringTable;
+    plcrash_async_string_table_t *strings = NULL;
+    if (writer->string_table && plcrash_async_string_table_init(&stringTable) == PLCRASH_ESUCCESS)
+        strings = &stringTable;
 
     /* Write the file header */
     {
         uint8_t version = PLCRASH_REPORT_FILE_VERSION;
+        if (packed_images != NULL || strings != NULL)
+            version = PLCRASH_REPORT_FILE_VERSION_2;
 
         /* Write the magic string (with no trailing NULL) and the version number */
         plcrash_async_file_write(file, PLCRASH_REPORT_FILE_MAGIC, strlen(PLCRASH_REPORT_FILE_MAGIC));
@@ -1343,10 +2236,12 @@ plcrash_error_t plcrash_log_writer_write (plcrash_log_writer_t *writer,
     
     /* Threads */
     uint32_t thread_number = 0;
+
     for (mach_msg_type_number_t i = 0; i < thread_count; i++) {
         thread_t thread = threads[i];
         plcrash_async_thread_state_t *thr_ctx = NULL;
         bool crashed = false;
+        off_t length_offset;
         uint32_t size;
 
         /* If executing on the target thread, we need to a valid context to walk */
@@ -1363,39 +2258,49 @@ plcrash_error_t plcrash_log_writer_write (plcrash_log_writer_t *writer,
             crashed = true;
         }
 
-        /* Determine the size */
-        size = (uint32_t) plcrash_writer_write_thread(NULL, writer, mach_task_self(), thread, thread_number, thr_ctx, image_list, &findContext, crashed);
-
-        /* Write message */
-        plcrash_writer_pack(file, PLCRASH_PROTO_THREADS_ID, PLPROTOBUF_C_TYPE_MESSAGE, &size);
-        plcrash_writer_write_thread(file, writer, mach_task_self(), thread, thread_number, thr_ctx, image_list, &findContext, crashed);
+        /* Write the message in a single pass; walking and symbolicating the stack is expensive, and so rather than
+         * first computing the message size, a fixed-width length is reserved and then filled in after writing. */
+        plcrash_writer_pack_reserved_length(file, PLCRASH_PROTO_THREADS_ID, &length_offset);
+        if (unwound_threads != NULL) {
+            size = (uint32_t) plcrash_writer_write_unwound_thread(file, thread_number, &unwound_threads[thread_number], packed_images, strings, crashed);
+        } else {
+            size = (uint32_t) plcrash_writer_write_thread(file, writer, mach_task_self(), thread, thread_number, thr_ctx, image_list, findContext, pageCache, packed_images, strings, crashed);
+        }
+        if (!plcrash_writer_fill_reserved_length(file, length_offset, size))
+            PLCF_DEBUG("Failed to write thread message length");
 
         thread_number++;
     }
 
-    /* Binary Images */
-    plcrash_async_image_list_set_reading(image_list, true);
+    /* Binary Images; if packed frames were written, the images must be written in the snapshotted order referenced
+     * by the frames' image indices. */
+    if (packed_images != NULL) {
+        for (uint32_t i = 0; i < packed_images->count; i++)
+            plcrash_writer_write_binary_image_message(file, &packed_images->images[i]->macho_image, strings);
 
-    plcrash_async_image_t *image = NULL;
-    while ((image = plcrash_async_image_list_next(image_list, image)) != NULL) {
-        uint32_t size;
+        plcrash_writer_image_index_free(packed_images);
+    } else {
+        plcrash_async_image_list_set_reading(image_list, true);
 
-        /* Calculate the message size */
-        size = (uint32_t) plcrash_writer_write_binary_image(NULL, &image->macho_image);
-        plcrash_writer_pack(file, PLCRASH_PROTO_BINARY_IMAGES_ID, PLPROTOBUF_C_TYPE_MESSAGE, &size);
-        plcrash_writer_write_binary_image(file, &image->macho_image);
-    }
+        plcrash_async_image_t *image = NULL;
+        while ((image = plcrash_async_image_list_next(image_list, image)) != NULL) {
+            plcrash_writer_write_binary_image_message(file, &image->macho_image, strings);
+        }
 
-    plcrash_async_image_list_set_reading(image_list, false);
+        plcrash_async_image_list_set_reading(image_list, false);
+    }
 
     /* Exception */
     if (writer->uncaught_exception.has_exception) {
+        off_t length_offset;
         uint32_t size;
 
-        /* Calculate the message size */
-        size = (uint32_t) plcrash_writer_write_exception(NULL, writer, image_list, &findContext);
-        plcrash_writer_pack(file, PLCRASH_PROTO_EXCEPTION_ID, PLPROTOBUF_C_TYPE_MESSAGE, &size);
-        plcrash_writer_write_exception(file, writer, image_list, &findContext);
+        /* Write the message in a single pass, filling in the reserved length once the (symbolicated) frames
+         * have been written. */
+        plcrash_writer_pack_reserved_length(file, PLCRASH_PROTO_EXCEPTION_ID, &length_offset);
+        size = (uint32_t) plcrash_writer_write_exception(file, writer, image_list, findContext, strings);
+        if (!plcrash_writer_fill_reserved_length(file, length_offset, size))
+            PLCF_DEBUG("Failed to write exception message length");
     }
     
     /* Signal */
@@ -1412,12 +2317,29 @@ plcrash_error_t plcrash_log_writer_write (plcrash_log_writer_t *writer,
     if (writer->custom_data.data) {
         plcrash_writer_pack(file, PLCRASH_PROTO_CUSTOM_DATA_ID, PLPROTOBUF_C_TYPE_BYTES, &writer->custom_data);
     }
+
+    /* String table; written last, once all referencing messages have been written */
+    if (strings != NULL) {
+        plcrash_writer_write_string_table(file, strings);
+        plcrash_async_string_table_free(strings);
+    }
     
-    plcrash_async_symbol_cache_free(&findContext);
+    plframe_unwind_plan_cache_unbind(planCache);
+    plcrash_async_mapping_cache_unbind(&mappingCache);
+    if (!writer->caches.allocated) {
+        plframe_unwind_plan_cache_free(&localPlanCache);
+        plcrash_async_symbol_cache_free(&localSymbolCache);
+        if (pageCache != NULL)
+            plcrash_async_page_cache_free(&localPageCache);
+    }
+    plcrash_async_mapping_cache_free(&mappingCache);
+
+    if (unwound_threads != NULL)
+        plcrash_writer_parallel_unwind_free(&unwind_pool, unwound_threads, thread_count);
     
     /* Clean up the thread array */
     for (mach_msg_type_number_t i = 0; i < thread_count; i++) {
-        if (threads[i] != pl_mach_thread_self())
+        if (threads_suspended && threads[i] != pl_mach_thread_self())
             thread_resume(threads[i]);
 
         mach_port_deallocate(mach_task_self(), threads[i]);
@@ -27,7 +27,7 @@
 
 #include "PLCrashLogWriterEncoding.h"
 
-#define MAX_UINT64_ENCODED_SIZE 10
+#define MAX_UINT64_ENCODED_SIZE PLCRASH_WRITER_VARINT_MAX_SIZE
 
 /* --- wire format enums --- */
 typedef enum {
@@ -43,98 +43,34 @@ typedef enum {
 static inline uint32_t
 zigzag32 (int32_t v)
 {
-    if (v < 0)
-        return ((uint32_t)(-v)) * 2 - 1;
-    else
-        return v * 2;
+    /* The arithmetic shift yields an all-ones mask for negative values */
+    return ((uint32_t) v << 1) ^ (uint32_t) (v >> 31);
 }
 static inline uint64_t
 zigzag64 (int64_t v)
 {
-    if (v < 0)
-        return ((uint64_t)(-v)) * 2 - 1;
-    else
-        return v * 2;
+    return ((uint64_t) v << 1) ^ (uint64_t) (v >> 63);
 }
+
 static inline size_t
 uint32_pack (uint32_t value, uint8_t *out)
 {
-    unsigned rv = 0;
-    if (value >= 0x80)
-    {
-        out[rv++] = value | 0x80;
-        value >>= 7;
-        if (value >= 0x80)
-        {
-            out[rv++] = value | 0x80;
-            value >>= 7;
-            if (value >= 0x80)
-            {
-                out[rv++] = value | 0x80;
-                value >>= 7;
-                if (value >= 0x80)
-                {
-                    out[rv++] = value | 0x80;
-                    value >>= 7;
-                }
-            }
-        }
-    }
-    /* assert: value<128 */
-    out[rv++] = value;
-    return rv;
+    return plcrash_writer_varint_pack (value, out);
 }
 static inline size_t
 int32_pack (int32_t value, uint8_t *out)
 {
-    if (value < 0)
-    {
-        out[0] = value | 0x80;
-        out[1] = (value>>7) | 0x80;
-        out[2] = (value>>14) | 0x80;
-        out[3] = (value>>21) | 0x80;
-        out[4] = (value>>28) | 0x80;
-        out[5] = out[6] = out[7] = out[8] = 0xff;
-        out[9] = 0x01;
-        return 10;
-    }
-    else
-        return uint32_pack (value, out);
+    /* Negative values are sign-extended to 64 bits, and always encode to 10 bytes */
+    return plcrash_writer_varint_pack ((uint64_t) (int64_t) value, out);
 }
 static inline size_t sint32_pack (int32_t value, uint8_t *out)
 {
     return uint32_pack (zigzag32 (value), out);
 }
-static size_t
+static inline size_t
 uint64_pack (uint64_t value, uint8_t *out)
 {
-    uint32_t hi = value>>32;
-    uint32_t lo = (uint32_t) value;
-    unsigned rv;
-    if (hi == 0)
-        return uint32_pack (lo, out);
-    out[0] = (lo) | 0x80;
-    out[1] = (lo>>7) | 0x80;
-    out[2] = (lo>>14) | 0x80;
-    out[3] = (lo>>21) | 0x80;
-    if (hi < 8)
-    {
-        out[4] = (hi<<4) | (lo>>28);
-        return 5;
-    }
-    else
-    {
-        out[4] = ((hi&7)<<4) | (lo>>28) | 0x80;
-        hi >>= 3;
-    }
-    rv = 5;
-    while (hi >= 128)
-    {
-        out[rv++] = hi | 0x80;
-        hi >>= 7;
-    }
-    out[rv++] = hi;
-    return rv;
+    return plcrash_writer_varint_pack (value, out);
 }
 static inline size_t sint64_pack (int64_t value, uint8_t *out)
 {
@@ -169,87 +105,83 @@ static inline size_t boolean_pack (bool value, uint8_t *out)
 }
 
 /* wire-type will be added in required_field_pack() */
-static size_t tag_pack (uint32_t id, uint8_t *out)
+static inline size_t tag_pack (uint32_t id, uint8_t *out)
 {
-    if (id < (1<<(32-3)))
-        return uint32_pack (id<<3, out);
-    else
-        return uint64_pack (((uint64_t)id) << 3, out);
+    return plcrash_writer_varint_pack (((uint64_t) id) << 3, out);
 }
 
 /* === pack_to_buffer() === */
-// file argument may be NULL
-size_t plcrash_writer_pack (plcrash_async_file_t *file, uint32_t field_id, PLProtobufCType field_type, const void *value) {
+
+/**
+ * @internal
+ *
+ * Pack the tag and value of a field into @a out. For length-delimited STRING and BYTES fields, only the tag and
+ * length are packed, and the field data to follow is returned via @a data and @a data_len.
+ *
+ * @param out The output buffer, which must have at least MAX_UINT64_ENCODED_SIZE * 2 bytes available.
+ * @param field_id The field identifier.
+ * @param field_type The field type.
+ * @param value The field value.
+ * @param data On return, the field data to be written following the packed bytes, or NULL.
+ * @param data_len On return, the length of @a data.
+ *
+ * @return Returns the number of bytes packed into @a out.
+ */
+static size_t plcrash_writer_pack_field (uint8_t *out, uint32_t field_id, PLProtobufCType field_type, const void *value, const void **data, size_t *data_len) {
     size_t rv;
-    uint8_t scratch[MAX_UINT64_ENCODED_SIZE * 2];
-    rv = tag_pack (field_id, scratch);
+
+    *data = NULL;
+    *data_len = 0;
+
+    rv = tag_pack (field_id, out);
     switch (field_type)
     {
         case PLPROTOBUF_C_TYPE_SINT32:
-            scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
-            rv += sint32_pack (*(const int32_t *) value, scratch + rv);
-            if (file != NULL)
-                plcrash_async_file_write(file, scratch, rv);
+            out[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
+            rv += sint32_pack (*(const int32_t *) value, out + rv);
             break;
         case PLPROTOBUF_C_TYPE_INT32:
-            scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
-            rv += int32_pack (*(const uint32_t *) value, scratch + rv);
-            if (file != NULL)
-                plcrash_async_file_write(file, scratch, rv);
+            out[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
+            rv += int32_pack (*(const uint32_t *) value, out + rv);
             break;
         case PLPROTOBUF_C_TYPE_UINT32:
         case PLPROTOBUF_C_TYPE_ENUM:
-            scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
-            rv += uint32_pack (*(const uint32_t *) value, scratch + rv);
-            if (file != NULL)
-                plcrash_async_file_write(file, scratch, rv);
+            out[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
+            rv += uint32_pack (*(const uint32_t *) value, out + rv);
             break;
         case PLPROTOBUF_C_TYPE_SINT64:
-            scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
-            rv += sint64_pack (*(const int64_t *) value, scratch + rv);
-            if (file != NULL)
-                plcrash_async_file_write(file, scratch, rv);
+            out[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
+            rv += sint64_pack (*(const int64_t *) value, out + rv);
             break;
         case PLPROTOBUF_C_TYPE_INT64:
         case PLPROTOBUF_C_TYPE_UINT64:
-            scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
-            rv += uint64_pack (*(const uint64_t *) value, scratch + rv);
-            if (file != NULL)
-                plcrash_async_file_write(file, scratch, rv);
+            out[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
+            rv += uint64_pack (*(const uint64_t *) value, out + rv);
             break;
         case PLPROTOBUF_C_TYPE_SFIXED32:
         case PLPROTOBUF_C_TYPE_FIXED32:
         case PLPROTOBUF_C_TYPE_FLOAT:
-            scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_32BIT;
-            rv += fixed32_pack (*(const uint32_t *) value, scratch + rv);
-            if (file != NULL)
-                plcrash_async_file_write(file, scratch, rv);
+            out[0] |= PLPROTOBUF_C_WIRE_TYPE_32BIT;
+            rv += fixed32_pack (*(const uint32_t *) value, out + rv);
             break;
         case PLPROTOBUF_C_TYPE_SFIXED64:
         case PLPROTOBUF_C_TYPE_FIXED64:
         case PLPROTOBUF_C_TYPE_DOUBLE:
-            scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_64BIT;
-            rv += fixed64_pack (*(const uint64_t *) value, scratch + rv);
-            if (file != NULL)
-                plcrash_async_file_write(file, scratch, rv);
+            out[0] |= PLPROTOBUF_C_WIRE_TYPE_64BIT;
+            rv += fixed64_pack (*(const uint64_t *) value, out + rv);
             break;
         case PLPROTOBUF_C_TYPE_BOOL:
-            scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
-            rv += boolean_pack (*(const bool *) value, scratch + rv);
-            if (file != NULL)
-                plcrash_async_file_write(file, scratch, rv);
+            out[0] |= PLPROTOBUF_C_WIRE_TYPE_VARINT;
+            rv += boolean_pack (*(const bool *) value, out + rv);
             break;
             
         case PLPROTOBUF_C_TYPE_STRING:
         {
             uint32_t sublen = (uint32_t) strlen (value);
-            scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_LENGTH_PREFIXED;
-            rv += uint32_pack (sublen, scratch + rv);
-            if (file != NULL) {
-                plcrash_async_file_write(file, scratch, rv);
-                plcrash_async_file_write(file, value, sublen);
-            }
-            rv += sublen;
+            out[0] |= PLPROTOBUF_C_WIRE_TYPE_LENGTH_PREFIXED;
+            rv += uint32_pack (sublen, out + rv);
+            *data = value;
+            *data_len = sublen;
             break;
         }
      
@@ -257,23 +189,18 @@ size_t plcrash_writer_pack (plcrash_async_file_t *file, uint32_t field_id, PLPro
         {
             const PLProtobufCBinaryData * bd = ((const PLProtobufCBinaryData*) value);
             uint32_t sublen = (uint32_t) bd->len;
-            scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_LENGTH_PREFIXED;
-            rv += uint32_pack (sublen, scratch + rv);
-            if (file != NULL) {
-                plcrash_async_file_write(file, scratch, rv);
-                plcrash_async_file_write(file, bd->data, sublen);
-            }
-            rv += sublen;
+            out[0] |= PLPROTOBUF_C_WIRE_TYPE_LENGTH_PREFIXED;
+            rv += uint32_pack (sublen, out + rv);
+            *data = bd->data;
+            *data_len = sublen;
             break;
         }
             
             //PLPROTOBUF_C_TYPE_GROUP,          // NOT SUPPORTED
         case PLPROTOBUF_C_TYPE_MESSAGE:
         {
-            scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_LENGTH_PREFIXED;
-            rv += uint32_pack (*(const uint32_t *) value, scratch + rv);
-            if (file != NULL)
-                plcrash_async_file_write(file, scratch, rv);
+            out[0] |= PLPROTOBUF_C_WIRE_TYPE_LENGTH_PREFIXED;
+            rv += uint32_pack (*(const uint32_t *) value, out + rv);
             break;
         }
         default:
@@ -282,3 +209,132 @@ size_t plcrash_writer_pack (plcrash_async_file_t *file, uint32_t field_id, PLPro
     }
     return rv;
 }
+
+// file argument may be NULL
+size_t plcrash_writer_pack (plcrash_async_file_t *file, uint32_t field_id, PLProtobufCType field_type, const void *value) {
+    uint8_t scratch[MAX_UINT64_ENCODED_SIZE * 2];
+    const void *data;
+    size_t data_len;
+    size_t rv;
+
+    rv = plcrash_writer_pack_field(scratch, field_id, field_type, value, &data, &data_len);
+    if (file != NULL) {
+        plcrash_async_file_write(file, scratch, rv);
+        if (data_len > 0)
+            plcrash_async_file_write(file, data, data_len);
+    }
+
+    return rv + data_len;
+}
+
+/**
+ * Initialize a message staging buffer. Fields may be packed into the buffer via the generated encoders in
+ * PLCrashReport.pb-enc.h, and the result written with a single call to plcrash_writer_message_write().
+ *
+ * This function is async-safe.
+ *
+ * @param msg The staging buffer to be initialized.
+ * @param buffer The backing storage. The caller is responsible for ensuring that the storage remains valid for the
+ * lifetime of @a msg.
+ * @param capacity The size of @a buffer, in bytes.
+ */
+void plcrash_writer_message_init (plcrash_writer_message_t *msg, void *buffer, size_t capacity) {
+    msg->buffer = buffer;
+    msg->capacity = capacity;
+    msg->length = 0;
+}
+
+/**
+ * Verify that @a size bytes are available in @a msg. This is the only bounds check performed on the staging
+ * buffer; callers must reserve the encoded size of all fields prior to packing them, using the exact
+ * sizes returned by the generated encoders' size functions.
+ *
+ * Varints are packed via plcrash_writer_varint_pack(), which may write up to PLCRASH_WRITER_VARINT_SLACK bytes
+ * beyond the encoded value; this slack is included in the check, and need not be added to @a size.
+ *
+ * This function is async-safe.
+ *
+ * @param msg The staging buffer.
+ * @param size The number of bytes required.
+ *
+ * @return Returns true if @a size bytes are available, or false if the message will not fit in the staging buffer.
+ */
+bool plcrash_writer_message_reserve (plcrash_writer_message_t *msg, size_t size) {
+    /* The final varint packed may overwrite up to PLCRASH_WRITER_VARINT_SLACK bytes beyond the reserved size */
+    return msg->capacity - msg->length >= size + PLCRASH_WRITER_VARINT_SLACK;
+}
+
+/**
+ * Write the contents of @a msg to @a file with a single write.
+ *
+ * This function is async-safe.
+ *
+ * @param file The output file. May be NULL, in which case only the size of the message will be returned.
+ * @param msg The staging buffer.
+ *
+ * @return Returns the number of bytes written (or that would be written).
+ */
+size_t plcrash_writer_message_write (plcrash_async_file_t *file, plcrash_writer_message_t *msg) {
+    if (file != NULL && msg->length > 0)
+        plcrash_async_file_write(file, msg->buffer, msg->length);
+
+    return msg->length;
+}
+/**
+ * Write a length-delimited field header for @a field_id, reserving a fixed-width slot of
+ * PLCRASH_WRITER_RESERVED_LENGTH_SIZE bytes for the field's length. The length must be filled in via
+ * plcrash_writer_fill_reserved_length() once the field's contents have been written.
+ *
+ * This allows a message to be written in a single pass, without first computing its size.
+ *
+ * @param file The output file. May be NULL, in which case only the size of the header will be computed.
+ * @param field_id The field identifier.
+ * @param length_offset On return, will be set to the file offset of the reserved length slot.
+ *
+ * @return Returns the number of bytes written (or that would be written) for the field header.
+ */
+size_t plcrash_writer_pack_reserved_length (plcrash_async_file_t *file, uint32_t field_id, off_t *length_offset) {
+    uint8_t scratch[MAX_UINT64_ENCODED_SIZE + PLCRASH_WRITER_RESERVED_LENGTH_SIZE];
+    size_t rv;
+
+    rv = tag_pack (field_id, scratch);
+    scratch[0] |= PLPROTOBUF_C_WIRE_TYPE_LENGTH_PREFIXED;
+
+    /* Reserve a zero-valued length; this will be overwritten once the length is known. */
+    for (size_t i = 0; i < PLCRASH_WRITER_RESERVED_LENGTH_SIZE - 1; i++)
+        scratch[rv + i] = 0x80;
+    scratch[rv + PLCRASH_WRITER_RESERVED_LENGTH_SIZE - 1] = 0x0;
+
+    if (file != NULL) {
+        plcrash_async_file_write(file, scratch, rv);
+        *length_offset = plcrash_async_file_offset(file);
+        plcrash_async_file_write(file, scratch + rv, PLCRASH_WRITER_RESERVED_LENGTH_SIZE);
+    }
+
+    return rv + PLCRASH_WRITER_RESERVED_LENGTH_SIZE;
+}
+
+/**
+ * Fill in a length slot previously reserved via plcrash_writer_pack_reserved_length().
+ *
+ * @param file The output file. May be NULL, in which case no action will be taken.
+ * @param length_offset The length slot's offset, as returned by plcrash_writer_pack_reserved_length().
+ * @param length The length value to be written.
+ *
+ * @return Returns true on success, or false if the length slot could not be rewritten.
+ */
+bool plcrash_writer_fill_reserved_length (plcrash_async_file_t *file, off_t length_offset, uint32_t length) {
+    uint8_t scratch[PLCRASH_WRITER_RESERVED_LENGTH_SIZE];
+
+    if (file == NULL)
+        return true;
+
+    /* Encode as a fixed-width varint, setting the continuation bit on all but the final byte */
+    for (size_t i = 0; i < PLCRASH_WRITER_RESERVED_LENGTH_SIZE - 1; i++) {
+        scratch[i] = (length & 0x7F) | 0x80;
+        length >>= 7;
+    }
+    scratch[PLCRASH_WRITER_RESERVED_LENGTH_SIZE - 1] = length;
+
+    return plcrash_async_file_rewrite(file, length_offset, scratch, sizeof(scratch));
+}
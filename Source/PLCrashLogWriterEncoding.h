@@ -49,7 +49,115 @@ typedef struct PLProtobufCBinaryData {
     void *data;
 } PLProtobufCBinaryData;
 
+/**
+ * The maximum encoded size of a varint.
+ */
+#define PLCRASH_WRITER_VARINT_MAX_SIZE 10
+
+/**
+ * The number of bytes beyond an encoded varint that may be overwritten by plcrash_writer_varint_pack(). Space for
+ * the slack is accounted for by plcrash_writer_message_reserve().
+ */
+#define PLCRASH_WRITER_VARINT_SLACK (PLCRASH_WRITER_VARINT_MAX_SIZE - 1)
+
+/**
+ * @internal
+ *
+ * Return the number of bytes required to encode @a value as a varint. The size is derived from the index of the
+ * highest set bit: ceil(bits / 7) is equal to (bits * 9 + 64) / 64 for all bit counts from 1 through 64.
+ *
+ * This function is async-safe.
+ */
+static inline size_t plcrash_writer_varint_size (uint64_t value) {
+    /* value | 1 ensures that zero is counted as a single bit, and is never passed to clz */
+    unsigned bits = 64 - __builtin_clzll(value | 1);
+    return (bits * 9 + 64) / 64;
+}
+
+/**
+ * @internal
+ *
+ * Pack @a value as a varint. Rather than emitting one 7-bit group per loop iteration, the low 56 bits are spread
+ * into eight 7-bit groups within a single word, the continuation bits are applied with a mask derived from
+ * plcrash_writer_varint_size(), and the word is stored in full.
+ *
+ * This function is async-safe.
+ *
+ * @param value The value to pack.
+ * @param out The output buffer. PLCRASH_WRITER_VARINT_MAX_SIZE bytes must be available, regardless of the encoded
+ * size of @a value; up to PLCRASH_WRITER_VARINT_SLACK bytes beyond the returned length may be overwritten.
+ *
+ * @return Returns the encoded size of @a value.
+ */
+static inline size_t plcrash_writer_varint_pack (uint64_t value, uint8_t *out) {
+    size_t len = plcrash_writer_varint_size(value);
+
+    uint64_t word = (value & 0x7FULL) |
+        ((value << 1) & 0x7F00ULL) |
+        ((value << 2) & 0x7F0000ULL) |
+        ((value << 3) & 0x7F000000ULL) |
+        ((value << 4) & 0x7F00000000ULL) |
+        ((value << 5) & 0x7F0000000000ULL) |
+        ((value << 6) & 0x7F000000000000ULL) |
+        ((value << 7) & 0x7F00000000000000ULL);
+
+    /* Set the continuation bit of the first len - 1 bytes of the word. The shift is split in two so that the
+     * single-byte case (a total shift of 64) remains well-defined. */
+    unsigned shift = 4 * (9 - (len > 9 ? 9 : (unsigned) len));
+    word |= (0x8080808080808080ULL >> shift) >> shift;
+
+    /* Written bytewise to remain endian-neutral; the compiler combines these into a single word store. */
+    out[0] = (uint8_t) word;
+    out[1] = (uint8_t) (word >> 8);
+    out[2] = (uint8_t) (word >> 16);
+    out[3] = (uint8_t) (word >> 24);
+    out[4] = (uint8_t) (word >> 32);
+    out[5] = (uint8_t) (word >> 40);
+    out[6] = (uint8_t) (word >> 48);
+    out[7] = (uint8_t) (word >> 56);
+
+    /* The remaining 8 bits of a 64-bit value */
+    out[8] = (uint8_t) ((value >> 56) & 0x7F) | (len > 9 ? 0x80 : 0);
+    out[9] = (uint8_t) (value >> 63);
+
+    return len;
+}
+
+/**
+ * The size of a fixed-width length value reserved via plcrash_writer_pack_reserved_length(). Length values are
+ * encoded as non-minimal, zero-padded varints; this is sufficient to represent any uint32_t length.
+ */
+#define PLCRASH_WRITER_RESERVED_LENGTH_SIZE 5
+
+/**
+ * The maximum encoded size of a field's tag and, for scalar fields, its value; for length-delimited fields, the
+ * maximum size of the tag and length.
+ */
+#define PLCRASH_WRITER_MESSAGE_HEADER_SIZE 20
+
+/**
+ * A message staging buffer. Allows a complete message, including any nested messages, to be encoded into contiguous
+ * storage with a single bounds check, and written with a single call to plcrash_async_file_write().
+ */
+typedef struct plcrash_writer_message {
+    /** The backing storage. */
+    uint8_t *buffer;
+
+    /** The size of @a buffer, in bytes. */
+    size_t capacity;
+
+    /** The number of bytes packed into @a buffer. */
+    size_t length;
+} plcrash_writer_message_t;
+
 size_t plcrash_writer_pack (plcrash_async_file_t *file, uint32_t field_id, PLProtobufCType field_type, const void *value);
+
+void plcrash_writer_message_init (plcrash_writer_message_t *msg, void *buffer, size_t capacity);
+bool plcrash_writer_message_reserve (plcrash_writer_message_t *msg, size_t size);
+size_t plcrash_writer_message_write (plcrash_async_file_t *file, plcrash_writer_message_t *msg);
+
+size_t plcrash_writer_pack_reserved_length (plcrash_async_file_t *file, uint32_t field_id, off_t *length_offset);
+bool plcrash_writer_fill_reserved_length (plcrash_async_file_t *file, off_t length_offset, uint32_t length);
     
 #ifdef __cplusplus
 }
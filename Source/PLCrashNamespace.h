@@ -165,7 +165,13 @@
 #define plcrash_async_file_close PLNS(plcrash_async_file_close)
 #define plcrash_async_file_flush PLNS(plcrash_async_file_flush)
 #define plcrash_async_file_init PLNS(plcrash_async_file_init)
+#define plcrash_async_file_init_memory PLNS(plcrash_async_file_init_memory)
+#define plcrash_async_file_memory_bytes PLNS(plcrash_async_file_memory_bytes)
+#define plcrash_async_file_offset PLNS(plcrash_async_file_offset)
+#define plcrash_async_file_rewrite PLNS(plcrash_async_file_rewrite)
+#define plcrash_async_file_set_buffer PLNS(plcrash_async_file_set_buffer)
 #define plcrash_async_file_write PLNS(plcrash_async_file_write)
+#define plcrash_async_file_write_ops PLNS(plcrash_async_file_write_ops)
 #define plcrash_async_find_symbol PLNS(plcrash_async_find_symbol)
 #define plcrash_async_image_containing_address PLNS(plcrash_async_image_containing_address)
 #define plcrash_async_image_list_next PLNS(plcrash_async_image_list_next)
@@ -196,6 +202,15 @@
 #define plcrash_async_macho_symtab_reader_symbol_name PLNS(plcrash_async_macho_symtab_reader_symbol_name)
 #define plcrash_async_memcpy PLNS(plcrash_async_memcpy)
 #define plcrash_async_memset PLNS(plcrash_async_memset)
+#define plcrash_async_mapping_cache_acquire PLNS(plcrash_async_mapping_cache_acquire)
+#define plcrash_async_mapping_cache_bind PLNS(plcrash_async_mapping_cache_bind)
+#define plcrash_async_mapping_cache_bound PLNS(plcrash_async_mapping_cache_bound)
+#define plcrash_async_mapping_cache_free PLNS(plcrash_async_mapping_cache_free)
+#define plcrash_async_mapping_cache_get_stats PLNS(plcrash_async_mapping_cache_get_stats)
+#define plcrash_async_mapping_cache_init PLNS(plcrash_async_mapping_cache_init)
+#define plcrash_async_mapping_cache_insert PLNS(plcrash_async_mapping_cache_insert)
+#define plcrash_async_mapping_cache_release PLNS(plcrash_async_mapping_cache_release)
+#define plcrash_async_mapping_cache_unbind PLNS(plcrash_async_mapping_cache_unbind)
 #define plcrash_async_mobject_base_address PLNS(plcrash_async_mobject_base_address)
 #define plcrash_async_mobject_free PLNS(plcrash_async_mobject_free)
 #define plcrash_async_mobject_init PLNS(plcrash_async_mobject_init)
@@ -210,18 +225,39 @@
 #define plcrash_async_objc_cache_free PLNS(plcrash_async_objc_cache_free)
 #define plcrash_async_objc_cache_init PLNS(plcrash_async_objc_cache_init)
 #define plcrash_async_objc_find_method PLNS(plcrash_async_objc_find_method)
+#define plcrash_async_page_cache_bind PLNS(plcrash_async_page_cache_bind)
+#define plcrash_async_page_cache_bound PLNS(plcrash_async_page_cache_bound)
+#define plcrash_async_page_cache_flush PLNS(plcrash_async_page_cache_flush)
+#define plcrash_async_page_cache_free PLNS(plcrash_async_page_cache_free)
+#define plcrash_async_page_cache_get_stats PLNS(plcrash_async_page_cache_get_stats)
+#define plcrash_async_page_cache_init PLNS(plcrash_async_page_cache_init)
+#define plcrash_async_page_cache_memcpy PLNS(plcrash_async_page_cache_memcpy)
+#define plcrash_async_page_cache_reset PLNS(plcrash_async_page_cache_reset)
+#define plcrash_async_page_cache_unbind PLNS(plcrash_async_page_cache_unbind)
 #define plcrash_async_signal_sigcode PLNS(plcrash_async_signal_sigcode)
 #define plcrash_async_signal_signame PLNS(plcrash_async_signal_signame)
 #define plcrash_async_strcmp PLNS(plcrash_async_strcmp)
 #define plcrash_async_strerror PLNS(plcrash_async_strerror)
+#define plcrash_async_string_table_count PLNS(plcrash_async_string_table_count)
+#define plcrash_async_string_table_free PLNS(plcrash_async_string_table_free)
+#define plcrash_async_string_table_get PLNS(plcrash_async_string_table_get)
+#define plcrash_async_string_table_init PLNS(plcrash_async_string_table_init)
+#define plcrash_async_string_table_intern PLNS(plcrash_async_string_table_intern)
+#define plcrash_async_string_table_intern_path PLNS(plcrash_async_string_table_intern_path)
 #define plcrash_async_strncmp PLNS(plcrash_async_strncmp)
 #define plcrash_async_symbol_cache_free PLNS(plcrash_async_symbol_cache_free)
+#define plcrash_async_symbol_cache_get_stats PLNS(plcrash_async_symbol_cache_get_stats)
 #define plcrash_async_symbol_cache_init PLNS(plcrash_async_symbol_cache_init)
+#define plcrash_async_symbol_cache_preallocate PLNS(plcrash_async_symbol_cache_preallocate)
+#define plcrash_async_symbol_cache_reset PLNS(plcrash_async_symbol_cache_reset)
 #define plcrash_async_task_memcpy PLNS(plcrash_async_task_memcpy)
+#define plcrash_async_task_memcpy_uncached PLNS(plcrash_async_task_memcpy_uncached)
 #define plcrash_async_task_read_uint16 PLNS(plcrash_async_task_read_uint16)
 #define plcrash_async_task_read_uint32 PLNS(plcrash_async_task_read_uint32)
 #define plcrash_async_task_read_uint64 PLNS(plcrash_async_task_read_uint64)
 #define plcrash_async_task_read_uint8 PLNS(plcrash_async_task_read_uint8)
+#define plcrash_async_thread_bind PLNS(plcrash_async_thread_bind)
+#define plcrash_async_thread_bound PLNS(plcrash_async_thread_bound)
 #define plcrash_async_thread_state_clear_all_regs PLNS(plcrash_async_thread_state_clear_all_regs)
 #define plcrash_async_thread_state_clear_reg PLNS(plcrash_async_thread_state_clear_reg)
 #define plcrash_async_thread_state_clear_volatile_regs PLNS(plcrash_async_thread_state_clear_volatile_regs)
@@ -240,6 +276,7 @@
 #define plcrash_async_thread_state_map_reg_to_dwarf PLNS(plcrash_async_thread_state_map_reg_to_dwarf)
 #define plcrash_async_thread_state_mcontext_init PLNS(plcrash_async_thread_state_mcontext_init)
 #define plcrash_async_thread_state_set_reg PLNS(plcrash_async_thread_state_set_reg)
+#define plcrash_async_thread_unbind PLNS(plcrash_async_thread_unbind)
 #define plcrash_async_writen PLNS(plcrash_async_writen)
 #define plcrash_log_writer_close PLNS(plcrash_log_writer_close)
 #define plcrash_log_writer_free PLNS(plcrash_log_writer_free)
@@ -247,12 +284,28 @@
 #define plcrash_log_writer_set_exception PLNS(plcrash_log_writer_set_exception)
 #define plcrash_log_writer_write PLNS(plcrash_log_writer_write)
 #define plcrash_log_writer_set_custom_data PLNS(plcrash_log_writer_set_custom_data)
+#define plcrash_log_writer_set_unwind_workers PLNS(plcrash_log_writer_set_unwind_workers)
+#define plcrash_log_writer_set_packed_frames PLNS(plcrash_log_writer_set_packed_frames)
+#define plcrash_log_writer_set_string_table PLNS(plcrash_log_writer_set_string_table)
+#define plcrash_log_writer_preallocate_caches PLNS(plcrash_log_writer_preallocate_caches)
 #define plcrash_nasync_image_list_append PLNS(plcrash_nasync_image_list_append)
+#define plcrash_nasync_image_list_append_deferred PLNS(plcrash_nasync_image_list_append_deferred)
+#define plcrash_nasync_image_list_deferred_count PLNS(plcrash_nasync_image_list_deferred_count)
 #define plcrash_nasync_image_list_free PLNS(plcrash_nasync_image_list_free)
 #define plcrash_nasync_image_list_init PLNS(plcrash_nasync_image_list_init)
+#define plcrash_nasync_image_list_load_deferred PLNS(plcrash_nasync_image_list_load_deferred)
 #define plcrash_nasync_image_list_remove PLNS(plcrash_nasync_image_list_remove)
+#define plcrash_nasync_image_list_retired_count PLNS(plcrash_nasync_image_list_retired_count)
+#define plcrash_nasync_image_list_set_indexing PLNS(plcrash_nasync_image_list_set_indexing)
+#define plcrash_nasync_macho_build_symbol_index PLNS(plcrash_nasync_macho_build_symbol_index)
 #define plcrash_nasync_macho_free PLNS(plcrash_nasync_macho_free)
 #define plcrash_nasync_macho_init PLNS(plcrash_nasync_macho_init)
+#define plcrash_nasync_parallel_unwind_pool_free PLNS(plcrash_nasync_parallel_unwind_pool_free)
+#define plcrash_nasync_parallel_unwind_pool_init PLNS(plcrash_nasync_parallel_unwind_pool_init)
+#define plcrash_nasync_parallel_unwind_pool_symbolicate PLNS(plcrash_nasync_parallel_unwind_pool_symbolicate)
+#define plcrash_nasync_parallel_unwind_thread_free PLNS(plcrash_nasync_parallel_unwind_thread_free)
+#define plcrash_nasync_parallel_unwind_thread_init PLNS(plcrash_nasync_parallel_unwind_thread_init)
+#define plcrash_parallel_unwind_pool_walk PLNS(plcrash_parallel_unwind_pool_walk)
 #define plcrash_populate_error PLNS(plcrash_populate_error)
 #define plcrash_populate_mach_error PLNS(plcrash_populate_mach_error)
 #define plcrash_populate_posix_error PLNS(plcrash_populate_posix_error)
@@ -262,6 +315,11 @@
 #define plcrash_sysctl_valid_utf8_bytes PLNS(plcrash_sysctl_valid_utf8_bytes)
 #define plcrash_sysctl_valid_utf8_bytes_max PLNS(plcrash_sysctl_valid_utf8_bytes_max)
 #define plcrash_writer_pack PLNS(plcrash_writer_pack)
+#define plcrash_writer_pack_reserved_length PLNS(plcrash_writer_pack_reserved_length)
+#define plcrash_writer_fill_reserved_length PLNS(plcrash_writer_fill_reserved_length)
+#define plcrash_writer_message_init PLNS(plcrash_writer_message_init)
+#define plcrash_writer_message_reserve PLNS(plcrash_writer_message_reserve)
+#define plcrash_writer_message_write PLNS(plcrash_writer_message_write)
 #define plframe_cursor_free PLNS(plframe_cursor_free)
 #define plframe_cursor_get_reg PLNS(plframe_cursor_get_reg)
 #define plframe_cursor_get_regcount PLNS(plframe_cursor_get_regcount)
@@ -271,9 +329,26 @@
 #define plframe_cursor_next_with_readers PLNS(plframe_cursor_next_with_readers)
 #define plframe_cursor_read_compact_unwind PLNS(plframe_cursor_read_compact_unwind)
 #define plframe_cursor_read_dwarf_unwind PLNS(plframe_cursor_read_dwarf_unwind)
+#define plframe_cursor_read_dwarf_unwind_fde PLNS(plframe_cursor_read_dwarf_unwind_fde)
 #define plframe_cursor_read_frame_ptr PLNS(plframe_cursor_read_frame_ptr)
+#define plframe_cursor_set_page_cache PLNS(plframe_cursor_set_page_cache)
 #define plframe_cursor_thread_init PLNS(plframe_cursor_thread_init)
+#define plframe_nasync_compact_unwind_context_free PLNS(plframe_nasync_compact_unwind_context_free)
+#define plframe_nasync_compact_unwind_context_new PLNS(plframe_nasync_compact_unwind_context_new)
+#define plframe_nasync_dwarf_unwind_context_free PLNS(plframe_nasync_dwarf_unwind_context_free)
+#define plframe_nasync_dwarf_unwind_context_new PLNS(plframe_nasync_dwarf_unwind_context_new)
 #define plframe_strerror PLNS(plframe_strerror)
+#define plframe_unwind_plan_cache_bind PLNS(plframe_unwind_plan_cache_bind)
+#define plframe_unwind_plan_cache_bound PLNS(plframe_unwind_plan_cache_bound)
+#define plframe_unwind_plan_cache_free PLNS(plframe_unwind_plan_cache_free)
+#define plframe_unwind_plan_cache_get_skipped PLNS(plframe_unwind_plan_cache_get_skipped)
+#define plframe_unwind_plan_cache_get_stats PLNS(plframe_unwind_plan_cache_get_stats)
+#define plframe_unwind_plan_cache_init PLNS(plframe_unwind_plan_cache_init)
+#define plframe_unwind_plan_cache_insert PLNS(plframe_unwind_plan_cache_insert)
+#define plframe_unwind_plan_cache_lookup PLNS(plframe_unwind_plan_cache_lookup)
+#define plframe_unwind_plan_cache_note_skipped PLNS(plframe_unwind_plan_cache_note_skipped)
+#define plframe_unwind_plan_cache_reset PLNS(plframe_unwind_plan_cache_reset)
+#define plframe_unwind_plan_cache_unbind PLNS(plframe_unwind_plan_cache_unbind)
 
 #endif
 
@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "PLCrashParallelUnwind.h"
+#include "PLCrashFrameUnwindPlan.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @internal
+ * @ingroup plcrash_parallel_unwind
+ * @{
+ */
+
+/**
+ * Initialize a thread record, allocating space for up to @a max_frames unwound frames. The caller is responsible
+ * for populating the record's thread_state prior to unwinding.
+ *
+ * Allocation is performed here, rather than during unwinding, so that records may be prepared before the target
+ * threads are suspended.
+ *
+ * @param thread The thread record to initialize.
+ * @param max_frames The maximum number of frames to be unwound.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or PLCRASH_ENOMEM if the frame array could not be allocated.
+ */
+plcrash_error_t plcrash_nasync_parallel_unwind_thread_init (plcrash_parallel_unwind_thread_t *thread, uint32_t max_frames) {
+    memset(thread, 0, sizeof(*thread));
+
+    thread->frames = calloc(max_frames, sizeof(thread->frames[0]));
+    if (thread->frames == NULL)
+        return PLCRASH_ENOMEM;
+
+    thread->max_frames = max_frames;
+    thread->error = PLFRAME_ENOFRAME;
+    return PLCRASH_ESUCCESS;
+}
+
+/**
+ * Free all resources associated with @a thread.
+ *
+ * @param thread A thread record previously initialized with plcrash_nasync_parallel_unwind_thread_init().
+ */
+void plcrash_nasync_parallel_unwind_thread_free (plcrash_parallel_unwind_thread_t *thread) {
+    if (thread->frames == NULL)
+        return;
+
+    for (uint32_t i = 0; i < thread->frame_count; i++)
+        free(thread->frames[i].symbol_name);
+
+    free(thread->frames);
+    thread->frames = NULL;
+    thread->frame_count = 0;
+}
+
+/**
+ * @internal
+ *
+ * Unwind @a thread's stack, starting from its initial thread state.
+ */
+static void plcrash_parallel_unwind_walk_thread (plcrash_parallel_unwind_pool_t *pool, plcrash_async_page_cache_t *page_cache, plcrash_parallel_unwind_thread_t *thread) {
+    plframe_cursor_t cursor;
+    plframe_error_t ferr;
+
+    thread->frame_count = 0;
+
+    ferr = plframe_cursor_init(&cursor, pool->task, &thread->thread_state, pool->image_list);
+    if (ferr != PLFRAME_ESUCCESS) {
+        PLCF_DEBUG("An error occured initializing the frame cursor: %s", plframe_strerror(ferr));
+        thread->error = ferr;
+        return;
+    }
+
+    plframe_cursor_set_page_cache(&cursor, page_cache);
+
+    while ((ferr = plframe_cursor_next(&cursor)) == PLFRAME_ESUCCESS && thread->frame_count < thread->max_frames) {
+        plcrash_greg_t pc = 0;
+        if ((ferr = plframe_cursor_get_reg(&cursor, PLCRASH_REG_IP, &pc)) != PLFRAME_ESUCCESS) {
+            PLCF_DEBUG("Could not retrieve frame PC register: %s", plframe_strerror(ferr));
+            break;
+        }
+
+        thread->frames[thread->frame_count].pc = pc;
+        thread->frames[thread->frame_count].symbol_name = NULL;
+        thread->frame_count++;
+    }
+
+    thread->error = ferr;
+    plframe_cursor_free(&cursor);
+}
+
+/**
+ * @internal
+ *
+ * plcrash_async_found_symbol_cb callback implementation. Copies the result to the plcrash_parallel_unwind_frame_t
+ * available via @a ctx.
+ */
+static void plcrash_parallel_unwind_found_symbol_cb (pl_vm_address_t address, const char *name, void *ctx) {
+    plcrash_parallel_unwind_frame_t *frame = ctx;
+
+    frame->symbol_name = strdup(name);
+    frame->symbol_start = address;
+}
+
+/**
+ * @internal
+ *
+ * Symbolicate all of @a thread's unwound frames.
+ *
+ * The caller must hold a read reference to the pool's image list (see plcrash_async_image_list_set_reading()) for
+ * the lifetime of @a cache; refer to plcrash_parallel_unwind_run_job().
+ */
+static void plcrash_parallel_unwind_symbolicate_thread (plcrash_parallel_unwind_pool_t *pool, plcrash_async_symbol_cache_t *cache, plcrash_parallel_unwind_thread_t *thread) {
+    for (uint32_t i = 0; i < thread->frame_count; i++) {
+        plcrash_parallel_unwind_frame_t *frame = &thread->frames[i];
+        if (frame->symbol_name != NULL)
+            continue;
+
+        plcrash_async_image_t *image = plcrash_async_image_containing_address(pool->image_list, (pl_vm_address_t) frame->pc);
+
+        /* If the symbol can not be found, our callback will not be called. */
+        if (image != NULL)
+            plcrash_async_find_symbol(&image->macho_image, pool->strategy, cache, (pl_vm_address_t) frame->pc, plcrash_parallel_unwind_found_symbol_cb, frame);
+    }
+}
+
+/**
+ * @internal
+ *
+ * Claim and process threads from the pool's current job until none remain.
+ */
+static void plcrash_parallel_unwind_run_job (plcrash_parallel_unwind_pool_t *pool) {
+    plcrash_async_symbol_cache_t cache;
+    plcrash_async_page_cache_t page_cache;
+    plcrash_async_mapping_cache_t mapping_cache;
+    plframe_unwind_plan_cache_t plan_cache;
+    bool has_cache = false;
+    bool has_page_cache = false;
+    bool has_plan_cache = false;
+
+    /* Symbol, page, mapping and unwind plan caches are not thread-safe; each participant maintains its own. */
+    if (pool->job == PLCRASH_PARALLEL_UNWIND_JOB_SYMBOLICATE) {
+        /*
+         * Symbolication runs once the target threads have been resumed, and so images may be removed (and their
+         * storage reclaimed) concurrently. The symbol cache's PC-keyed results and Objective-C method indexes are
+         * keyed by image, and would return another image's data were an image's storage reused while the cache
+         * is live. A single read reference is held for the cache's full lifetime, across all threads claimed by
+         * this participant, so that no cached image may be reclaimed.
+         */
+        plcrash_async_image_list_set_reading(pool->image_list, true);
+        if (plcrash_async_symbol_cache_init(&cache) != PLCRASH_ESUCCESS) {
+            plcrash_async_image_list_set_reading(pool->image_list, false);
+            return;
+        }
+        has_cache = true;
+    } else if (pool->job == PLCRASH_PARALLEL_UNWIND_JOB_WALK) {
+        /* The page cache is optional; on failure, stack memory will be read directly. */
+        has_page_cache = (plcrash_async_page_cache_init(&page_cache) == PLCRASH_ESUCCESS);
+
+        /* The unwind plan cache is likewise optional; on failure, plans will be derived for every frame. */
+        has_plan_cache = (plframe_unwind_plan_cache_init(&plan_cache) == PLCRASH_ESUCCESS && plframe_unwind_plan_cache_bind(&plan_cache));
+    }
+
+    plcrash_async_mapping_cache_init(&mapping_cache);
+    plcrash_async_mapping_cache_bind(&mapping_cache);
+
+    size_t idx;
+    while ((idx = atomic_fetch_add_explicit(&pool->next_thread, 1, memory_order_relaxed)) < pool->thread_count) {
+        plcrash_parallel_unwind_thread_t *thread = &pool->threads[idx];
+
+        switch (pool->job) {
+            case PLCRASH_PARALLEL_UNWIND_JOB_WALK:
+                plcrash_parallel_unwind_walk_thread(pool, has_page_cache ? &page_cache : NULL, thread);
+                break;
+
+            case PLCRASH_PARALLEL_UNWIND_JOB_SYMBOLICATE:
+                plcrash_parallel_unwind_symbolicate_thread(pool, &cache, thread);
+                break;
+
+            case PLCRASH_PARALLEL_UNWIND_JOB_EXIT:
+                break;
+        }
+    }
+
+    plcrash_async_mapping_cache_unbind(&mapping_cache);
+
+    if (has_plan_cache)
+        plframe_unwind_plan_cache_unbind(&plan_cache);
+
+    if (has_cache) {
+        plcrash_async_symbol_cache_free(&cache);
+        plcrash_async_image_list_set_reading(pool->image_list, false);
+    }
+
+    if (has_page_cache)
+        plcrash_async_page_cache_free(&page_cache);
+
+    if (pool->job == PLCRASH_PARALLEL_UNWIND_JOB_WALK)
+        plframe_unwind_plan_cache_free(&plan_cache);
+
+    plcrash_async_mapping_cache_free(&mapping_cache);
+}
+
+/**
+ * @internal
+ *
+ * Worker thread entry point.
+ */
+static void *plcrash_parallel_unwind_worker (void *ctx) {
+    plcrash_parallel_unwind_pool_t *pool = ctx;
+
+    while (true) {
+        /* Wait for a new job */
+        if (semaphore_wait(pool->start_sem) != KERN_SUCCESS)
+            continue;
+
+        atomic_thread_fence(memory_order_acquire);
+        if (pool->job == PLCRASH_PARALLEL_UNWIND_JOB_EXIT) {
+            semaphore_signal(pool->done_sem);
+            return NULL;
+        }
+
+        plcrash_parallel_unwind_run_job(pool);
+
+        atomic_thread_fence(memory_order_release);
+        semaphore_signal(pool->done_sem);
+    }
+}
+
+/**
+ * @internal
+ *
+ * Run @a job on the calling thread and all pool workers, returning once all threads have been processed.
+ */
+static void plcrash_parallel_unwind_pool_dispatch (plcrash_parallel_unwind_pool_t *pool, plcrash_parallel_unwind_job_t job) {
+    pool->job = job;
+    atomic_store_explicit(&pool->next_thread, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    for (uint32_t i = 0; i < pool->worker_count; i++)
+        semaphore_signal(pool->start_sem);
+
+    /* Participate in the job */
+    if (job != PLCRASH_PARALLEL_UNWIND_JOB_EXIT)
+        plcrash_parallel_unwind_run_job(pool);
+
+    for (uint32_t i = 0; i < pool->worker_count; i++) {
+        while (semaphore_wait(pool->done_sem) != KERN_SUCCESS) {
+            /* Retry on interruption */
+        }
+    }
+
+    atomic_thread_fence(memory_order_acquire);
+}
+
+/**
+ * Initialize a worker pool, spawning @a worker_count worker threads.
+ *
+ * Worker threads are created prior to use, so that the pool may be used to unwind threads that have since been
+ * suspended. The pool should be initialized after the target task's thread list has been fetched, ensuring that
+ * the pool's own workers are neither suspended nor included in the unwound threads.
+ *
+ * @param pool The pool to initialize.
+ * @param worker_count The number of worker threads to spawn, in addition to the calling thread. If worker
+ * threads can not be created, the pool will fall back to performing all work on the calling thread.
+ *
+ * @return Returns PLCRASH_ESUCCESS on success, or an error if the pool's synchronization primitives could
+ * not be allocated.
+ */
+plcrash_error_t plcrash_nasync_parallel_unwind_pool_init (plcrash_parallel_unwind_pool_t *pool, uint32_t worker_count) {
+    kern_return_t kr;
+
+    memset(pool, 0, sizeof(*pool));
+    atomic_init(&pool->next_thread, 0);
+
+    if ((kr = semaphore_create(mach_task_self(), &pool->start_sem, SYNC_POLICY_FIFO, 0)) != KERN_SUCCESS) {
+        PLCF_DEBUG("semaphore_create() failed: %d", kr);
+        return PLCRASH_EINTERNAL;
+    }
+
+    if ((kr = semaphore_create(mach_task_self(), &pool->done_sem, SYNC_POLICY_FIFO, 0)) != KERN_SUCCESS) {
+        PLCF_DEBUG("semaphore_create() failed: %d", kr);
+        semaphore_destroy(mach_task_self(), pool->start_sem);
+        return PLCRASH_EINTERNAL;
+    }
+
+    if (worker_count == 0)
+        return PLCRASH_ESUCCESS;
+
+    pool->workers = calloc(worker_count, sizeof(pool->workers[0]));
+    if (pool->workers == NULL) {
+        PLCF_DEBUG("Could not allocate worker array; unwinding will be performed serially");
+        return PLCRASH_ESUCCESS;
+    }
+
+    for (uint32_t i = 0; i < worker_count; i++) {
+        if (pthread_create(&pool->workers[i], NULL, plcrash_parallel_unwind_worker, pool) != 0) {
+            PLCF_DEBUG("Failed to create unwind worker thread: %s", strerror(errno));
+            break;
+        }
+        pool->worker_count++;
+    }
+
+    return PLCRASH_ESUCCESS;
+}
+
+/**
+ * Unwind the stacks of all @a threads in parallel, populating each thread's frames.
+ *
+ * No memory is allocated by this function; it may be called while other threads in the task (excluding the
+ * pool's workers) are suspended.
+ *
+ * @param pool The worker pool.
+ * @param task The task in which the threads are executing.
+ * @param image_list The task's image list.
+ * @param threads The threads to unwind. Each thread's thread_state must be populated.
+ * @param thread_count The number of entries in @a threads.
+ */
+void plcrash_parallel_unwind_pool_walk (plcrash_parallel_unwind_pool_t *pool, task_t task, plcrash_async_image_list_t *image_list, plcrash_parallel_unwind_thread_t *threads, size_t thread_count) {
+    pool->task = task;
+    pool->image_list = image_list;
+    pool->threads = threads;
+    pool->thread_count = thread_count;
+
+    plcrash_parallel_unwind_pool_dispatch(pool, PLCRASH_PARALLEL_UNWIND_JOB_WALK);
+}
+
+/**
+ * Symbolicate the unwound frames of all @a threads in parallel.
+ *
+ * Symbol names are copied to the heap; unlike plcrash_parallel_unwind_pool_walk(), this function should be called
+ * only once the target task's threads have been resumed. Each participant holds a read reference to @a image_list
+ * for the duration of the job, and so images removed during symbolication will not be reclaimed until it completes.
+ *
+ * @param pool The worker pool.
+ * @param image_list The task's image list.
+ * @param strategy The symbolication strategy to use.
+ * @param threads The threads to symbolicate, as previously populated by plcrash_parallel_unwind_pool_walk().
+ * @param thread_count The number of entries in @a threads.
+ */
+void plcrash_nasync_parallel_unwind_pool_symbolicate (plcrash_parallel_unwind_pool_t *pool, plcrash_async_image_list_t *image_list, plcrash_async_symbol_strategy_t strategy, plcrash_parallel_unwind_thread_t *threads, size_t thread_count) {
+    if (strategy == PLCRASH_ASYNC_SYMBOL_STRATEGY_NONE)
+        return;
+
+    pool->image_list = image_list;
+    pool->strategy = strategy;
+    pool->threads = threads;
+    pool->thread_count = thread_count;
+
+    plcrash_parallel_unwind_pool_dispatch(pool, PLCRASH_PARALLEL_UNWIND_JOB_SYMBOLICATE);
+}
+
+/**
+ * Terminate all worker threads and free the pool's resources.
+ *
+ * @param pool The pool to free.
+ */
+void plcrash_nasync_parallel_unwind_pool_free (plcrash_parallel_unwind_pool_t *pool) {
+    plcrash_parallel_unwind_pool_dispatch(pool, PLCRASH_PARALLEL_UNWIND_JOB_EXIT);
+
+    for (uint32_t i = 0; i < pool->worker_count; i++)
+        pthread_join(pool->workers[i], NULL);
+
+    free(pool->workers);
+    pool->workers = NULL;
+    pool->worker_count = 0;
+
+    semaphore_destroy(mach_task_self(), pool->start_sem);
+    semaphore_destroy(mach_task_self(), pool->done_sem);
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef PLCRASH_PARALLEL_UNWIND_H
+#define PLCRASH_PARALLEL_UNWIND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <mach/mach.h>
+
+#include "PLCrashAsync.h"
+#include "PLCrashAsyncImageList.h"
+#include "PLCrashAsyncSymbolication.h"
+#include "PLCrashFrameWalker.h"
+
+/**
+ * @internal
+ * @ingroup plcrash_log_writer
+ * @defgroup plcrash_parallel_unwind Parallel Live Unwinding
+ *
+ * Unwinds and symbolicates a set of captured thread states across a pool of worker threads.
+ *
+ * This is intended solely for use when generating live (non-crash) reports, where the process is healthy and
+ * additional threads may be safely created; it must not be used from a crash handler.
+ * @{
+ */
+
+/**
+ * @internal
+ *
+ * A single unwound stack frame.
+ */
+typedef struct plcrash_parallel_unwind_frame {
+    /** The frame's PC value. */
+    uint64_t pc;
+
+    /** The start address of the frame's symbol. Only valid if @a symbol_name is non-NULL. */
+    uint64_t symbol_start;
+
+    /** The frame's NUL-terminated symbol name, or NULL if no symbol was found. */
+    char *symbol_name;
+} plcrash_parallel_unwind_frame_t;
+
+/**
+ * @internal
+ *
+ * A single thread's initial state and unwound frames.
+ */
+typedef struct plcrash_parallel_unwind_thread {
+    /** The thread state from which unwinding will begin. Must be populated by the caller prior to unwinding. */
+    plcrash_async_thread_state_t thread_state;
+
+    /** The unwound frames. */
+    plcrash_parallel_unwind_frame_t *frames;
+
+    /** The number of valid entries in @a frames. */
+    uint32_t frame_count;
+
+    /** The maximum number of entries that may be written to @a frames. */
+    uint32_t max_frames;
+
+    /** The result that terminated unwinding. PLFRAME_ENOFRAME if the end of the stack was reached. */
+    plframe_error_t error;
+} plcrash_parallel_unwind_thread_t;
+
+/**
+ * @internal
+ *
+ * A unit of work to be performed by a plcrash_parallel_unwind_pool_t.
+ */
+typedef enum {
+    /** Unwind each thread's stack. */
+    PLCRASH_PARALLEL_UNWIND_JOB_WALK = 0,
+
+    /** Symbolicate each thread's unwound frames. */
+    PLCRASH_PARALLEL_UNWIND_JOB_SYMBOLICATE = 1,
+
+    /** Terminate the worker threads. */
+    PLCRASH_PARALLEL_UNWIND_JOB_EXIT = 2
+} plcrash_parallel_unwind_job_t;
+
+/**
+ * @internal
+ *
+ * A pool of worker threads used to unwind and symbolicate threads in parallel. Work is distributed a thread at a time;
+ * the calling thread participates in each job, and so a pool with no workers will perform all work serially.
+ */
+typedef struct plcrash_parallel_unwind_pool {
+    /** The number of worker threads. */
+    uint32_t worker_count;
+
+    /** The worker threads. */
+    pthread_t *workers;
+
+    /** Signaled once per worker to start a job. */
+    semaphore_t start_sem;
+
+    /** Signaled by each worker on job completion. */
+    semaphore_t done_sem;
+
+    /** The current job. */
+    plcrash_parallel_unwind_job_t job;
+
+    /** The task in which the threads being unwound are executing. */
+    task_t task;
+
+    /** The image list used for unwinding and symbolication. */
+    plcrash_async_image_list_t *image_list;
+
+    /** The symbolication strategy. */
+    plcrash_async_symbol_strategy_t strategy;
+
+    /** The threads being processed by the current job. */
+    plcrash_parallel_unwind_thread_t *threads;
+
+    /** The number of entries in @a threads. */
+    size_t thread_count;
+
+    /** The index of the next unclaimed entry in @a threads. */
+    atomic_size_t next_thread;
+} plcrash_parallel_unwind_pool_t;
+
+plcrash_error_t plcrash_nasync_parallel_unwind_thread_init (plcrash_parallel_unwind_thread_t *thread, uint32_t max_frames);
+void plcrash_nasync_parallel_unwind_thread_free (plcrash_parallel_unwind_thread_t *thread);
+
+plcrash_error_t plcrash_nasync_parallel_unwind_pool_init (plcrash_parallel_unwind_pool_t *pool, uint32_t worker_count);
+void plcrash_parallel_unwind_pool_walk (plcrash_parallel_unwind_pool_t *pool, task_t task, plcrash_async_image_list_t *image_list, plcrash_parallel_unwind_thread_t *threads, size_t thread_count);
+void plcrash_nasync_parallel_unwind_pool_symbolicate (plcrash_parallel_unwind_pool_t *pool, plcrash_async_image_list_t *image_list, plcrash_async_symbol_strategy_t strategy, plcrash_parallel_unwind_thread_t *threads, size_t thread_count);
+void plcrash_nasync_parallel_unwind_pool_free (plcrash_parallel_unwind_pool_t *pool);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCRASH_PARALLEL_UNWIND_H */
@@ -72,6 +72,13 @@
  * an entirely new crash log format. */
 #define PLCRASH_REPORT_FILE_VERSION 1
 
+/**
+ * @ingroup constants
+ * Crash format version byte identifier for report format v2. Reports are written in this format if they contain
+ * packed, image-relative stack frames or a report string table; readers that only support
+ * #PLCRASH_REPORT_FILE_VERSION will reject them. */
+#define PLCRASH_REPORT_FILE_VERSION_2 2
+
 /**
  * @ingroup types
  * Crash log file header format.
@@ -53,6 +53,9 @@ struct _PLCrashReportDecoder {
 - (PLCrashReportApplicationInfo *) extractApplicationInfo: (Plcrash__CrashReport__ApplicationInfo *) applicationInfo error: (NSError **) outError;
 - (PLCrashReportProcessInfo *) extractProcessInfo: (Plcrash__CrashReport__ProcessInfo *) processInfo error: (NSError **) outError;
 - (NSArray *) extractThreadInfo: (Plcrash__CrashReport *) crashReport error: (NSError **) outError;
+- (NSString *) stringTableValue: (uint32_t) ref crashReport: (Plcrash__CrashReport *) crashReport error: (NSError **) outError;
+- (uint64_t) instructionPointerForFramePC: (uint64_t) pc;
+- (NSArray *) extractPackedStackFrames: (Plcrash__CrashReport__Thread *) thread crashReport: (Plcrash__CrashReport *) crashReport error: (NSError **) outError;
 - (NSArray *) extractImageInfo: (Plcrash__CrashReport *) crashReport error: (NSError **) outError;
 - (PLCrashReportExceptionInfo *) extractExceptionInfo: (Plcrash__CrashReport__Exception *) exceptionInfo error: (NSError **) outError;
 - (PLCrashReportSignalInfo *) extractSignalInfo: (Plcrash__CrashReport__Signal *) signalInfo error: (NSError **) outError;
@@ -105,6 +108,9 @@ static void populate_nserror (NSError **error, PLCrashReporterError code, NSStri
 
     /** Report UUID */
     CFUUIDRef _uuid;
+
+    /** Resolved string table values, indexed by (reference - 1). Unresolved entries are NSNull (may be nil) */
+    __strong NSMutableArray *_stringTableValues;
 }
 
 /**
@@ -323,7 +329,7 @@ error:
     }
 
     /* Check the version */
-    if(header->version != PLCRASH_REPORT_FILE_VERSION) {
+    if (header->version != PLCRASH_REPORT_FILE_VERSION && header->version != PLCRASH_REPORT_FILE_VERSION_2) {
         populate_nserror(outError, PLCrashReporterErrorCrashReportInvalid, [NSString stringWithFormat: NSLocalizedString(@"Could not decode unsupported crash report version: %d", 
                                                                                                                          @"Crash log decoding message"), header->version]);
         return NULL;
@@ -608,7 +614,14 @@ error:
         return nil;
     }
     
-    NSString *name = [NSString stringWithUTF8String: symbol->name];
+    NSString *name;
+    if (symbol->has_name_ref) {
+        if ((name = [self stringTableValue: symbol->name_ref crashReport: _decoder->crashReport error: outError]) == nil)
+            return nil;
+    } else {
+        name = [NSString stringWithUTF8String: symbol->name];
+    }
+
     return [[PLCrashReportSymbolInfo alloc] initWithSymbolName: name
                                                    startAddress: symbol->start_address
                                                      endAddress: symbol->has_end_address ? symbol->end_address : 0];
@@ -632,7 +645,72 @@ error:
         if ((symbolInfo = [self extractSymbolInfo: stackFrame->symbol error: outError]) == NULL)
             return nil;
     }
-    uint64_t instructionPointer = stackFrame->pc;
+    return [[PLCrashReportStackFrameInfo alloc] initWithInstructionPointer: [self instructionPointerForFramePC: stackFrame->pc]
+                                                                symbolInfo: symbolInfo];
+}
+
+/**
+ * Resolve a string table reference to its string value. Returns nil on error.
+ *
+ * Values are resolved lazily by walking the entry's prefix chain, and each resolved entry is cached; entries
+ * sharing a common prefix (such as binary image paths within the same directory) are only resolved once.
+ *
+ * @param ref The 1-based string table reference.
+ * @param crashReport The crash report containing the string table.
+ * @param outError If an error occurs, this pointer will contain an NSError object.
+ */
+- (NSString *) stringTableValue: (uint32_t) ref crashReport: (Plcrash__CrashReport *) crashReport error: (NSError **) outError {
+    if (ref == 0 || ref > crashReport->n_string_table) {
+        populate_nserror(outError, PLCrashReporterErrorCrashReportInvalid, @"Invalid string table reference in crash report");
+        return nil;
+    }
+
+    if (_stringTableValues == nil) {
+        _stringTableValues = [NSMutableArray arrayWithCapacity: crashReport->n_string_table];
+        for (size_t i = 0; i < crashReport->n_string_table; i++)
+            [_stringTableValues addObject: [NSNull null]];
+    }
+
+    /* Walk the prefix chain back to the first resolved (or root) entry. Prefixes must always refer to an earlier
+     * entry, which guarantees termination. */
+    NSMutableArray *chain = [NSMutableArray array];
+    NSString *value = @"";
+    for (uint32_t idx = ref; idx != 0;) {
+        id cached = _stringTableValues[idx - 1];
+        if (cached != [NSNull null]) {
+            value = cached;
+            break;
+        }
+
+        Plcrash__CrashReport__StringTableEntry *entry = crashReport->string_table[idx - 1];
+        if (entry->suffix == NULL || (entry->has_prefix && entry->prefix >= idx)) {
+            populate_nserror(outError, PLCrashReporterErrorCrashReportInvalid, @"Invalid string table entry in crash report");
+            return nil;
+        }
+
+        [chain addObject: @(idx)];
+        idx = entry->has_prefix ? entry->prefix : 0;
+    }
+
+    /* Resolve the unresolved entries, from the root outwards */
+    for (NSNumber *idx in [chain reverseObjectEnumerator]) {
+        NSString *suffix = [NSString stringWithUTF8String: crashReport->string_table[[idx unsignedIntValue] - 1]->suffix];
+        if (suffix == nil) {
+            populate_nserror(outError, PLCrashReporterErrorCrashReportInvalid, @"Invalid string table entry encoding in crash report");
+            return nil;
+        }
+
+        value = [value stringByAppendingString: suffix];
+        _stringTableValues[[idx unsignedIntValue] - 1] = value;
+    }
+
+    return value;
+}
+
+/**
+ * Return the instruction pointer for a stack frame's recorded PC value.
+ */
+- (uint64_t) instructionPointerForFramePC: (uint64_t) pc {
     /*
      * Workaround to handle incorrectly collected reports by old PLCrashReporter versions.
      * This guard does nothing on correctly collected reports.
@@ -640,10 +718,69 @@ error:
     if (_machineInfo &&
         _machineInfo.processorInfo.type == CPU_TYPE_ARM64 &&
         _machineInfo.processorInfo.subtype == CPU_SUBTYPE_ARM64E) {
-        instructionPointer &= ARM64_PTR_MASK;
+        return pc & ARM64_PTR_MASK;
     }
-    return [[PLCrashReportStackFrameInfo alloc] initWithInstructionPointer: instructionPointer
-                                                                symbolInfo: symbolInfo];
+    return pc;
+}
+
+/**
+ * Extract packed, image-relative stack frames (report format v2) from a thread. Returns nil on error, or an array
+ * of PLCrashReportStackFrameInfo instances on success.
+ */
+- (NSArray *) extractPackedStackFrames: (Plcrash__CrashReport__Thread *) thread crashReport: (Plcrash__CrashReport *) crashReport error: (NSError **) outError {
+    /* Frames are encoded as (image index, offset) pairs */
+    if (thread->n_packed_frames % 2 != 0) {
+        populate_nserror(outError, PLCrashReporterErrorCrashReportInvalid, @"Invalid packed stack frame count in crash report");
+        return nil;
+    }
+
+    size_t frame_count = thread->n_packed_frames / 2;
+    size_t symbol_idx = 0;
+    NSMutableArray *frames = [NSMutableArray arrayWithCapacity: frame_count];
+    for (size_t frame_idx = 0; frame_idx < frame_count; frame_idx++) {
+        uint64_t image_index = thread->packed_frames[frame_idx * 2];
+        uint64_t offset = thread->packed_frames[frame_idx * 2 + 1];
+
+        /* Resolve the image's base address; an index of 0 denotes an absolute address. */
+        uint64_t base_address = 0;
+        if (image_index != 0) {
+            if (image_index > crashReport->n_binary_images) {
+                populate_nserror(outError, PLCrashReporterErrorCrashReportInvalid, @"Invalid binary image index in packed stack frame");
+                return nil;
+            }
+            base_address = crashReport->binary_images[image_index - 1]->base_address;
+        }
+
+        /* Symbol records are written in frame order */
+        PLCrashReportSymbolInfo *symbolInfo = nil;
+        while (symbol_idx < thread->n_frame_symbols && thread->frame_symbols[symbol_idx]->frame < frame_idx)
+            symbol_idx++;
+
+        if (symbol_idx < thread->n_frame_symbols && thread->frame_symbols[symbol_idx]->frame == frame_idx) {
+            Plcrash__CrashReport__Thread__FrameSymbol *symbol = thread->frame_symbols[symbol_idx];
+            NSString *name;
+            if (symbol->has_name_ref) {
+                if ((name = [self stringTableValue: symbol->name_ref crashReport: crashReport error: outError]) == nil)
+                    return nil;
+            } else if (symbol->name != NULL) {
+                name = [NSString stringWithUTF8String: symbol->name];
+            } else {
+                populate_nserror(outError, PLCrashReporterErrorCrashReportInvalid, @"Missing symbol name in packed stack frame");
+                return nil;
+            }
+
+            symbolInfo = [[PLCrashReportSymbolInfo alloc] initWithSymbolName: name
+                                                                 startAddress: base_address + symbol->start_offset
+                                                                   endAddress: 0];
+        }
+
+        PLCrashReportStackFrameInfo *frameInfo;
+        frameInfo = [[PLCrashReportStackFrameInfo alloc] initWithInstructionPointer: [self instructionPointerForFramePC: base_address + offset]
+                                                                          symbolInfo: symbolInfo];
+        [frames addObject: frameInfo];
+    }
+
+    return frames;
 }
 
 /**
@@ -675,6 +812,15 @@ error:
             [frames addObject: frameInfo];
         }
 
+        /* Fetch packed stack frames (report format v2) */
+        if (thread->n_packed_frames > 0) {
+            NSArray *packedFrames = [self extractPackedStackFrames: thread crashReport: crashReport error: outError];
+            if (packedFrames == nil)
+                return nil;
+
+            [frames addObjectsFromArray: packedFrames];
+        }
+
         /* Fetch registers for this thread */
         NSMutableArray *registers = [NSMutableArray arrayWithCapacity: thread->n_registers];
         for (size_t reg_idx = 0; reg_idx < thread->n_registers; reg_idx++) {
@@ -723,7 +869,13 @@ error:
         PLCrashReportBinaryImageInfo *imageInfo;
 
         /* Validate */
-        if (image->name == NULL) {
+        NSString *name;
+        if (image->has_name_ref) {
+            if ((name = [self stringTableValue: image->name_ref crashReport: crashReport error: outError]) == nil)
+                return nil;
+        } else if (image->name != NULL) {
+            name = [NSString stringWithUTF8String: image->name];
+        } else {
             populate_nserror(outError, PLCrashReporterErrorCrashReportInvalid, @"Missing image name in image record");
             return nil;
         }
@@ -749,7 +901,7 @@ error:
         imageInfo = [[PLCrashReportBinaryImageInfo alloc] initWithCodeType: codeType
                                                                 baseAddress: image->base_address
                                                                        size: image->size
-                                                                       name: [NSString stringWithUTF8String: image->name]
+                                                                       name: name
                                                                        uuid: uuid];
         [images addObject: imageInfo];
     }
@@ -43,6 +43,12 @@ void   plcrash__crash_report__thread__register_value__init
   static const Plcrash__CrashReport__Thread__RegisterValue init_value = PLCRASH__CRASH_REPORT__THREAD__REGISTER_VALUE__INIT;
   *message = init_value;
 }
+void   plcrash__crash_report__thread__frame_symbol__init
+                     (Plcrash__CrashReport__Thread__FrameSymbol         *message)
+{
+  static const Plcrash__CrashReport__Thread__FrameSymbol init_value = PLCRASH__CRASH_REPORT__THREAD__FRAME_SYMBOL__INIT;
+  *message = init_value;
+}
 void   plcrash__crash_report__thread__init
                      (Plcrash__CrashReport__Thread         *message)
 {
@@ -91,6 +97,12 @@ void   plcrash__crash_report__report_info__init
   static const Plcrash__CrashReport__ReportInfo init_value = PLCRASH__CRASH_REPORT__REPORT_INFO__INIT;
   *message = init_value;
 }
+void   plcrash__crash_report__string_table_entry__init
+                     (Plcrash__CrashReport__StringTableEntry         *message)
+{
+  static const Plcrash__CrashReport__StringTableEntry init_value = PLCRASH__CRASH_REPORT__STRING_TABLE_ENTRY__INIT;
+  *message = init_value;
+}
 void   plcrash__crash_report__init
                      (Plcrash__CrashReport         *message)
 {
@@ -419,7 +431,7 @@ const ProtobufCMessageDescriptor plcrash__crash_report__application_info__descri
   (ProtobufCMessageInit) plcrash__crash_report__application_info__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor plcrash__crash_report__symbol__field_descriptors[3] =
+static const ProtobufCFieldDescriptor plcrash__crash_report__symbol__field_descriptors[4] =
 {
   {
     "name",
@@ -457,16 +469,29 @@ static const ProtobufCFieldDescriptor plcrash__crash_report__symbol__field_descr
     0,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+  {
+    "name_ref",
+    4,
+    PROTOBUF_C_LABEL_OPTIONAL,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(Plcrash__CrashReport__Symbol, has_name_ref),
+    offsetof(Plcrash__CrashReport__Symbol, name_ref),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
 };
 static const unsigned plcrash__crash_report__symbol__field_indices_by_name[] = {
   2,   /* field[2] = end_address */
   0,   /* field[0] = name */
+  3,   /* field[3] = name_ref */
   1,   /* field[1] = start_address */
 };
 static const ProtobufCIntRange plcrash__crash_report__symbol__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 3 }
+  { 0, 4 }
 };
 const ProtobufCMessageDescriptor plcrash__crash_report__symbol__descriptor =
 {
@@ -476,7 +501,7 @@ const ProtobufCMessageDescriptor plcrash__crash_report__symbol__descriptor =
   "Plcrash__CrashReport__Symbol",
   "plcrash",
   sizeof(Plcrash__CrashReport__Symbol),
-  3,
+  4,
   plcrash__crash_report__symbol__field_descriptors,
   plcrash__crash_report__symbol__field_indices_by_name,
   1,  plcrash__crash_report__symbol__number_ranges,
@@ -586,7 +611,84 @@ const ProtobufCMessageDescriptor plcrash__crash_report__thread__register_value__
   (ProtobufCMessageInit) plcrash__crash_report__thread__register_value__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor plcrash__crash_report__thread__field_descriptors[4] =
+static const ProtobufCFieldDescriptor plcrash__crash_report__thread__frame_symbol__field_descriptors[4] =
+{
+  {
+    "frame",
+    1,
+    PROTOBUF_C_LABEL_REQUIRED,
+    PROTOBUF_C_TYPE_UINT32,
+    0,   /* quantifier_offset */
+    offsetof(Plcrash__CrashReport__Thread__FrameSymbol, frame),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "name",
+    2,
+    PROTOBUF_C_LABEL_REQUIRED,
+    PROTOBUF_C_TYPE_STRING,
+    0,   /* quantifier_offset */
+    offsetof(Plcrash__CrashReport__Thread__FrameSymbol, name),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "start_offset",
+    3,
+    PROTOBUF_C_LABEL_REQUIRED,
+    PROTOBUF_C_TYPE_UINT64,
+    0,   /* quantifier_offset */
+    offsetof(Plcrash__CrashReport__Thread__FrameSymbol, start_offset),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "name_ref",
+    4,
+    PROTOBUF_C_LABEL_OPTIONAL,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(Plcrash__CrashReport__Thread__FrameSymbol, has_name_ref),
+    offsetof(Plcrash__CrashReport__Thread__FrameSymbol, name_ref),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned plcrash__crash_report__thread__frame_symbol__field_indices_by_name[] = {
+  0,   /* field[0] = frame */
+  1,   /* field[1] = name */
+  3,   /* field[3] = name_ref */
+  2,   /* field[2] = start_offset */
+};
+static const ProtobufCIntRange plcrash__crash_report__thread__frame_symbol__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 4 }
+};
+const ProtobufCMessageDescriptor plcrash__crash_report__thread__frame_symbol__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "plcrash.CrashReport.Thread.FrameSymbol",
+  "FrameSymbol",
+  "Plcrash__CrashReport__Thread__FrameSymbol",
+  "plcrash",
+  sizeof(Plcrash__CrashReport__Thread__FrameSymbol),
+  4,
+  plcrash__crash_report__thread__frame_symbol__field_descriptors,
+  plcrash__crash_report__thread__frame_symbol__field_indices_by_name,
+  1,  plcrash__crash_report__thread__frame_symbol__number_ranges,
+  (ProtobufCMessageInit) plcrash__crash_report__thread__frame_symbol__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor plcrash__crash_report__thread__field_descriptors[6] =
 {
   {
     "thread_number",
@@ -636,17 +738,43 @@ static const ProtobufCFieldDescriptor plcrash__crash_report__thread__field_descr
     0,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+  {
+    "packed_frames",
+    5,
+    PROTOBUF_C_LABEL_REPEATED,
+    PROTOBUF_C_TYPE_UINT64,
+    offsetof(Plcrash__CrashReport__Thread, n_packed_frames),
+    offsetof(Plcrash__CrashReport__Thread, packed_frames),
+    NULL,
+    NULL,
+    0 | PROTOBUF_C_FIELD_FLAG_PACKED,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "frame_symbols",
+    6,
+    PROTOBUF_C_LABEL_REPEATED,
+    PROTOBUF_C_TYPE_MESSAGE,
+    offsetof(Plcrash__CrashReport__Thread, n_frame_symbols),
+    offsetof(Plcrash__CrashReport__Thread, frame_symbols),
+    &plcrash__crash_report__thread__frame_symbol__descriptor,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
 };
 static const unsigned plcrash__crash_report__thread__field_indices_by_name[] = {
   2,   /* field[2] = crashed */
+  5,   /* field[5] = frame_symbols */
   1,   /* field[1] = frames */
+  4,   /* field[4] = packed_frames */
   3,   /* field[3] = registers */
   0,   /* field[0] = thread_number */
 };
 static const ProtobufCIntRange plcrash__crash_report__thread__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 4 }
+  { 0, 6 }
 };
 const ProtobufCMessageDescriptor plcrash__crash_report__thread__descriptor =
 {
@@ -656,14 +784,14 @@ const ProtobufCMessageDescriptor plcrash__crash_report__thread__descriptor =
   "Plcrash__CrashReport__Thread",
   "plcrash",
   sizeof(Plcrash__CrashReport__Thread),
-  4,
+  6,
   plcrash__crash_report__thread__field_descriptors,
   plcrash__crash_report__thread__field_indices_by_name,
   1,  plcrash__crash_report__thread__number_ranges,
   (ProtobufCMessageInit) plcrash__crash_report__thread__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor plcrash__crash_report__binary_image__field_descriptors[5] =
+static const ProtobufCFieldDescriptor plcrash__crash_report__binary_image__field_descriptors[6] =
 {
   {
     "base_address",
@@ -725,18 +853,31 @@ static const ProtobufCFieldDescriptor plcrash__crash_report__binary_image__field
     0,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+  {
+    "name_ref",
+    6,
+    PROTOBUF_C_LABEL_OPTIONAL,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(Plcrash__CrashReport__BinaryImage, has_name_ref),
+    offsetof(Plcrash__CrashReport__BinaryImage, name_ref),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
 };
 static const unsigned plcrash__crash_report__binary_image__field_indices_by_name[] = {
   0,   /* field[0] = base_address */
   4,   /* field[4] = code_type */
   2,   /* field[2] = name */
+  5,   /* field[5] = name_ref */
   1,   /* field[1] = size */
   3,   /* field[3] = uuid */
 };
 static const ProtobufCIntRange plcrash__crash_report__binary_image__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 5 }
+  { 0, 6 }
 };
 const ProtobufCMessageDescriptor plcrash__crash_report__binary_image__descriptor =
 {
@@ -746,7 +887,7 @@ const ProtobufCMessageDescriptor plcrash__crash_report__binary_image__descriptor
   "Plcrash__CrashReport__BinaryImage",
   "plcrash",
   sizeof(Plcrash__CrashReport__BinaryImage),
-  5,
+  6,
   plcrash__crash_report__binary_image__field_descriptors,
   plcrash__crash_report__binary_image__field_indices_by_name,
   1,  plcrash__crash_report__binary_image__number_ranges,
@@ -1189,7 +1330,58 @@ const ProtobufCMessageDescriptor plcrash__crash_report__report_info__descriptor
   (ProtobufCMessageInit) plcrash__crash_report__report_info__init,
   NULL,NULL,NULL    /* reserved[123] */
 };
-static const ProtobufCFieldDescriptor plcrash__crash_report__field_descriptors[10] =
+static const ProtobufCFieldDescriptor plcrash__crash_report__string_table_entry__field_descriptors[2] =
+{
+  {
+    "prefix",
+    1,
+    PROTOBUF_C_LABEL_OPTIONAL,
+    PROTOBUF_C_TYPE_UINT32,
+    offsetof(Plcrash__CrashReport__StringTableEntry, has_prefix),
+    offsetof(Plcrash__CrashReport__StringTableEntry, prefix),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+  {
+    "suffix",
+    2,
+    PROTOBUF_C_LABEL_REQUIRED,
+    PROTOBUF_C_TYPE_STRING,
+    0,   /* quantifier_offset */
+    offsetof(Plcrash__CrashReport__StringTableEntry, suffix),
+    NULL,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
+};
+static const unsigned plcrash__crash_report__string_table_entry__field_indices_by_name[] = {
+  0,   /* field[0] = prefix */
+  1,   /* field[1] = suffix */
+};
+static const ProtobufCIntRange plcrash__crash_report__string_table_entry__number_ranges[1 + 1] =
+{
+  { 1, 0 },
+  { 0, 2 }
+};
+const ProtobufCMessageDescriptor plcrash__crash_report__string_table_entry__descriptor =
+{
+  PROTOBUF_C__MESSAGE_DESCRIPTOR_MAGIC,
+  "plcrash.CrashReport.StringTableEntry",
+  "StringTableEntry",
+  "Plcrash__CrashReport__StringTableEntry",
+  "plcrash",
+  sizeof(Plcrash__CrashReport__StringTableEntry),
+  2,
+  plcrash__crash_report__string_table_entry__field_descriptors,
+  plcrash__crash_report__string_table_entry__field_indices_by_name,
+  1,  plcrash__crash_report__string_table_entry__number_ranges,
+  (ProtobufCMessageInit) plcrash__crash_report__string_table_entry__init,
+  NULL,NULL,NULL    /* reserved[123] */
+};
+static const ProtobufCFieldDescriptor plcrash__crash_report__field_descriptors[11] =
 {
   {
     "system_info",
@@ -1311,6 +1503,18 @@ static const ProtobufCFieldDescriptor plcrash__crash_report__field_descriptors[1
     0,             /* flags */
     0,NULL,NULL    /* reserved1,reserved2, etc */
   },
+  {
+    "string_table",
+    11,
+    PROTOBUF_C_LABEL_REPEATED,
+    PROTOBUF_C_TYPE_MESSAGE,
+    offsetof(Plcrash__CrashReport, n_string_table),
+    offsetof(Plcrash__CrashReport, string_table),
+    &plcrash__crash_report__string_table_entry__descriptor,
+    NULL,
+    0,             /* flags */
+    0,NULL,NULL    /* reserved1,reserved2, etc */
+  },
 };
 static const unsigned plcrash__crash_report__field_indices_by_name[] = {
   1,   /* field[1] = application_info */
@@ -1321,13 +1525,14 @@ static const unsigned plcrash__crash_report__field_indices_by_name[] = {
   6,   /* field[6] = process_info */
   8,   /* field[8] = report_info */
   5,   /* field[5] = signal */
+  10,   /* field[10] = string_table */
   0,   /* field[0] = system_info */
   2,   /* field[2] = threads */
 };
 static const ProtobufCIntRange plcrash__crash_report__number_ranges[1 + 1] =
 {
   { 1, 0 },
-  { 0, 10 }
+  { 0, 11 }
 };
 const ProtobufCMessageDescriptor plcrash__crash_report__descriptor =
 {
@@ -1337,7 +1542,7 @@ const ProtobufCMessageDescriptor plcrash__crash_report__descriptor =
   "Plcrash__CrashReport",
   "plcrash",
   sizeof(Plcrash__CrashReport),
-  10,
+  11,
   plcrash__crash_report__field_descriptors,
   plcrash__crash_report__field_indices_by_name,
   1,  plcrash__crash_report__number_ranges,
@@ -23,6 +23,7 @@ typedef struct Plcrash__CrashReport__Symbol Plcrash__CrashReport__Symbol;
 typedef struct Plcrash__CrashReport__Thread Plcrash__CrashReport__Thread;
 typedef struct Plcrash__CrashReport__Thread__StackFrame Plcrash__CrashReport__Thread__StackFrame;
 typedef struct Plcrash__CrashReport__Thread__RegisterValue Plcrash__CrashReport__Thread__RegisterValue;
+typedef struct Plcrash__CrashReport__Thread__FrameSymbol Plcrash__CrashReport__Thread__FrameSymbol;
 typedef struct Plcrash__CrashReport__BinaryImage Plcrash__CrashReport__BinaryImage;
 typedef struct Plcrash__CrashReport__Exception Plcrash__CrashReport__Exception;
 typedef struct Plcrash__CrashReport__Signal Plcrash__CrashReport__Signal;
@@ -30,6 +31,7 @@ typedef struct Plcrash__CrashReport__Signal__MachException Plcrash__CrashReport_
 typedef struct Plcrash__CrashReport__ProcessInfo Plcrash__CrashReport__ProcessInfo;
 typedef struct Plcrash__CrashReport__MachineInfo Plcrash__CrashReport__MachineInfo;
 typedef struct Plcrash__CrashReport__ReportInfo Plcrash__CrashReport__ReportInfo;
+typedef struct Plcrash__CrashReport__StringTableEntry Plcrash__CrashReport__StringTableEntry;
 
 
 /* --- enums --- */
@@ -219,10 +221,16 @@ struct  Plcrash__CrashReport__Symbol
    */
   protobuf_c_boolean has_end_address;
   uint64_t end_address;
+  /*
+   * If present, the symbol name is the string_table entry with this 1-based index, and name is empty
+   * (report format v2). 
+   */
+  protobuf_c_boolean has_name_ref;
+  uint32_t name_ref;
 };
 #define PLCRASH__CRASH_REPORT__SYMBOL__INIT \
  { PROTOBUF_C_MESSAGE_INIT (&plcrash__crash_report__symbol__descriptor) \
-    , NULL, 0, 0, 0 }
+    , NULL, 0, 0, 0, 0, 0 }
 
 
 /*
@@ -273,6 +281,36 @@ struct  Plcrash__CrashReport__Thread__RegisterValue
     , NULL, 0 }
 
 
+/*
+ * Symbol information for a frame in packed_frames 
+ */
+struct  Plcrash__CrashReport__Thread__FrameSymbol
+{
+  ProtobufCMessage base;
+  /*
+   * The frame's index within packed_frames, counting each (image index, offset) pair as a single frame 
+   */
+  uint32_t frame;
+  /*
+   * Symbol name 
+   */
+  char *name;
+  /*
+   * The symbol's start address, relative to the base address of the frame's binary image. If the frame
+   * is not attributed to an image, this is the absolute start address. 
+   */
+  uint64_t start_offset;
+  /*
+   * If present, the symbol name is the string_table entry with this 1-based index, and name is empty. 
+   */
+  protobuf_c_boolean has_name_ref;
+  uint32_t name_ref;
+};
+#define PLCRASH__CRASH_REPORT__THREAD__FRAME_SYMBOL__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&plcrash__crash_report__thread__frame_symbol__descriptor) \
+    , 0, NULL, 0, 0, 0 }
+
+
 /*
  * Thread state 
  */
@@ -298,10 +336,24 @@ struct  Plcrash__CrashReport__Thread
    */
   size_t n_registers;
   Plcrash__CrashReport__Thread__RegisterValue **registers;
+  /*
+   * Packed, image-relative stack frames (report format v2). If present, frames will be empty.
+   * Each frame is encoded as a pair of values: the frame's binary image, as a 1-based index into binary_images,
+   * followed by the offset of the frame's PC from that image's base address. An image index of 0 denotes a PC
+   * that could not be attributed to an image, in which case the offset is the absolute PC.
+   * Frame symbols are not included inline, and are instead provided by frame_symbols.
+   */
+  size_t n_packed_frames;
+  uint64_t *packed_frames;
+  /*
+   * Symbol information for packed_frames, ordered by frame. Frames without symbol information are omitted. 
+   */
+  size_t n_frame_symbols;
+  Plcrash__CrashReport__Thread__FrameSymbol **frame_symbols;
 };
 #define PLCRASH__CRASH_REPORT__THREAD__INIT \
  { PROTOBUF_C_MESSAGE_INIT (&plcrash__crash_report__thread__descriptor) \
-    , 0, 0,NULL, 0, 0,NULL }
+    , 0, 0,NULL, 0, 0,NULL, 0,NULL, 0,NULL }
 
 
 /*
@@ -333,10 +385,16 @@ struct  Plcrash__CrashReport__BinaryImage
    * armv7 images may be mixed. 
    */
   Plcrash__CrashReport__Processor *code_type;
+  /*
+   * If present, the image name is the string_table entry with this 1-based index, and name is empty
+   * (report format v2). 
+   */
+  protobuf_c_boolean has_name_ref;
+  uint32_t name_ref;
 };
 #define PLCRASH__CRASH_REPORT__BINARY_IMAGE__INIT \
  { PROTOBUF_C_MESSAGE_INIT (&plcrash__crash_report__binary_image__descriptor) \
-    , 0, 0, NULL, 0, {0,NULL}, NULL }
+    , 0, 0, NULL, 0, {0,NULL}, NULL, 0, 0 }
 
 
 /*
@@ -518,6 +576,27 @@ struct  Plcrash__CrashReport__ReportInfo
     , 0, 0, {0,NULL} }
 
 
+/*
+ * A string table entry 
+ */
+struct  Plcrash__CrashReport__StringTableEntry
+{
+  ProtobufCMessage base;
+  /*
+   * If present, the 1-based index of an earlier string_table entry to be prepended to suffix. 
+   */
+  protobuf_c_boolean has_prefix;
+  uint32_t prefix;
+  /*
+   * The entry's string, following the prefix entry's string (if any). 
+   */
+  char *suffix;
+};
+#define PLCRASH__CRASH_REPORT__STRING_TABLE_ENTRY__INIT \
+ { PROTOBUF_C_MESSAGE_INIT (&plcrash__crash_report__string_table_entry__descriptor) \
+    , 0, 0, NULL }
+
+
 /*
  * A crash report 
  */
@@ -565,10 +644,17 @@ struct  Plcrash__CrashReport
    */
   protobuf_c_boolean has_custom_data;
   ProtobufCBinaryData custom_data;
+  /*
+   * Strings referenced by name_ref values (report format v2). Each entry's value is the value of its prefix
+   * entry, if any, followed by its suffix; image paths are stored as one entry per path component, allowing
+   * shared directory prefixes to be stored once.
+   */
+  size_t n_string_table;
+  Plcrash__CrashReport__StringTableEntry **string_table;
 };
 #define PLCRASH__CRASH_REPORT__INIT \
  { PROTOBUF_C_MESSAGE_INIT (&plcrash__crash_report__descriptor) \
-    , NULL, NULL, 0,NULL, 0,NULL, NULL, NULL, NULL, NULL, NULL, 0, {0,NULL} }
+    , NULL, NULL, 0,NULL, 0,NULL, NULL, NULL, NULL, NULL, NULL, 0, {0,NULL}, 0,NULL }
 
 
 /* Plcrash__CrashReport__Processor methods */
@@ -589,6 +675,9 @@ void   plcrash__crash_report__thread__stack_frame__init
 /* Plcrash__CrashReport__Thread__RegisterValue methods */
 void   plcrash__crash_report__thread__register_value__init
                      (Plcrash__CrashReport__Thread__RegisterValue         *message);
+/* Plcrash__CrashReport__Thread__FrameSymbol methods */
+void   plcrash__crash_report__thread__frame_symbol__init
+                     (Plcrash__CrashReport__Thread__FrameSymbol         *message);
 /* Plcrash__CrashReport__Thread methods */
 void   plcrash__crash_report__thread__init
                      (Plcrash__CrashReport__Thread         *message);
@@ -613,6 +702,9 @@ void   plcrash__crash_report__machine_info__init
 /* Plcrash__CrashReport__ReportInfo methods */
 void   plcrash__crash_report__report_info__init
                      (Plcrash__CrashReport__ReportInfo         *message);
+/* Plcrash__CrashReport__StringTableEntry methods */
+void   plcrash__crash_report__string_table_entry__init
+                     (Plcrash__CrashReport__StringTableEntry         *message);
 /* Plcrash__CrashReport methods */
 void   plcrash__crash_report__init
                      (Plcrash__CrashReport         *message);
@@ -652,6 +744,9 @@ typedef void (*Plcrash__CrashReport__Thread__StackFrame_Closure)
 typedef void (*Plcrash__CrashReport__Thread__RegisterValue_Closure)
                  (const Plcrash__CrashReport__Thread__RegisterValue *message,
                   void *closure_data);
+typedef void (*Plcrash__CrashReport__Thread__FrameSymbol_Closure)
+                 (const Plcrash__CrashReport__Thread__FrameSymbol *message,
+                  void *closure_data);
 typedef void (*Plcrash__CrashReport__Thread_Closure)
                  (const Plcrash__CrashReport__Thread *message,
                   void *closure_data);
@@ -676,6 +771,9 @@ typedef void (*Plcrash__CrashReport__MachineInfo_Closure)
 typedef void (*Plcrash__CrashReport__ReportInfo_Closure)
                  (const Plcrash__CrashReport__ReportInfo *message,
                   void *closure_data);
+typedef void (*Plcrash__CrashReport__StringTableEntry_Closure)
+                 (const Plcrash__CrashReport__StringTableEntry *message,
+                  void *closure_data);
 typedef void (*Plcrash__CrashReport_Closure)
                  (const Plcrash__CrashReport *message,
                   void *closure_data);
@@ -696,6 +794,7 @@ extern const ProtobufCMessageDescriptor plcrash__crash_report__symbol__descripto
 extern const ProtobufCMessageDescriptor plcrash__crash_report__thread__descriptor;
 extern const ProtobufCMessageDescriptor plcrash__crash_report__thread__stack_frame__descriptor;
 extern const ProtobufCMessageDescriptor plcrash__crash_report__thread__register_value__descriptor;
+extern const ProtobufCMessageDescriptor plcrash__crash_report__thread__frame_symbol__descriptor;
 extern const ProtobufCMessageDescriptor plcrash__crash_report__binary_image__descriptor;
 extern const ProtobufCMessageDescriptor plcrash__crash_report__exception__descriptor;
 extern const ProtobufCMessageDescriptor plcrash__crash_report__signal__descriptor;
@@ -703,6 +802,7 @@ extern const ProtobufCMessageDescriptor plcrash__crash_report__signal__mach_exce
 extern const ProtobufCMessageDescriptor plcrash__crash_report__process_info__descriptor;
 extern const ProtobufCMessageDescriptor plcrash__crash_report__machine_info__descriptor;
 extern const ProtobufCMessageDescriptor plcrash__crash_report__report_info__descriptor;
+extern const ProtobufCMessageDescriptor plcrash__crash_report__string_table_entry__descriptor;
 
 PROTOBUF_C__END_DECLS
 
@@ -0,0 +1,1215 @@
+/* Generated by generate-pb-enc.py.  DO NOT EDIT! */
+/* Generated from: PLCrashReport.proto */
+
+#ifndef PLCRASHREPORT_PB_ENC_H
+#define PLCRASHREPORT_PB_ENC_H
+
+#include "PLCrashLogWriterEncoding.h"
+#include "PLCrashAsync.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Shared encoding primitives. All functions are async-safe, and perform no bounds checking; the caller must reserve
+ * the message's encoded size via plcrash_writer_message_reserve() prior to packing any fields.
+ *
+ * The generated size functions return exact encoded sizes. Varints are packed via plcrash_writer_varint_pack(), which
+ * may overwrite up to PLCRASH_WRITER_VARINT_SLACK bytes beyond the encoded value; plcrash_writer_message_reserve()
+ * accounts for this slack, and it must not be included in the reserved size.
+ */
+
+/** Return the encoded size of @a value as a varint. */
+static inline size_t plcrash_pb_varint_size (uint64_t value) {
+    return plcrash_writer_varint_size(value);
+}
+
+static inline uint32_t plcrash_pb_zigzag32 (int32_t value) {
+    return ((uint32_t) value << 1) ^ (uint32_t) (value >> 31);
+}
+
+static inline uint64_t plcrash_pb_zigzag64 (int64_t value) {
+    return ((uint64_t) value << 1) ^ (uint64_t) (value >> 63);
+}
+
+static inline void plcrash_pb_put_tag (plcrash_writer_message_t *msg, uint32_t tag, size_t tag_size) {
+    for (size_t i = 0; i < tag_size; i++)
+        msg->buffer[msg->length++] = (uint8_t) (tag >> (8 * i));
+}
+
+/** Pack @a value as a varint. Up to PLCRASH_WRITER_VARINT_SLACK bytes following the value may be overwritten. */
+static inline void plcrash_pb_put_varint (plcrash_writer_message_t *msg, uint64_t value) {
+    msg->length += plcrash_writer_varint_pack(value, msg->buffer + msg->length);
+}
+
+static inline void plcrash_pb_put_fixed32 (plcrash_writer_message_t *msg, const void *value) {
+    uint32_t v;
+    plcrash_async_memcpy(&v, value, sizeof(v));
+    for (size_t i = 0; i < sizeof(v); i++)
+        msg->buffer[msg->length++] = (uint8_t) (v >> (8 * i));
+}
+
+static inline void plcrash_pb_put_fixed64 (plcrash_writer_message_t *msg, const void *value) {
+    uint64_t v;
+    plcrash_async_memcpy(&v, value, sizeof(v));
+    for (size_t i = 0; i < sizeof(v); i++)
+        msg->buffer[msg->length++] = (uint8_t) (v >> (8 * i));
+}
+
+/** Return the encoded size of a length-prefixed field @a field_id with a @a len byte body. */
+static inline size_t plcrash_pb_field_size (uint32_t field_id, size_t len) {
+    return plcrash_pb_varint_size((uint64_t) field_id << 3) + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a length-prefixed field @a field_id with a @a len byte body; the body must be packed next. */
+static inline void plcrash_pb_put_field_header (plcrash_writer_message_t *msg, uint32_t field_id, size_t len) {
+    plcrash_pb_put_varint(msg, ((uint64_t) field_id << 3) | 2);
+    plcrash_pb_put_varint(msg, len);
+}
+
+static inline void plcrash_pb_put_bytes (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    if (len > 0)
+        plcrash_async_memcpy(msg->buffer + msg->length, data, len);
+    msg->length += len;
+}
+
+/* --- CrashReport --- */
+
+/** CrashReport.system_info (SystemInfo) */
+#define PLCRASH_PB_CRASH_REPORT__SYSTEM_INFO_NUMBER 1
+/** The encoded tag of CrashReport.system_info, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT__SYSTEM_INFO_TAG 0xAU
+#define PLCRASH_PB_CRASH_REPORT__SYSTEM_INFO_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.system_info field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report__system_info_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT__SYSTEM_INFO_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.system_info field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report__system_info_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT__SYSTEM_INFO_TAG, PLCRASH_PB_CRASH_REPORT__SYSTEM_INFO_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.application_info (ApplicationInfo) */
+#define PLCRASH_PB_CRASH_REPORT__APPLICATION_INFO_NUMBER 2
+/** The encoded tag of CrashReport.application_info, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT__APPLICATION_INFO_TAG 0x12U
+#define PLCRASH_PB_CRASH_REPORT__APPLICATION_INFO_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.application_info field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report__application_info_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT__APPLICATION_INFO_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.application_info field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report__application_info_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT__APPLICATION_INFO_TAG, PLCRASH_PB_CRASH_REPORT__APPLICATION_INFO_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.threads (Thread) */
+#define PLCRASH_PB_CRASH_REPORT__THREADS_NUMBER 3
+/** The encoded tag of CrashReport.threads, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT__THREADS_TAG 0x1AU
+#define PLCRASH_PB_CRASH_REPORT__THREADS_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.threads field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report__threads_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT__THREADS_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.threads field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report__threads_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT__THREADS_TAG, PLCRASH_PB_CRASH_REPORT__THREADS_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.binary_images (BinaryImage) */
+#define PLCRASH_PB_CRASH_REPORT__BINARY_IMAGES_NUMBER 4
+/** The encoded tag of CrashReport.binary_images, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT__BINARY_IMAGES_TAG 0x22U
+#define PLCRASH_PB_CRASH_REPORT__BINARY_IMAGES_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.binary_images field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report__binary_images_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT__BINARY_IMAGES_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.binary_images field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report__binary_images_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT__BINARY_IMAGES_TAG, PLCRASH_PB_CRASH_REPORT__BINARY_IMAGES_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.exception (Exception) */
+#define PLCRASH_PB_CRASH_REPORT__EXCEPTION_NUMBER 5
+/** The encoded tag of CrashReport.exception, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT__EXCEPTION_TAG 0x2AU
+#define PLCRASH_PB_CRASH_REPORT__EXCEPTION_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.exception field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report__exception_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT__EXCEPTION_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.exception field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report__exception_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT__EXCEPTION_TAG, PLCRASH_PB_CRASH_REPORT__EXCEPTION_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.signal (Signal) */
+#define PLCRASH_PB_CRASH_REPORT__SIGNAL_NUMBER 6
+/** The encoded tag of CrashReport.signal, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT__SIGNAL_TAG 0x32U
+#define PLCRASH_PB_CRASH_REPORT__SIGNAL_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.signal field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report__signal_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT__SIGNAL_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.signal field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report__signal_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT__SIGNAL_TAG, PLCRASH_PB_CRASH_REPORT__SIGNAL_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.process_info (ProcessInfo) */
+#define PLCRASH_PB_CRASH_REPORT__PROCESS_INFO_NUMBER 7
+/** The encoded tag of CrashReport.process_info, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT__PROCESS_INFO_TAG 0x3AU
+#define PLCRASH_PB_CRASH_REPORT__PROCESS_INFO_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.process_info field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report__process_info_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT__PROCESS_INFO_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.process_info field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report__process_info_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT__PROCESS_INFO_TAG, PLCRASH_PB_CRASH_REPORT__PROCESS_INFO_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.machine_info (MachineInfo) */
+#define PLCRASH_PB_CRASH_REPORT__MACHINE_INFO_NUMBER 8
+/** The encoded tag of CrashReport.machine_info, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT__MACHINE_INFO_TAG 0x42U
+#define PLCRASH_PB_CRASH_REPORT__MACHINE_INFO_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.machine_info field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report__machine_info_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT__MACHINE_INFO_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.machine_info field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report__machine_info_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT__MACHINE_INFO_TAG, PLCRASH_PB_CRASH_REPORT__MACHINE_INFO_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.report_info (ReportInfo) */
+#define PLCRASH_PB_CRASH_REPORT__REPORT_INFO_NUMBER 9
+/** The encoded tag of CrashReport.report_info, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT__REPORT_INFO_TAG 0x4AU
+#define PLCRASH_PB_CRASH_REPORT__REPORT_INFO_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.report_info field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report__report_info_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT__REPORT_INFO_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.report_info field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report__report_info_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT__REPORT_INFO_TAG, PLCRASH_PB_CRASH_REPORT__REPORT_INFO_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.custom_data (bytes) */
+#define PLCRASH_PB_CRASH_REPORT__CUSTOM_DATA_NUMBER 10
+/** The encoded tag of CrashReport.custom_data, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT__CUSTOM_DATA_TAG 0x52U
+#define PLCRASH_PB_CRASH_REPORT__CUSTOM_DATA_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report__custom_data_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT__CUSTOM_DATA_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report__custom_data_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT__CUSTOM_DATA_TAG, PLCRASH_PB_CRASH_REPORT__CUSTOM_DATA_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.string_table (StringTableEntry) */
+#define PLCRASH_PB_CRASH_REPORT__STRING_TABLE_NUMBER 11
+/** The encoded tag of CrashReport.string_table, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT__STRING_TABLE_TAG 0x5AU
+#define PLCRASH_PB_CRASH_REPORT__STRING_TABLE_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.string_table field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report__string_table_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT__STRING_TABLE_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.string_table field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report__string_table_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT__STRING_TABLE_TAG, PLCRASH_PB_CRASH_REPORT__STRING_TABLE_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/* --- CrashReport.ApplicationInfo --- */
+
+/** CrashReport.ApplicationInfo.identifier (string) */
+#define PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__IDENTIFIER_NUMBER 1
+/** The encoded tag of CrashReport.ApplicationInfo.identifier, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__IDENTIFIER_TAG 0xAU
+#define PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__IDENTIFIER_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_application_info__identifier_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__IDENTIFIER_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_application_info__identifier_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__IDENTIFIER_TAG, PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__IDENTIFIER_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.ApplicationInfo.version (string) */
+#define PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__VERSION_NUMBER 2
+/** The encoded tag of CrashReport.ApplicationInfo.version, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__VERSION_TAG 0x12U
+#define PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__VERSION_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_application_info__version_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__VERSION_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_application_info__version_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__VERSION_TAG, PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__VERSION_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.ApplicationInfo.marketing_version (string) */
+#define PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__MARKETING_VERSION_NUMBER 3
+/** The encoded tag of CrashReport.ApplicationInfo.marketing_version, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__MARKETING_VERSION_TAG 0x1AU
+#define PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__MARKETING_VERSION_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_application_info__marketing_version_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__MARKETING_VERSION_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_application_info__marketing_version_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__MARKETING_VERSION_TAG, PLCRASH_PB_CRASH_REPORT_APPLICATION_INFO__MARKETING_VERSION_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/* --- CrashReport.BinaryImage --- */
+
+/** CrashReport.BinaryImage.base_address (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__BASE_ADDRESS_NUMBER 1
+/** The encoded tag of CrashReport.BinaryImage.base_address, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__BASE_ADDRESS_TAG 0x8U
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__BASE_ADDRESS_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_binary_image__base_address_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__BASE_ADDRESS_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_binary_image__base_address_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__BASE_ADDRESS_TAG, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__BASE_ADDRESS_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.BinaryImage.size (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__SIZE_NUMBER 2
+/** The encoded tag of CrashReport.BinaryImage.size, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__SIZE_TAG 0x10U
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__SIZE_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_binary_image__size_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__SIZE_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_binary_image__size_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__SIZE_TAG, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__SIZE_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.BinaryImage.name (string) */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_NUMBER 3
+/** The encoded tag of CrashReport.BinaryImage.name, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_TAG 0x1AU
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_binary_image__name_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_binary_image__name_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_TAG, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.BinaryImage.uuid (bytes) */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__UUID_NUMBER 4
+/** The encoded tag of CrashReport.BinaryImage.uuid, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__UUID_TAG 0x22U
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__UUID_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_binary_image__uuid_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__UUID_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_binary_image__uuid_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__UUID_TAG, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__UUID_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.BinaryImage.code_type (Processor) */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__CODE_TYPE_NUMBER 5
+/** The encoded tag of CrashReport.BinaryImage.code_type, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__CODE_TYPE_TAG 0x2AU
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__CODE_TYPE_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.BinaryImage.code_type field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report_binary_image__code_type_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__CODE_TYPE_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.BinaryImage.code_type field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report_binary_image__code_type_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__CODE_TYPE_TAG, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__CODE_TYPE_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.BinaryImage.name_ref (uint32) */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_REF_NUMBER 6
+/** The encoded tag of CrashReport.BinaryImage.name_ref, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_REF_TAG 0x30U
+#define PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_REF_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_binary_image__name_ref_size (uint32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_REF_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_binary_image__name_ref_pack (plcrash_writer_message_t *msg, uint32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_REF_TAG, PLCRASH_PB_CRASH_REPORT_BINARY_IMAGE__NAME_REF_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/* --- CrashReport.Exception --- */
+
+/** CrashReport.Exception.name (string) */
+#define PLCRASH_PB_CRASH_REPORT_EXCEPTION__NAME_NUMBER 1
+/** The encoded tag of CrashReport.Exception.name, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_EXCEPTION__NAME_TAG 0xAU
+#define PLCRASH_PB_CRASH_REPORT_EXCEPTION__NAME_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_exception__name_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_EXCEPTION__NAME_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_exception__name_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_EXCEPTION__NAME_TAG, PLCRASH_PB_CRASH_REPORT_EXCEPTION__NAME_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.Exception.reason (string) */
+#define PLCRASH_PB_CRASH_REPORT_EXCEPTION__REASON_NUMBER 2
+/** The encoded tag of CrashReport.Exception.reason, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_EXCEPTION__REASON_TAG 0x12U
+#define PLCRASH_PB_CRASH_REPORT_EXCEPTION__REASON_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_exception__reason_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_EXCEPTION__REASON_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_exception__reason_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_EXCEPTION__REASON_TAG, PLCRASH_PB_CRASH_REPORT_EXCEPTION__REASON_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.Exception.frames (Thread.StackFrame) */
+#define PLCRASH_PB_CRASH_REPORT_EXCEPTION__FRAMES_NUMBER 3
+/** The encoded tag of CrashReport.Exception.frames, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_EXCEPTION__FRAMES_TAG 0x1AU
+#define PLCRASH_PB_CRASH_REPORT_EXCEPTION__FRAMES_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.Exception.frames field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report_exception__frames_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_EXCEPTION__FRAMES_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.Exception.frames field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report_exception__frames_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_EXCEPTION__FRAMES_TAG, PLCRASH_PB_CRASH_REPORT_EXCEPTION__FRAMES_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/* --- CrashReport.MachineInfo --- */
+
+/** CrashReport.MachineInfo.model (string) */
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__MODEL_NUMBER 1
+/** The encoded tag of CrashReport.MachineInfo.model, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__MODEL_TAG 0xAU
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__MODEL_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_machine_info__model_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__MODEL_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_machine_info__model_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__MODEL_TAG, PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__MODEL_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.MachineInfo.processor (Processor) */
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_NUMBER 2
+/** The encoded tag of CrashReport.MachineInfo.processor, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_TAG 0x12U
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.MachineInfo.processor field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report_machine_info__processor_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.MachineInfo.processor field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report_machine_info__processor_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_TAG, PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.MachineInfo.processor_count (uint32) */
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_COUNT_NUMBER 3
+/** The encoded tag of CrashReport.MachineInfo.processor_count, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_COUNT_TAG 0x18U
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_COUNT_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_machine_info__processor_count_size (uint32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_COUNT_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_machine_info__processor_count_pack (plcrash_writer_message_t *msg, uint32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_COUNT_TAG, PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__PROCESSOR_COUNT_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.MachineInfo.logical_processor_count (uint32) */
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__LOGICAL_PROCESSOR_COUNT_NUMBER 4
+/** The encoded tag of CrashReport.MachineInfo.logical_processor_count, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__LOGICAL_PROCESSOR_COUNT_TAG 0x20U
+#define PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__LOGICAL_PROCESSOR_COUNT_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_machine_info__logical_processor_count_size (uint32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__LOGICAL_PROCESSOR_COUNT_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_machine_info__logical_processor_count_pack (plcrash_writer_message_t *msg, uint32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__LOGICAL_PROCESSOR_COUNT_TAG, PLCRASH_PB_CRASH_REPORT_MACHINE_INFO__LOGICAL_PROCESSOR_COUNT_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/* --- CrashReport.ProcessInfo --- */
+
+/** CrashReport.ProcessInfo.process_name (string) */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_NAME_NUMBER 1
+/** The encoded tag of CrashReport.ProcessInfo.process_name, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_NAME_TAG 0xAU
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_NAME_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_process_info__process_name_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_NAME_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_process_info__process_name_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_NAME_TAG, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_NAME_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.ProcessInfo.process_id (uint32) */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_ID_NUMBER 2
+/** The encoded tag of CrashReport.ProcessInfo.process_id, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_ID_TAG 0x10U
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_ID_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_process_info__process_id_size (uint32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_ID_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_process_info__process_id_pack (plcrash_writer_message_t *msg, uint32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_ID_TAG, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_ID_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.ProcessInfo.process_path (string) */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_PATH_NUMBER 3
+/** The encoded tag of CrashReport.ProcessInfo.process_path, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_PATH_TAG 0x1AU
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_PATH_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_process_info__process_path_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_PATH_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_process_info__process_path_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_PATH_TAG, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PROCESS_PATH_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.ProcessInfo.parent_process_name (string) */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_NAME_NUMBER 4
+/** The encoded tag of CrashReport.ProcessInfo.parent_process_name, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_NAME_TAG 0x22U
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_NAME_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_process_info__parent_process_name_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_NAME_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_process_info__parent_process_name_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_NAME_TAG, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_NAME_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.ProcessInfo.parent_process_id (uint32) */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_ID_NUMBER 5
+/** The encoded tag of CrashReport.ProcessInfo.parent_process_id, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_ID_TAG 0x28U
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_ID_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_process_info__parent_process_id_size (uint32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_ID_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_process_info__parent_process_id_pack (plcrash_writer_message_t *msg, uint32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_ID_TAG, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__PARENT_PROCESS_ID_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.ProcessInfo.native (bool) */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__NATIVE_NUMBER 6
+/** The encoded tag of CrashReport.ProcessInfo.native, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__NATIVE_TAG 0x30U
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__NATIVE_TAG_SIZE 1
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__NATIVE_SIZE (PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__NATIVE_TAG_SIZE + 1)
+
+static inline void plcrash_pb_crash_report_process_info__native_pack (plcrash_writer_message_t *msg, bool value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__NATIVE_TAG, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__NATIVE_TAG_SIZE);
+    msg->buffer[msg->length++] = value ? 1 : 0;
+}
+
+/** CrashReport.ProcessInfo.start_time (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__START_TIME_NUMBER 7
+/** The encoded tag of CrashReport.ProcessInfo.start_time, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__START_TIME_TAG 0x38U
+#define PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__START_TIME_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_process_info__start_time_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__START_TIME_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_process_info__start_time_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__START_TIME_TAG, PLCRASH_PB_CRASH_REPORT_PROCESS_INFO__START_TIME_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/* --- CrashReport.Processor --- */
+
+/** CrashReport.Processor.encoding (TypeEncoding) */
+#define PLCRASH_PB_CRASH_REPORT_PROCESSOR__ENCODING_NUMBER 1
+/** The encoded tag of CrashReport.Processor.encoding, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_PROCESSOR__ENCODING_TAG 0x8U
+#define PLCRASH_PB_CRASH_REPORT_PROCESSOR__ENCODING_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_processor__encoding_size (int32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_PROCESSOR__ENCODING_TAG_SIZE + plcrash_pb_varint_size((uint64_t) (int64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_processor__encoding_pack (plcrash_writer_message_t *msg, int32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_PROCESSOR__ENCODING_TAG, PLCRASH_PB_CRASH_REPORT_PROCESSOR__ENCODING_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) (int64_t) value);
+}
+
+/** CrashReport.Processor.type (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_PROCESSOR__TYPE_NUMBER 2
+/** The encoded tag of CrashReport.Processor.type, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_PROCESSOR__TYPE_TAG 0x10U
+#define PLCRASH_PB_CRASH_REPORT_PROCESSOR__TYPE_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_processor__type_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_PROCESSOR__TYPE_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_processor__type_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_PROCESSOR__TYPE_TAG, PLCRASH_PB_CRASH_REPORT_PROCESSOR__TYPE_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.Processor.subtype (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_PROCESSOR__SUBTYPE_NUMBER 3
+/** The encoded tag of CrashReport.Processor.subtype, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_PROCESSOR__SUBTYPE_TAG 0x18U
+#define PLCRASH_PB_CRASH_REPORT_PROCESSOR__SUBTYPE_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_processor__subtype_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_PROCESSOR__SUBTYPE_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_processor__subtype_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_PROCESSOR__SUBTYPE_TAG, PLCRASH_PB_CRASH_REPORT_PROCESSOR__SUBTYPE_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/* --- CrashReport.ReportInfo --- */
+
+/** CrashReport.ReportInfo.user_requested (bool) */
+#define PLCRASH_PB_CRASH_REPORT_REPORT_INFO__USER_REQUESTED_NUMBER 1
+/** The encoded tag of CrashReport.ReportInfo.user_requested, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_REPORT_INFO__USER_REQUESTED_TAG 0x8U
+#define PLCRASH_PB_CRASH_REPORT_REPORT_INFO__USER_REQUESTED_TAG_SIZE 1
+#define PLCRASH_PB_CRASH_REPORT_REPORT_INFO__USER_REQUESTED_SIZE (PLCRASH_PB_CRASH_REPORT_REPORT_INFO__USER_REQUESTED_TAG_SIZE + 1)
+
+static inline void plcrash_pb_crash_report_report_info__user_requested_pack (plcrash_writer_message_t *msg, bool value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_REPORT_INFO__USER_REQUESTED_TAG, PLCRASH_PB_CRASH_REPORT_REPORT_INFO__USER_REQUESTED_TAG_SIZE);
+    msg->buffer[msg->length++] = value ? 1 : 0;
+}
+
+/** CrashReport.ReportInfo.uuid (bytes) */
+#define PLCRASH_PB_CRASH_REPORT_REPORT_INFO__UUID_NUMBER 2
+/** The encoded tag of CrashReport.ReportInfo.uuid, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_REPORT_INFO__UUID_TAG 0x12U
+#define PLCRASH_PB_CRASH_REPORT_REPORT_INFO__UUID_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_report_info__uuid_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_REPORT_INFO__UUID_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_report_info__uuid_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_REPORT_INFO__UUID_TAG, PLCRASH_PB_CRASH_REPORT_REPORT_INFO__UUID_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/* --- CrashReport.Signal --- */
+
+/** CrashReport.Signal.name (string) */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__NAME_NUMBER 1
+/** The encoded tag of CrashReport.Signal.name, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__NAME_TAG 0xAU
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__NAME_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_signal__name_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_SIGNAL__NAME_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_signal__name_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SIGNAL__NAME_TAG, PLCRASH_PB_CRASH_REPORT_SIGNAL__NAME_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.Signal.code (string) */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__CODE_NUMBER 2
+/** The encoded tag of CrashReport.Signal.code, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__CODE_TAG 0x12U
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__CODE_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_signal__code_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_SIGNAL__CODE_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_signal__code_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SIGNAL__CODE_TAG, PLCRASH_PB_CRASH_REPORT_SIGNAL__CODE_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.Signal.address (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__ADDRESS_NUMBER 3
+/** The encoded tag of CrashReport.Signal.address, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__ADDRESS_TAG 0x18U
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__ADDRESS_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_signal__address_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_SIGNAL__ADDRESS_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_signal__address_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SIGNAL__ADDRESS_TAG, PLCRASH_PB_CRASH_REPORT_SIGNAL__ADDRESS_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.Signal.mach_exception (MachException) */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__MACH_EXCEPTION_NUMBER 4
+/** The encoded tag of CrashReport.Signal.mach_exception, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__MACH_EXCEPTION_TAG 0x22U
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL__MACH_EXCEPTION_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.Signal.mach_exception field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report_signal__mach_exception_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_SIGNAL__MACH_EXCEPTION_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.Signal.mach_exception field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report_signal__mach_exception_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SIGNAL__MACH_EXCEPTION_TAG, PLCRASH_PB_CRASH_REPORT_SIGNAL__MACH_EXCEPTION_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/* --- CrashReport.StringTableEntry --- */
+
+/** CrashReport.StringTableEntry.prefix (uint32) */
+#define PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__PREFIX_NUMBER 1
+/** The encoded tag of CrashReport.StringTableEntry.prefix, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__PREFIX_TAG 0x8U
+#define PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__PREFIX_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_string_table_entry__prefix_size (uint32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__PREFIX_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_string_table_entry__prefix_pack (plcrash_writer_message_t *msg, uint32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__PREFIX_TAG, PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__PREFIX_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.StringTableEntry.suffix (string) */
+#define PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__SUFFIX_NUMBER 2
+/** The encoded tag of CrashReport.StringTableEntry.suffix, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__SUFFIX_TAG 0x12U
+#define PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__SUFFIX_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_string_table_entry__suffix_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__SUFFIX_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_string_table_entry__suffix_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__SUFFIX_TAG, PLCRASH_PB_CRASH_REPORT_STRING_TABLE_ENTRY__SUFFIX_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/* --- CrashReport.Symbol --- */
+
+/** CrashReport.Symbol.name (string) */
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_NUMBER 1
+/** The encoded tag of CrashReport.Symbol.name, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_TAG 0xAU
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_symbol__name_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_symbol__name_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_TAG, PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.Symbol.start_address (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__START_ADDRESS_NUMBER 2
+/** The encoded tag of CrashReport.Symbol.start_address, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__START_ADDRESS_TAG 0x10U
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__START_ADDRESS_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_symbol__start_address_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_SYMBOL__START_ADDRESS_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_symbol__start_address_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SYMBOL__START_ADDRESS_TAG, PLCRASH_PB_CRASH_REPORT_SYMBOL__START_ADDRESS_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.Symbol.end_address (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__END_ADDRESS_NUMBER 3
+/** The encoded tag of CrashReport.Symbol.end_address, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__END_ADDRESS_TAG 0x18U
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__END_ADDRESS_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_symbol__end_address_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_SYMBOL__END_ADDRESS_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_symbol__end_address_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SYMBOL__END_ADDRESS_TAG, PLCRASH_PB_CRASH_REPORT_SYMBOL__END_ADDRESS_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.Symbol.name_ref (uint32) */
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_REF_NUMBER 4
+/** The encoded tag of CrashReport.Symbol.name_ref, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_REF_TAG 0x20U
+#define PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_REF_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_symbol__name_ref_size (uint32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_REF_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_symbol__name_ref_pack (plcrash_writer_message_t *msg, uint32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_REF_TAG, PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_REF_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/* --- CrashReport.SystemInfo --- */
+
+/** CrashReport.SystemInfo.operating_system (OperatingSystem) */
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OPERATING_SYSTEM_NUMBER 1
+/** The encoded tag of CrashReport.SystemInfo.operating_system, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OPERATING_SYSTEM_TAG 0x8U
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OPERATING_SYSTEM_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_system_info__operating_system_size (int32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OPERATING_SYSTEM_TAG_SIZE + plcrash_pb_varint_size((uint64_t) (int64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_system_info__operating_system_pack (plcrash_writer_message_t *msg, int32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OPERATING_SYSTEM_TAG, PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OPERATING_SYSTEM_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) (int64_t) value);
+}
+
+/** CrashReport.SystemInfo.os_version (string) */
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_VERSION_NUMBER 2
+/** The encoded tag of CrashReport.SystemInfo.os_version, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_VERSION_TAG 0x12U
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_VERSION_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_system_info__os_version_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_VERSION_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_system_info__os_version_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_VERSION_TAG, PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_VERSION_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.SystemInfo.architecture (Architecture) */
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__ARCHITECTURE_NUMBER 3
+/** The encoded tag of CrashReport.SystemInfo.architecture, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__ARCHITECTURE_TAG 0x18U
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__ARCHITECTURE_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_system_info__architecture_size (int32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__ARCHITECTURE_TAG_SIZE + plcrash_pb_varint_size((uint64_t) (int64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_system_info__architecture_pack (plcrash_writer_message_t *msg, int32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__ARCHITECTURE_TAG, PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__ARCHITECTURE_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) (int64_t) value);
+}
+
+/** CrashReport.SystemInfo.timestamp (int64) */
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__TIMESTAMP_NUMBER 4
+/** The encoded tag of CrashReport.SystemInfo.timestamp, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__TIMESTAMP_TAG 0x20U
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__TIMESTAMP_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_system_info__timestamp_size (int64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__TIMESTAMP_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_system_info__timestamp_pack (plcrash_writer_message_t *msg, int64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__TIMESTAMP_TAG, PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__TIMESTAMP_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.SystemInfo.os_build (string) */
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_BUILD_NUMBER 5
+/** The encoded tag of CrashReport.SystemInfo.os_build, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_BUILD_TAG 0x2AU
+#define PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_BUILD_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_system_info__os_build_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_BUILD_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_system_info__os_build_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_BUILD_TAG, PLCRASH_PB_CRASH_REPORT_SYSTEM_INFO__OS_BUILD_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/* --- CrashReport.Thread --- */
+
+/** CrashReport.Thread.thread_number (uint32) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__THREAD_NUMBER_NUMBER 1
+/** The encoded tag of CrashReport.Thread.thread_number, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__THREAD_NUMBER_TAG 0x8U
+#define PLCRASH_PB_CRASH_REPORT_THREAD__THREAD_NUMBER_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_thread__thread_number_size (uint32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD__THREAD_NUMBER_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_thread__thread_number_pack (plcrash_writer_message_t *msg, uint32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD__THREAD_NUMBER_TAG, PLCRASH_PB_CRASH_REPORT_THREAD__THREAD_NUMBER_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.Thread.frames (StackFrame) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__FRAMES_NUMBER 2
+/** The encoded tag of CrashReport.Thread.frames, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__FRAMES_TAG 0x12U
+#define PLCRASH_PB_CRASH_REPORT_THREAD__FRAMES_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.Thread.frames field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report_thread__frames_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD__FRAMES_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.Thread.frames field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report_thread__frames_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD__FRAMES_TAG, PLCRASH_PB_CRASH_REPORT_THREAD__FRAMES_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.Thread.crashed (bool) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__CRASHED_NUMBER 3
+/** The encoded tag of CrashReport.Thread.crashed, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__CRASHED_TAG 0x18U
+#define PLCRASH_PB_CRASH_REPORT_THREAD__CRASHED_TAG_SIZE 1
+#define PLCRASH_PB_CRASH_REPORT_THREAD__CRASHED_SIZE (PLCRASH_PB_CRASH_REPORT_THREAD__CRASHED_TAG_SIZE + 1)
+
+static inline void plcrash_pb_crash_report_thread__crashed_pack (plcrash_writer_message_t *msg, bool value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD__CRASHED_TAG, PLCRASH_PB_CRASH_REPORT_THREAD__CRASHED_TAG_SIZE);
+    msg->buffer[msg->length++] = value ? 1 : 0;
+}
+
+/** CrashReport.Thread.registers (RegisterValue) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__REGISTERS_NUMBER 4
+/** The encoded tag of CrashReport.Thread.registers, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__REGISTERS_TAG 0x22U
+#define PLCRASH_PB_CRASH_REPORT_THREAD__REGISTERS_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.Thread.registers field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report_thread__registers_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD__REGISTERS_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.Thread.registers field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report_thread__registers_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD__REGISTERS_TAG, PLCRASH_PB_CRASH_REPORT_THREAD__REGISTERS_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.Thread.packed_frames (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__PACKED_FRAMES_NUMBER 5
+/** The encoded tag of CrashReport.Thread.packed_frames, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__PACKED_FRAMES_TAG 0x2AU
+#define PLCRASH_PB_CRASH_REPORT_THREAD__PACKED_FRAMES_TAG_SIZE 1
+
+/** Return the encoded size of a packed CrashReport.Thread.packed_frames field with a @a len byte body. */
+static inline size_t plcrash_pb_crash_report_thread__packed_frames_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD__PACKED_FRAMES_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a packed CrashReport.Thread.packed_frames chunk, followed by @a len bytes of plcrash_pb_put_varint() elements. */
+static inline void plcrash_pb_crash_report_thread__packed_frames_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD__PACKED_FRAMES_TAG, PLCRASH_PB_CRASH_REPORT_THREAD__PACKED_FRAMES_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/** CrashReport.Thread.frame_symbols (FrameSymbol) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__FRAME_SYMBOLS_NUMBER 6
+/** The encoded tag of CrashReport.Thread.frame_symbols, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD__FRAME_SYMBOLS_TAG 0x32U
+#define PLCRASH_PB_CRASH_REPORT_THREAD__FRAME_SYMBOLS_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.Thread.frame_symbols field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report_thread__frame_symbols_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD__FRAME_SYMBOLS_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.Thread.frame_symbols field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report_thread__frame_symbols_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD__FRAME_SYMBOLS_TAG, PLCRASH_PB_CRASH_REPORT_THREAD__FRAME_SYMBOLS_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+/* --- CrashReport.Signal.MachException --- */
+
+/** CrashReport.Signal.MachException.type (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__TYPE_NUMBER 1
+/** The encoded tag of CrashReport.Signal.MachException.type, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__TYPE_TAG 0x8U
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__TYPE_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_signal_mach_exception__type_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__TYPE_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_signal_mach_exception__type_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__TYPE_TAG, PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__TYPE_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.Signal.MachException.codes (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__CODES_NUMBER 2
+/** The encoded tag of CrashReport.Signal.MachException.codes, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__CODES_TAG 0x10U
+#define PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__CODES_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_signal_mach_exception__codes_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__CODES_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_signal_mach_exception__codes_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__CODES_TAG, PLCRASH_PB_CRASH_REPORT_SIGNAL_MACH_EXCEPTION__CODES_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/* --- CrashReport.Thread.FrameSymbol --- */
+
+/** CrashReport.Thread.FrameSymbol.frame (uint32) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__FRAME_NUMBER 1
+/** The encoded tag of CrashReport.Thread.FrameSymbol.frame, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__FRAME_TAG 0x8U
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__FRAME_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_thread_frame_symbol__frame_size (uint32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__FRAME_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_thread_frame_symbol__frame_pack (plcrash_writer_message_t *msg, uint32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__FRAME_TAG, PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__FRAME_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.Thread.FrameSymbol.name (string) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_NUMBER 2
+/** The encoded tag of CrashReport.Thread.FrameSymbol.name, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_TAG 0x12U
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_thread_frame_symbol__name_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_thread_frame_symbol__name_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_TAG, PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.Thread.FrameSymbol.start_offset (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__START_OFFSET_NUMBER 3
+/** The encoded tag of CrashReport.Thread.FrameSymbol.start_offset, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__START_OFFSET_TAG 0x18U
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__START_OFFSET_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_thread_frame_symbol__start_offset_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__START_OFFSET_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_thread_frame_symbol__start_offset_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__START_OFFSET_TAG, PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__START_OFFSET_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.Thread.FrameSymbol.name_ref (uint32) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_REF_NUMBER 4
+/** The encoded tag of CrashReport.Thread.FrameSymbol.name_ref, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_REF_TAG 0x20U
+#define PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_REF_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_thread_frame_symbol__name_ref_size (uint32_t value) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_REF_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_thread_frame_symbol__name_ref_pack (plcrash_writer_message_t *msg, uint32_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_REF_TAG, PLCRASH_PB_CRASH_REPORT_THREAD_FRAME_SYMBOL__NAME_REF_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/* --- CrashReport.Thread.RegisterValue --- */
+
+/** CrashReport.Thread.RegisterValue.name (string) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__NAME_NUMBER 1
+/** The encoded tag of CrashReport.Thread.RegisterValue.name, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__NAME_TAG 0xAU
+#define PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__NAME_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_thread_register_value__name_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__NAME_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+static inline void plcrash_pb_crash_report_thread_register_value__name_pack (plcrash_writer_message_t *msg, const void *data, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__NAME_TAG, PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__NAME_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+    plcrash_pb_put_bytes(msg, data, len);
+}
+
+/** CrashReport.Thread.RegisterValue.value (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__VALUE_NUMBER 2
+/** The encoded tag of CrashReport.Thread.RegisterValue.value, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__VALUE_TAG 0x10U
+#define PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__VALUE_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_thread_register_value__value_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__VALUE_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_thread_register_value__value_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__VALUE_TAG, PLCRASH_PB_CRASH_REPORT_THREAD_REGISTER_VALUE__VALUE_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/* --- CrashReport.Thread.StackFrame --- */
+
+/** CrashReport.Thread.StackFrame.pc (uint64) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__PC_NUMBER 3
+/** The encoded tag of CrashReport.Thread.StackFrame.pc, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__PC_TAG 0x18U
+#define PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__PC_TAG_SIZE 1
+
+static inline size_t plcrash_pb_crash_report_thread_stack_frame__pc_size (uint64_t value) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__PC_TAG_SIZE + plcrash_pb_varint_size((uint64_t) value);
+}
+
+static inline void plcrash_pb_crash_report_thread_stack_frame__pc_pack (plcrash_writer_message_t *msg, uint64_t value) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__PC_TAG, PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__PC_TAG_SIZE);
+    plcrash_pb_put_varint(msg, (uint64_t) value);
+}
+
+/** CrashReport.Thread.StackFrame.symbol (Symbol) */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__SYMBOL_NUMBER 6
+/** The encoded tag of CrashReport.Thread.StackFrame.symbol, in little-endian byte order. */
+#define PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__SYMBOL_TAG 0x32U
+#define PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__SYMBOL_TAG_SIZE 1
+
+/** Return the encoded size of a CrashReport.Thread.StackFrame.symbol field with a @a len byte message body. */
+static inline size_t plcrash_pb_crash_report_thread_stack_frame__symbol_size (size_t len) {
+    return PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__SYMBOL_TAG_SIZE + plcrash_pb_varint_size(len) + len;
+}
+
+/** Pack the header of a CrashReport.Thread.StackFrame.symbol field with a @a len byte message body; the body must be packed next. */
+static inline void plcrash_pb_crash_report_thread_stack_frame__symbol_pack_header (plcrash_writer_message_t *msg, size_t len) {
+    plcrash_pb_put_tag(msg, PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__SYMBOL_TAG, PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__SYMBOL_TAG_SIZE);
+    plcrash_pb_put_varint(msg, len);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLCRASHREPORT_PB_ENC_H */
@@ -95,6 +95,12 @@ typedef struct signal_handler_ctx {
     /** Maximum number of bytes that will be written to the crash report.  */
     NSUInteger max_report_size;
 
+    /** Preallocated crash-time output buffer, or NULL if the default plcrash_async_file_t buffer should be used. */
+    void *output_buffer;
+
+    /** Size of @a output_buffer, in bytes. */
+    size_t output_buffer_size;
+
 #if PLCRASH_FEATURE_MACH_EXCEPTIONS
     /* Previously registered Mach exception ports, if any. Will be left uninitialized if PLCrashReporterSignalHandlerTypeMach
      * is not enabled. */
@@ -152,6 +158,7 @@ static plcrash_error_t plcrash_write_report (plcrashreporter_handler_ctx_t *sigc
     
     /* Initialize the output context */
     plcrash_async_file_init(&file, fd, sigctx->max_report_size);
+    plcrash_async_file_set_buffer(&file, sigctx->output_buffer, sigctx->output_buffer_size);
 
     /* Write the crash log using the already-initialized writer */
     err = plcrash_log_writer_write(&sigctx->writer, crashed_thread, &shared_image_list, &file, siginfo, thread_state);
@@ -310,13 +317,67 @@ static kern_return_t mach_exception_callback (task_t task, thread_t thread, exce
 }
 #endif /* PLCRASH_FEATURE_MACH_EXCEPTIONS */
 
+/**
+ * @internal
+ *
+ * If true, images reported by dyld are recorded via plcrash_nasync_image_list_append_deferred(), rather than being
+ * loaded immediately. This avoids parsing every loaded image on the thread that registers the dyld callbacks; deferred
+ * images are loaded once the crash reporter is enabled. Set only if the configuration of the reporter instance that
+ * registers the callbacks enables PLCrashReporterConfig::loadImagesInBackground.
+ */
+static atomic_bool image_add_deferred = false;
+
+/**
+ * @internal
+ *
+ * If true, deferred images are loaded on a background queue as they are registered.
+ */
+static atomic_bool image_load_background = false;
+
+/**
+ * @internal
+ *
+ * Set while a background load of deferred images is pending.
+ */
+static atomic_flag image_load_scheduled = ATOMIC_FLAG_INIT;
+
+/**
+ * @internal
+ *
+ * Dispatch group tracking background loads of deferred images.
+ */
+static dispatch_group_t image_load_group = NULL;
+
+/**
+ * @internal
+ *
+ * Schedule a background load of any deferred images in the shared image list.
+ */
+static void image_load_deferred_async (void) {
+    if (atomic_flag_test_and_set(&image_load_scheduled))
+        return;
+
+    dispatch_group_async(image_load_group, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        atomic_flag_clear(&image_load_scheduled);
+        plcrash_nasync_image_list_load_deferred(&shared_image_list);
+    });
+}
+
 /**
  * @internal
  * dyld image add notification callback.
  */
 static void image_add_callback (const struct mach_header *mh, intptr_t vmaddr_slide) {
     Dl_info info;
-    
+
+    /* Record the image; its name and Mach-O data will be loaded later */
+    if (atomic_load(&image_add_deferred)) {
+        plcrash_nasync_image_list_append_deferred(&shared_image_list, (pl_vm_address_t) mh, vmaddr_slide, NULL);
+        if (atomic_load(&image_load_background))
+            image_load_deferred_async();
+        return;
+    }
+
     /* Look up the image info */
     if (dladdr(mh, &info) == 0) {
         PLCR_LOG("%s: dladdr(%p, ...) failed", __FUNCTION__, mh);
@@ -335,6 +396,24 @@ static void image_remove_callback (const struct mach_header *mh, intptr_t vmaddr
     plcrash_nasync_image_list_remove(&shared_image_list, (uintptr_t) mh);
 }
 
+/**
+ * @internal
+ *
+ * Register the dyld image callbacks, if they have not already been registered. dyld invokes the add callback for
+ * every loaded image during registration.
+ *
+ * @param deferred If true, images are only recorded at registration, and their Mach-O data is loaded once the
+ * crash reporter is enabled. Otherwise, images are loaded as they are registered.
+ */
+static void image_callbacks_register (bool deferred) {
+    static dispatch_once_t onceLock;
+    dispatch_once(&onceLock, ^{
+        atomic_store(&image_add_deferred, deferred);
+        _dyld_register_func_for_add_image(image_add_callback);
+        _dyld_register_func_for_remove_image(image_remove_callback);
+    });
+}
+
 
 /**
  * @internal
@@ -379,6 +458,9 @@ static void uncaught_exception_handler (NSException *exception) {
 - (NSString *) crashReportDirectory;
 - (NSString *) queuedCrashReportDirectory;
 
++ (void) resetSharedImageList;
++ (void) registerLoadedImagesWithDeferredLoading: (BOOL) deferred;
+
 @end
 
 
@@ -421,13 +503,48 @@ static void uncaught_exception_handler (NSException *exception) {
     if (![[self class] isEqual: [PLCrashReporter class]])
         return;
 
-    /* Enable dyld image monitoring */
+    /* Initialize the shared image list; dyld image monitoring is enabled by the first reporter instance, once its
+     * configuration is known. */
     plcrash_nasync_image_list_init(&shared_image_list, mach_task_self());
-    _dyld_register_func_for_add_image(image_add_callback);
-    _dyld_register_func_for_remove_image(image_remove_callback);
+    image_load_group = dispatch_group_create();
 }
 
 
+/**
+ * @internal
+ *
+ * Discard all images in the shared image list, waiting for any pending background load to complete. This is used
+ * by the tests to reproduce the state of the image list prior to registration of the dyld callbacks.
+ *
+ * @warning Images added by dyld while the list is reset may be lost.
+ */
++ (void) resetSharedImageList {
+    /* Ensure that the callbacks are registered, so that registration by a reporter instance does not re-populate the
+     * list */
+    image_callbacks_register(false);
+
+    dispatch_group_wait(image_load_group, DISPATCH_TIME_FOREVER);
+
+    plcrash_nasync_image_list_free(&shared_image_list);
+    plcrash_nasync_image_list_init(&shared_image_list, mach_task_self());
+    atomic_store(&image_load_background, false);
+}
+
+/**
+ * @internal
+ *
+ * Register all loaded images with the shared image list via the dyld image add callback, as occurs when the
+ * callbacks are first registered. This is used by the tests, following a call to
+ * PLCrashReporter::resetSharedImageList, to measure reporter startup.
+ *
+ * @param deferred If YES, images are only recorded, and are loaded once a reporter is enabled.
+ */
++ (void) registerLoadedImagesWithDeferredLoading: (BOOL) deferred {
+    atomic_store(&image_add_deferred, deferred);
+    for (uint32_t i = 0; i < _dyld_image_count(); i++)
+        image_add_callback(_dyld_get_image_header(i), _dyld_get_image_vmaddr_slide(i));
+}
+
 /* (Deprecated) Crash reporter singleton. */
 static PLCrashReporter *sharedReporter = nil;
 
@@ -599,6 +716,53 @@ static PLCrashReporter *sharedReporter = nil;
     assert(_applicationIdentifier != nil);
     assert(_applicationVersion != nil);
     plcrash_log_writer_init(&signal_handler_context.writer, _applicationIdentifier, _applicationVersion, _applicationMarketingVersion, [self mapToAsyncSymbolicationStrategy: _config.symbolicationStrategy], false);
+    plcrash_log_writer_set_packed_frames(&signal_handler_context.writer, _config.usePackedStackFrames);
+    plcrash_log_writer_set_string_table(&signal_handler_context.writer, _config.useReportStringTable);
+
+    /* Index image symbol tables, and unwind tables if requested, ahead of time, allowing crash-time lookups to use a binary search */
+    {
+        uint32_t index_flags = 0;
+        if (_config.indexUnwindTables) {
+#if PLCRASH_FEATURE_UNWIND_DWARF
+            index_flags |= PLCRASH_ASYNC_IMAGE_INDEX_DWARF_UNWIND;
+#endif
+#if PLCRASH_FEATURE_UNWIND_COMPACT && PLCRASH_FEATURE_UNWIND_DWARF
+            index_flags |= PLCRASH_ASYNC_IMAGE_INDEX_COMPACT_UNWIND;
+#endif
+        }
+        if (_config.symbolicationStrategy & PLCrashReporterSymbolicationStrategySymbolTable)
+            index_flags |= PLCRASH_ASYNC_IMAGE_INDEX_SYMBOLS;
+
+        plcrash_nasync_image_list_set_indexing(&shared_image_list, index_flags);
+    }
+
+    /* Load any images recorded for deferred loading; these are only present if background loading was requested
+     * by the reporter instance that registered the dyld callbacks. */
+    if (_config.loadImagesInBackground) {
+        atomic_store(&image_load_background, true);
+        image_load_deferred_async();
+    } else {
+        atomic_store(&image_add_deferred, false);
+        plcrash_nasync_image_list_load_deferred(&shared_image_list);
+    }
+
+    /* Preallocate the crash-time output buffer. This is allocated directly from the VM system, as the heap may be
+     * corrupt by the time the buffer is used. */
+    if (_config.reportOutputBufferSize > 0) {
+        vm_address_t addr = 0;
+        vm_size_t size = round_page(_config.reportOutputBufferSize);
+        kern_return_t kr = vm_allocate(mach_task_self(), &addr, size, VM_FLAGS_ANYWHERE);
+        if (kr == KERN_SUCCESS) {
+            signal_handler_context.output_buffer = (void *) addr;
+            signal_handler_context.output_buffer_size = size;
+        } else {
+            PLCR_LOG("Failed to allocate a %lu byte report output buffer: %d; using the default buffer", (unsigned long) size, kr);
+        }
+    }
+
+    /* Likewise, preallocate the crash-time symbol, unwind plan, and page caches; these are reset for each report */
+    if (plcrash_log_writer_preallocate_caches(&signal_handler_context.writer) != PLCRASH_ESUCCESS)
+        PLCR_LOG("Failed to preallocate the report caches; caches will be allocated at crash time");
 
     /* Set custom data, if already set before enabling */
     if (self.customData != nil) {
@@ -724,29 +888,21 @@ static plcrash_error_t plcr_live_report_callback (plcrash_async_thread_state_t *
  * error information will be provided.
  *
  * @return Returns nil if the crash report data could not be loaded.
- *
- * @todo Implement in-memory, rather than requiring writing of the report to disk.
  */
 - (NSData *) generateLiveReportWithThread: (thread_t) thread exception: (NSException *) exception error: (NSError **) outError {
     plcrash_log_writer_t writer;
     plcrash_async_file_t file;
     plcrash_error_t err;
 
-    /* Open the output file */
-    NSString *templateStr = [NSTemporaryDirectory() stringByAppendingPathComponent: @"live_crash_report.XXXXXX"];
-    char *path = strdup([templateStr fileSystemRepresentation]);
-    
-    int fd = mkstemp(path);
-    if (fd < 0) {
-        plcrash_populate_posix_error(outError, errno, NSLocalizedString(@"Failed to create temporary path", @"Error opening temporary output path"));
-        free(path);
-
-        return nil;
-    }
+    /* Load any images that have been registered, but not yet loaded */
+    plcrash_nasync_image_list_load_deferred(&shared_image_list);
 
     /* Initialize the output context */
     plcrash_log_writer_init(&writer, _applicationIdentifier, _applicationVersion, _applicationMarketingVersion, [self mapToAsyncSymbolicationStrategy: _config.symbolicationStrategy], true);
-    plcrash_async_file_init(&file, fd, _config.maxReportBytes);
+    plcrash_async_file_init_memory(&file, _config.maxReportBytes);
+    plcrash_log_writer_set_unwind_workers(&writer, (uint32_t) MIN(_config.liveReportUnwindWorkers, UINT32_MAX));
+    plcrash_log_writer_set_packed_frames(&writer, _config.usePackedStackFrames);
+    plcrash_log_writer_set_string_table(&writer, _config.useReportStringTable);
 
     /* Set custom data, if already set before enabling */
     if (self.customData != nil) {
@@ -781,36 +937,26 @@ static plcrash_error_t plcr_live_report_callback (plcrash_async_thread_state_t *
 
     /* Flush the data */
     plcrash_async_file_flush(&file);
-    plcrash_async_file_close(&file);
 
     /* Check for write failure */
     NSData *data;
     if (err != PLCRASH_ESUCCESS) {
         PLCR_LOG("Write failed with error %s", plcrash_async_strerror(err));
-        plcrash_populate_error(outError, PLCrashReporterErrorUnknown, @"Failed to write the crash report to disk", nil);
+        plcrash_populate_error(outError, PLCrashReporterErrorUnknown, @"Failed to write the crash report", nil);
         data = nil;
         goto cleanup;
     }
 
-    data = [NSData dataWithContentsOfFile:[NSString stringWithUTF8String: path]
-                                  options:NSDataReadingMappedAlways | NSDataReadingUncached
-                                    error:outError];
-    if (data == nil) {
-        /* This should only happen if our data is deleted out from under us */
-        plcrash_populate_error(outError, PLCrashReporterErrorUnknown, NSLocalizedString(@"Unable to open live crash report for reading", nil), nil);
-        goto cleanup;
-    }
+    /* Copy out the report prior to releasing the in-memory output */
+    size_t length;
+    const void *bytes = plcrash_async_file_memory_bytes(&file, &length);
+    data = [NSData dataWithBytes: bytes length: length];
 
 cleanup:
     /* Finished -- clean up. */
+    plcrash_async_file_close(&file);
     plcrash_log_writer_free(&writer);
 
-    if (unlink(path) != 0) {
-        /* This shouldn't fail, but if it does, there's no use in returning nil */
-        PLCR_LOG("Failure occured deleting live crash report: %s", strerror(errno));
-    }
-
-    free(path);
     return data;
 }
 
@@ -932,6 +1078,11 @@ cleanup:
         basePath = [paths objectAtIndex: 0];
     }
     _crashReportDirectory = [[basePath stringByAppendingPathComponent: PLCRASH_CACHE_DIR] stringByAppendingPathComponent: appIdPath];
+
+    /* Enable dyld image monitoring. Unless background loading was requested, the Mach-O data of every loaded
+     * image is parsed here, as it is registered. */
+    image_callbacks_register(_config.loadImagesInBackground);
+
     return self;
 }
 
@@ -174,6 +174,18 @@ typedef NS_OPTIONS(NSUInteger, PLCrashReporterSymbolicationStrategy) {
                                   basePath: (NSString *) basePath
                             maxReportBytes: (NSUInteger) maxReportByte;
 
+- (instancetype) initWithSignalHandlerType: (PLCrashReporterSignalHandlerType) signalHandlerType
+                     symbolicationStrategy: (PLCrashReporterSymbolicationStrategy) symbolicationStrategy
+    shouldRegisterUncaughtExceptionHandler: (BOOL) shouldRegisterUncaughtExceptionHandler
+                                  basePath: (NSString *) basePath
+                            maxReportBytes: (NSUInteger) maxReportBytes
+                   liveReportUnwindWorkers: (NSUInteger) liveReportUnwindWorkers
+                    reportOutputBufferSize: (NSUInteger) reportOutputBufferSize
+                    loadImagesInBackground: (BOOL) loadImagesInBackground
+                      usePackedStackFrames: (BOOL) usePackedStackFrames
+                      useReportStringTable: (BOOL) useReportStringTable
+                         indexUnwindTables: (BOOL) indexUnwindTables;
+
 /** The base path to save the crash data. */
 @property(nonatomic, readonly) NSString *basePath;
 
@@ -189,5 +201,64 @@ typedef NS_OPTIONS(NSUInteger, PLCrashReporterSymbolicationStrategy) {
 /** Maximum number of bytes that will be written to the crash report */
 @property(nonatomic, readonly) NSUInteger maxReportBytes;
 
+/**
+ * The number of additional worker threads used to unwind and symbolicate threads when generating a live report.
+ * If 0 (the default), threads are unwound serially. This has no effect on reports generated at crash time.
+ *
+ * When non-zero, the target threads are resumed as soon as their stacks have been walked, rather than remaining
+ * suspended until the entire report has been symbolicated and written.
+ */
+@property(nonatomic, readonly) NSUInteger liveReportUnwindWorkers;
+
+/**
+ * The size, in bytes, of the output buffer used when writing a crash report at crash time. The buffer is
+ * allocated when the crash reporter is enabled. Larger buffers reduce the number of write operations performed
+ * while the process is crashing.
+ *
+ * If 0 (the default), a small built-in buffer is used.
+ */
+@property(nonatomic, readonly) NSUInteger reportOutputBufferSize;
+
+/**
+ * If YES, the images loaded in the process are only recorded when the first PLCrashReporter instance is initialized,
+ * and their Mach-O data is parsed on a background queue once the crash reporter is enabled. Images that have not yet
+ * been parsed when a crash occurs will be absent from the crash report.
+ *
+ * If NO, Mach-O data is parsed synchronously as images are registered by the first PLCrashReporter instance. As
+ * image registration occurs only once per process, the configuration of the first instance determines whether
+ * parsing is deferred.
+ *
+ * The default is NO.
+ */
+@property(nonatomic, readonly) BOOL loadImagesInBackground;
+
+/**
+ * If YES, stack frames are written as packed, image-relative offsets (report format v2), reducing the size of
+ * the report and the time spent writing it. Reports written in this format can only be decoded by versions of
+ * PLCrashReport that support #PLCRASH_REPORT_FILE_VERSION_2.
+ *
+ * The default is NO.
+ */
+@property(nonatomic, readonly) BOOL usePackedStackFrames;
+
+/**
+ * If YES, binary image paths and symbol names are interned in a string table written at the end of the report
+ * (report format v2). Image paths sharing a directory prefix are stored once, and repeated symbol names are
+ * written only once, reducing the size of the report. Reports written in this format can only be decoded by versions
+ * of PLCrashReport that support #PLCRASH_REPORT_FILE_VERSION_2.
+ *
+ * The default is NO.
+ */
+@property(nonatomic, readonly) BOOL useReportStringTable;
+
+/**
+ * If YES, a sorted lookup table of each image's DWARF and compact unwind entries is built when the image is loaded,
+ * allowing unwind data to be located via a binary search at crash time. Building the tables requires scanning the
+ * unwind sections of every loaded image, increasing the time and memory required to register images.
+ *
+ * The default is NO.
+ */
+@property(nonatomic, readonly) BOOL indexUnwindTables;
+
 @end
 
@@ -70,12 +70,36 @@
      * If not provided, the default value will be MAX_REPORT_BYTES (1MB).
      */
     NSUInteger _maxReportBytes;
+
+    /** The number of additional worker threads used to unwind and symbolicate threads when generating a live report. */
+    NSUInteger _liveReportUnwindWorkers;
+
+    /** The size, in bytes, of the crash-time output buffer, or 0 to use the built-in buffer. */
+    NSUInteger _reportOutputBufferSize;
+
+    /** If YES, image Mach-O data is parsed on a background queue. */
+    BOOL _loadImagesInBackground;
+
+    /** If YES, stack frames are written as packed, image-relative offsets. */
+    BOOL _usePackedStackFrames;
+
+    /** If YES, image paths and symbol names are interned in a report string table. */
+    BOOL _useReportStringTable;
+
+    /** If YES, image unwind tables are indexed when images are loaded. */
+    BOOL _indexUnwindTables;
 }
 
 @synthesize signalHandlerType = _signalHandlerType;
 @synthesize symbolicationStrategy = _symbolicationStrategy;
 @synthesize shouldRegisterUncaughtExceptionHandler = _shouldRegisterUncaughtExceptionHandler;
 @synthesize maxReportBytes = _maxReportBytes;
+@synthesize liveReportUnwindWorkers = _liveReportUnwindWorkers;
+@synthesize reportOutputBufferSize = _reportOutputBufferSize;
+@synthesize loadImagesInBackground = _loadImagesInBackground;
+@synthesize usePackedStackFrames = _usePackedStackFrames;
+@synthesize useReportStringTable = _useReportStringTable;
+@synthesize indexUnwindTables = _indexUnwindTables;
 
 /**
  * Return the default local configuration.
@@ -181,6 +205,51 @@
     shouldRegisterUncaughtExceptionHandler: (BOOL) shouldRegisterUncaughtExceptionHandler
                                   basePath: (NSString *) basePath
                             maxReportBytes: (NSUInteger) maxReportBytes
+{
+    return [self initWithSignalHandlerType: signalHandlerType
+                     symbolicationStrategy: symbolicationStrategy
+    shouldRegisterUncaughtExceptionHandler: shouldRegisterUncaughtExceptionHandler
+                                  basePath: basePath
+                            maxReportBytes: maxReportBytes
+                   liveReportUnwindWorkers: 0
+                    reportOutputBufferSize: 0
+                    loadImagesInBackground: NO
+                      usePackedStackFrames: NO
+                      useReportStringTable: NO
+                         indexUnwindTables: NO];
+}
+
+/**
+ * Initialize a new PLCrashReporterConfig instance.
+ *
+ * @param signalHandlerType The requested signal handler type.
+ * @param symbolicationStrategy A local symbolication strategy.
+ * @param shouldRegisterUncaughtExceptionHandler Flag indicating if an uncaught exception handler should be set.
+ * @param basePath The base path to save the crash data. May be nil.
+ * @param maxReportBytes Maximum number of bytes that will be written to the crash report.
+ * @param liveReportUnwindWorkers The number of additional worker threads used to unwind live reports; see
+ * PLCrashReporterConfig::liveReportUnwindWorkers.
+ * @param reportOutputBufferSize The size of the crash-time output buffer; see PLCrashReporterConfig::reportOutputBufferSize.
+ * @param loadImagesInBackground If YES, image data is parsed on a background queue; see
+ * PLCrashReporterConfig::loadImagesInBackground.
+ * @param usePackedStackFrames If YES, stack frames are written as packed, image-relative offsets; see
+ * PLCrashReporterConfig::usePackedStackFrames.
+ * @param useReportStringTable If YES, image paths and symbol names are written via a string table; see
+ * PLCrashReporterConfig::useReportStringTable.
+ * @param indexUnwindTables If YES, image unwind tables are indexed when images are loaded; see
+ * PLCrashReporterConfig::indexUnwindTables.
+ */
+- (instancetype) initWithSignalHandlerType: (PLCrashReporterSignalHandlerType) signalHandlerType
+                     symbolicationStrategy: (PLCrashReporterSymbolicationStrategy) symbolicationStrategy
+    shouldRegisterUncaughtExceptionHandler: (BOOL) shouldRegisterUncaughtExceptionHandler
+                                  basePath: (NSString *) basePath
+                            maxReportBytes: (NSUInteger) maxReportBytes
+                   liveReportUnwindWorkers: (NSUInteger) liveReportUnwindWorkers
+                    reportOutputBufferSize: (NSUInteger) reportOutputBufferSize
+                    loadImagesInBackground: (BOOL) loadImagesInBackground
+                      usePackedStackFrames: (BOOL) usePackedStackFrames
+                      useReportStringTable: (BOOL) useReportStringTable
+                         indexUnwindTables: (BOOL) indexUnwindTables
 {
   if ((self = [super init]) == nil)
     return nil;
@@ -190,6 +259,12 @@
   _shouldRegisterUncaughtExceptionHandler = shouldRegisterUncaughtExceptionHandler;
   _basePath = basePath;
   _maxReportBytes = maxReportBytes;
+  _liveReportUnwindWorkers = liveReportUnwindWorkers;
+  _reportOutputBufferSize = reportOutputBufferSize;
+  _loadImagesInBackground = loadImagesInBackground;
+  _usePackedStackFrames = usePackedStackFrames;
+  _useReportStringTable = useReportStringTable;
+  _indexUnwindTables = indexUnwindTables;
 
   return self;
 }
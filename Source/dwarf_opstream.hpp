@@ -167,10 +167,11 @@ inline bool dwarf_opstream::read_uintmax64 (uint8_t data_size, uint64_t *result)
  */
 inline bool dwarf_opstream::read_uleb128 (uint64_t *result) {
     PLCF_UNUSED_IN_RELEASE plcrash_error_t err;
-    pl_vm_off_t offset = ((uint8_t *)_p - (uint8_t *)_instr);
+    pl_vm_size_t avail = ((uint8_t *)_instr_max - (uint8_t *)_p);
     pl_vm_size_t lebsize;
 
-    if ((err = plcrash_async_dwarf_read_uleb128(_mobj, _start, offset, result, &lebsize)) != PLCRASH_ESUCCESS) {
+    /* The opstream range was validated against the mapping at init; decode directly from the current position */
+    if ((err = plcrash_async_dwarf_decode_uleb128((const uint8_t *) _p, avail, result, &lebsize)) != PLCRASH_ESUCCESS) {
         PLCF_DEBUG("Read of ULEB128 value failed with %u", err);
         return false;
     }
@@ -193,14 +194,15 @@ inline bool dwarf_opstream::read_uleb128 (uint64_t *result) {
  */
 inline bool dwarf_opstream::read_sleb128 (int64_t *result) {
     PLCF_UNUSED_IN_RELEASE plcrash_error_t err;
-    pl_vm_off_t offset = ((uint8_t *)_p - (uint8_t *)_instr);
+    pl_vm_size_t avail = ((uint8_t *)_instr_max - (uint8_t *)_p);
     pl_vm_size_t lebsize;
-    
-    if ((err = plcrash_async_dwarf_read_sleb128(_mobj, _start, offset, result, &lebsize)) != PLCRASH_ESUCCESS) {
-        PLCF_DEBUG("Read of ULEB128 value failed with %u", err);
+
+    /* The opstream range was validated against the mapping at init; decode directly from the current position */
+    if ((err = plcrash_async_dwarf_decode_sleb128((const uint8_t *) _p, avail, result, &lebsize)) != PLCRASH_ESUCCESS) {
+        PLCF_DEBUG("Read of SLEB128 value failed with %u", err);
         return false;
     }
-    
+
     /* Advance the position */
     if (!skip(lebsize)) {
         PLCF_DEBUG("SLEB128 value extends past end of opstream");
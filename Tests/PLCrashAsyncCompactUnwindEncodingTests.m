@@ -764,12 +764,14 @@
  */
 - (void) testReadCompressedCommonEncoding {
     pl_vm_address_t function_base;
+    pl_vm_address_t function_end;
     plcrash_error_t err;
 
     uint32_t encoding;
-    err = plcrash_async_cfe_reader_find_pc(&_reader, PC_COMPACT_COMMON, &function_base, &encoding);
+    err = plcrash_async_cfe_reader_find_pc(&_reader, PC_COMPACT_COMMON, &function_base, &function_end, &encoding);
     STAssertEquals(PLCRASH_ESUCCESS, err, @"Failed to locate CFE entry");
     STAssertEquals(function_base, (pl_vm_address_t)PC_COMPACT_COMMON, @"Incorrect function base returned");
+    STAssertTrue(function_end > (pl_vm_address_t)PC_COMPACT_COMMON, @"Function range does not include the PC");
     STAssertEquals(encoding, (uint32_t)PC_COMPACT_COMMON_ENCODING, @"Incorrect encoding returned");
 }
 
@@ -778,12 +780,14 @@
  */
 - (void) testReadCompressedEncoding {
     pl_vm_address_t function_base;
+    pl_vm_address_t function_end;
     plcrash_error_t err;
     
     uint32_t encoding;
-    err = plcrash_async_cfe_reader_find_pc(&_reader, PC_COMPACT_PRIVATE, &function_base, &encoding);
+    err = plcrash_async_cfe_reader_find_pc(&_reader, PC_COMPACT_PRIVATE, &function_base, &function_end, &encoding);
     STAssertEquals(PLCRASH_ESUCCESS, err, @"Failed to locate CFE entry");
     STAssertEquals(function_base, (pl_vm_address_t)PC_COMPACT_PRIVATE, @"Incorrect function base returned");
+    STAssertTrue(function_end > (pl_vm_address_t)PC_COMPACT_PRIVATE, @"Function range does not include the PC");
     STAssertEquals(encoding, (uint32_t)PC_COMPACT_PRIVATE_ENCODING, @"Incorrect encoding returned");
 }
 
@@ -792,12 +796,14 @@
  */
 - (void) testReadRegularEncoding {
     pl_vm_address_t function_base;
+    pl_vm_address_t function_end;
     plcrash_error_t err;
     
     uint32_t encoding;
-    err = plcrash_async_cfe_reader_find_pc(&_reader, PC_REGULAR, &function_base, &encoding);
+    err = plcrash_async_cfe_reader_find_pc(&_reader, PC_REGULAR, &function_base, &function_end, &encoding);
     STAssertEquals(PLCRASH_ESUCCESS, err, @"Failed to locate CFE entry");
     STAssertEquals(function_base, (pl_vm_address_t)PC_REGULAR, @"Incorrect function base returned");
+    STAssertTrue(function_end > (pl_vm_address_t)PC_REGULAR, @"Function range does not include the PC");
     STAssertEquals(encoding, (uint32_t)PC_REGULAR_ENCODING, @"Incorrect encoding returned");
 }
 
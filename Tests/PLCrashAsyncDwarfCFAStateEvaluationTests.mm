@@ -88,7 +88,7 @@ using namespace plcrash::async;
     plcrash_error_t err; \
     STAssertEquals(PLCRASH_ESUCCESS, plcrash_async_mobject_init(&mobj, mach_task_self(), (pl_vm_address_t) &opcodes, sizeof(opcodes), true), @"Failed to initialize mobj"); \
     \
-        err = _stack.eval_program(&mobj, (uint64_t)pc, (uint64_t)initial_pc, &_cie, _ptr_state, plcrash_async_byteorder_big_endian(), (pl_vm_address_t) &opcodes, 0, sizeof(opcodes)); \
+        err = _stack.eval_program(&mobj, (uint64_t)pc, (uint64_t)initial_pc, &_cie, _ptr_state, plcrash_async_byteorder_big_endian(), (pl_vm_address_t) &opcodes, 0, sizeof(opcodes), NULL, NULL); \
         STAssertEquals(err, expected, @"Evaluation failed"); \
     \
     plcrash_async_mobject_free(&mobj); \
@@ -159,6 +159,28 @@ using namespace plcrash::async;
     PERFORM_EVAL_TEST(opcodes, 0x2, PLCRASH_ESUCCESS);
 }
 
+/** Test reporting of the CFA table row range containing the target PC */
+- (void) testRowRange {
+    plcrash_async_mobject_t mobj;
+    uint64_t row_start;
+    uint64_t row_end;
+
+    uint8_t opcodes[] = { DW_CFA_advance_loc|0x4, DW_CFA_nop, DW_CFA_advance_loc|0x4, DW_CFA_nop };
+    STAssertEquals(PLCRASH_ESUCCESS, plcrash_async_mobject_init(&mobj, mach_task_self(), (pl_vm_address_t) &opcodes, sizeof(opcodes), true), @"Failed to initialize mobj");
+
+    /* A PC within the second row */
+    STAssertEquals(PLCRASH_ESUCCESS, _stack.eval_program(&mobj, 0x5, 0x0, &_cie, _ptr_state, plcrash_async_byteorder_big_endian(), (pl_vm_address_t) &opcodes, 0, sizeof(opcodes), &row_start, &row_end), @"Evaluation failed");
+    STAssertEquals(row_start, (uint64_t) 0x4, @"Incorrect row start");
+    STAssertEquals(row_end, (uint64_t) 0x8, @"Incorrect row end");
+
+    /* A PC within the final row, which extends to the end of the FDE */
+    STAssertEquals(PLCRASH_ESUCCESS, _stack.eval_program(&mobj, 0x9, 0x0, &_cie, _ptr_state, plcrash_async_byteorder_big_endian(), (pl_vm_address_t) &opcodes, 0, sizeof(opcodes), &row_start, &row_end), @"Evaluation failed");
+    STAssertEquals(row_start, (uint64_t) 0x8, @"Incorrect row start");
+    STAssertEquals(row_end, (uint64_t) 0x0, @"Final row should be open-ended");
+
+    plcrash_async_mobject_free(&mobj);
+}
+
 /** Test evaluation of DW_CFA_def_cfa */
 - (void) testDefineCFA {
     uint8_t opcodes[] = { DW_CFA_def_cfa, 0x1, 0x2};
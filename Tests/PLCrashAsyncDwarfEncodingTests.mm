@@ -171,6 +171,199 @@ using namespace plcrash::async;
     STAssertEquals(PLCRASH_ENOTFOUND, err, @"FDE should not have been found");
 }
 
+/**
+ * Verify that an FDE offset hint (as provided by compact unwind DWARF entries) is used to locate the FDE directly,
+ * including when an FDE lookup table is available.
+ */
+- (void) testFindFrameDescriptorEntryWithOffsetHint {
+    plcrash_error_t err;
+    plcrash_async_dwarf_fde_info_t fde_info;
+    pl_vm_address_t expected_offset = sizeof(pl_cfi_entry) + (_m64 ? PL_CFI_LEN_SIZE_64 : PL_CFI_LEN_SIZE_32);
+
+    /* The FDE is the second entry in the table */
+    err = _eh_reader.find_fde(sizeof(pl_cfi_entry), PL_CFI_EH_FRAME_PC, &fde_info);
+    STAssertEquals(PLCRASH_ESUCCESS, err, @"FDE search failed");
+    STAssertEquals(fde_info.fde_offset, expected_offset, @"Incorrect offset");
+    plcrash_async_dwarf_fde_info_free(&fde_info);
+
+    /* The hint should take precedence over the lookup table */
+    STAssertEquals(_eh_reader.nasync_build_fde_table(), PLCRASH_ESUCCESS, @"Failed to build FDE table");
+    err = _eh_reader.find_fde(sizeof(pl_cfi_entry), PL_CFI_EH_FRAME_PC, &fde_info);
+    STAssertEquals(PLCRASH_ESUCCESS, err, @"FDE search failed");
+    STAssertEquals(fde_info.fde_offset, expected_offset, @"Incorrect offset");
+    plcrash_async_dwarf_fde_info_free(&fde_info);
+    _eh_reader.nasync_free_fde_table();
+
+    /* An out-of-range hint should be rejected */
+    err = _eh_reader.find_fde(plcrash_async_mobject_length(&_eh_frame), PL_CFI_EH_FRAME_PC, &fde_info);
+    STAssertEquals(PLCRASH_EINVAL, err, @"Out-of-range offset hint should be rejected");
+}
+
+/**
+ * Measure FDE lookups performed via a search of the __eh_frame section, as used when no offset hint is available.
+ * Compare with testFindFrameDescriptorEntryWithOffsetHintPerformance.
+ */
+- (void) testFindFrameDescriptorEntryPerformance {
+    [self measureBlock: ^{
+        for (int i = 0; i < 10000; i++) {
+            plcrash_async_dwarf_fde_info_t fde_info;
+            if (_eh_reader.find_fde(0x0, PL_CFI_EH_FRAME_PC, &fde_info) != PLCRASH_ESUCCESS) {
+                STFail(@"FDE search failed");
+                return;
+            }
+            plcrash_async_dwarf_fde_info_free(&fde_info);
+        }
+    }];
+}
+
+/**
+ * Measure FDE lookups performed using the __eh_frame offset hint supplied by compact unwind DWARF entries.
+ * Compare with testFindFrameDescriptorEntryPerformance.
+ */
+- (void) testFindFrameDescriptorEntryWithOffsetHintPerformance {
+    /* The FDE is the second entry in the table */
+    pl_vm_off_t fde_offset = sizeof(pl_cfi_entry);
+
+    [self measureBlock: ^{
+        for (int i = 0; i < 10000; i++) {
+            plcrash_async_dwarf_fde_info_t fde_info;
+            if (_eh_reader.find_fde(fde_offset, PL_CFI_EH_FRAME_PC, &fde_info) != PLCRASH_ESUCCESS) {
+                STFail(@"FDE search failed");
+                return;
+            }
+            plcrash_async_dwarf_fde_info_free(&fde_info);
+        }
+    }];
+}
+
+/**
+ * Verify that FDE lookups performed via the FDE lookup table return the same results as the linear search.
+ */
+- (void) testFindFrameDescriptorEntryWithTable {
+    dwarf_frame_reader *readers[] = { &_eh_reader, &_debug_reader };
+    pl_vm_address_t pcs[] = {
+        PL_CFI_EH_FRAME_PC, PL_CFI_EH_FRAME_PC+PL_CFI_EH_FRAME_PC_RANGE-1, PL_CFI_EH_FRAME_PC+PL_CFI_EH_FRAME_PC_RANGE,
+        PL_CFI_DEBUG_FRAME_PC, PL_CFI_DEBUG_FRAME_PC+PL_CFI_DEBUG_FRAME_PC_RANGE-1, PL_CFI_DEBUG_FRAME_PC+PL_CFI_DEBUG_FRAME_PC_RANGE,
+        0x0
+    };
+
+    for (size_t i = 0; i < sizeof(readers) / sizeof(readers[0]); i++) {
+        dwarf_frame_reader *reader = readers[i];
+
+        /* Perform the linear lookups */
+        plcrash_error_t expected_err[sizeof(pcs) / sizeof(pcs[0])];
+        plcrash_async_dwarf_fde_info_t expected_info[sizeof(pcs) / sizeof(pcs[0])];
+        for (size_t j = 0; j < sizeof(pcs) / sizeof(pcs[0]); j++)
+            expected_err[j] = reader->find_fde(0x0, pcs[j], &expected_info[j]);
+
+        /* Build the table */
+        STAssertEquals(reader->nasync_build_fde_table(), PLCRASH_ESUCCESS, @"Failed to build FDE table");
+        STAssertEquals(reader->fde_table_count(), (size_t) 1, @"Incorrect FDE count");
+
+        /* Compare against the table lookups */
+        for (size_t j = 0; j < sizeof(pcs) / sizeof(pcs[0]); j++) {
+            plcrash_async_dwarf_fde_info_t fde_info;
+            plcrash_error_t err = reader->find_fde(0x0, pcs[j], &fde_info);
+            STAssertEquals(err, expected_err[j], @"Table lookup result differs for 0x%" PRIx64, (uint64_t) pcs[j]);
+
+            if (err == PLCRASH_ESUCCESS && expected_err[j] == PLCRASH_ESUCCESS) {
+                STAssertEquals(fde_info.fde_offset, expected_info[j].fde_offset, @"Incorrect offset");
+                STAssertEquals(fde_info.fde_length, expected_info[j].fde_length, @"Incorrect length");
+                STAssertEquals(fde_info.pc_start, expected_info[j].pc_start, @"Incorrect pc_start");
+                STAssertEquals(fde_info.pc_end, expected_info[j].pc_end, @"Incorrect pc_end");
+                plcrash_async_dwarf_fde_info_free(&fde_info);
+            }
+
+            if (expected_err[j] == PLCRASH_ESUCCESS)
+                plcrash_async_dwarf_fde_info_free(&expected_info[j]);
+        }
+
+        reader->nasync_free_fde_table();
+        STAssertEquals(reader->fde_table_count(), (size_t) 0, @"Table was not freed");
+    }
+}
+
+/*
+ * Initialize @a entry as an eh_frame FDE at @a index within the frame data, referencing the CIE at index 0.
+ */
+static void init_test_fde (pl_cfi_entry *entry, size_t index, uint64_t pc, uint64_t range) {
+    memset(entry, 0, sizeof(*entry));
+    entry->e64.hdr.flag64 = UINT32_MAX;
+    entry->e64.hdr.length = PL_CFI_SIZE_64;
+    entry->e64.hdr.cie_id = (index * sizeof(pl_cfi_entry)) + PL_CFI_LEN_SIZE_64;
+    entry->e64.fde.initial_location = pc;
+    entry->e64.fde.address_range = range;
+}
+
+/**
+ * Verify that FDE table lookups match the linear search when the frame data contains zero-length and
+ * overlapping FDEs.
+ */
+- (void) testFindFrameDescriptorEntryWithTableOverlappingEntries {
+    pl_cfi_entry entries[6];
+    plcrash_async_mobject_t mobj;
+    dwarf_frame_reader reader;
+
+    /* Common CIE entry */
+    memset(&entries[0], 0, sizeof(entries[0]));
+    entries[0].e64.hdr.flag64 = UINT32_MAX;
+    entries[0].e64.hdr.length = PL_CFI_SIZE_64;
+    entries[0].e64.hdr.cie_id = 0;
+    entries[0].e64.cie.version = 1;
+    entries[0].e64.cie.augmentation[0] = 'z';
+    entries[0].e64.cie.augmentation[1] = 'R';
+    entries[0].e64.cie.augmentation_data[0] = sizeof(entries[0].e64.cie.augmentation_data);
+    entries[0].e64.cie.augmentation_data[1] = 0x04; // DW_EH_PE_udata8
+
+    /* A zero-length FDE, an FDE enclosing a later FDE, and a disjoint FDE preceding both in address order */
+    init_test_fde(&entries[1], 1, 0x100, 0x0);
+    init_test_fde(&entries[2], 2, 0x100, 0x100);
+    init_test_fde(&entries[3], 3, 0x120, 0x10);
+    init_test_fde(&entries[4], 4, 0x80, 0x10);
+
+    /* Terminator */
+    memset(&entries[5], 0, sizeof(entries[5]));
+
+    STAssertEquals(plcrash_async_mobject_init(&mobj, mach_task_self(), (pl_vm_address_t) entries, sizeof(entries), true), PLCRASH_ESUCCESS, @"Failed to initialize mobj");
+    STAssertEquals(reader.init(&mobj, &plcrash_async_byteorder_direct, true, false), PLCRASH_ESUCCESS, @"Failed to initialize reader");
+
+    pl_vm_address_t pcs[] = { 0x0, 0x80, 0x8f, 0x90, 0xff, 0x100, 0x11f, 0x120, 0x12f, 0x130, 0x1ff, 0x200 };
+
+    /* Perform the linear lookups */
+    plcrash_error_t expected_err[sizeof(pcs) / sizeof(pcs[0])];
+    plcrash_async_dwarf_fde_info_t expected_info[sizeof(pcs) / sizeof(pcs[0])];
+    for (size_t i = 0; i < sizeof(pcs) / sizeof(pcs[0]); i++)
+        expected_err[i] = reader.find_fde(0x0, pcs[i], &expected_info[i]);
+
+    /* The enclosing FDE appears first in the frame data, and must be preferred for PCs within the enclosed FDE */
+    STAssertEquals(expected_err[8], PLCRASH_ESUCCESS, @"Linear lookup failed");
+    STAssertEquals(expected_info[8].pc_start, (uint64_t) 0x100, @"Linear lookup returned the enclosed FDE");
+
+    /* Build the table; the zero-length FDE should be omitted */
+    STAssertEquals(reader.nasync_build_fde_table(), PLCRASH_ESUCCESS, @"Failed to build FDE table");
+    STAssertEquals(reader.fde_table_count(), (size_t) 3, @"Incorrect FDE count");
+
+    /* Compare against the table lookups */
+    for (size_t i = 0; i < sizeof(pcs) / sizeof(pcs[0]); i++) {
+        plcrash_async_dwarf_fde_info_t fde_info;
+        plcrash_error_t err = reader.find_fde(0x0, pcs[i], &fde_info);
+        STAssertEquals(err, expected_err[i], @"Table lookup result differs for 0x%" PRIx64, (uint64_t) pcs[i]);
+
+        if (err == PLCRASH_ESUCCESS && expected_err[i] == PLCRASH_ESUCCESS) {
+            STAssertEquals(fde_info.fde_offset, expected_info[i].fde_offset, @"Incorrect offset for 0x%" PRIx64, (uint64_t) pcs[i]);
+            STAssertEquals(fde_info.pc_start, expected_info[i].pc_start, @"Incorrect pc_start for 0x%" PRIx64, (uint64_t) pcs[i]);
+            STAssertEquals(fde_info.pc_end, expected_info[i].pc_end, @"Incorrect pc_end for 0x%" PRIx64, (uint64_t) pcs[i]);
+            plcrash_async_dwarf_fde_info_free(&fde_info);
+        }
+
+        if (expected_err[i] == PLCRASH_ESUCCESS)
+            plcrash_async_dwarf_fde_info_free(&expected_info[i]);
+    }
+
+    reader.nasync_free_fde_table();
+    plcrash_async_mobject_free(&mobj);
+}
+
 @end
 
 #endif /* PLCRASH_FEATURE_UNWIND_DWARF */
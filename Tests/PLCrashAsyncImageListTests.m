@@ -143,6 +143,197 @@
     plcrash_async_image_list_set_reading(&_list, false);
 }
 
+/* Test enabling indexing for both existing and newly appended images. */
+- (void) testIndexing {
+    // XXX - This is required due to the tight coupling with the Mach-O parser
+    uint32_t count = _dyld_image_count();
+    STAssertTrue(count >= 2, @"We need at least two Mach-O images for this test. This should not be a problem on a modern system.");
+
+    /* Images appended prior to enabling indexing are not indexed */
+    plcrash_nasync_image_list_append(&_list, (pl_vm_address_t) _dyld_get_image_header(0), _dyld_get_image_name(0));
+
+    plcrash_async_image_list_set_reading(&_list, true); {
+        plcrash_async_image_t *item = plcrash_async_image_list_next(&_list, NULL);
+        STAssertNotNULL(item, @"Item should not be NULL");
+        STAssertNULL(item->macho_image.symbol_index, @"Image should not be indexed");
+        STAssertNULL(item->dwarf_unwind, @"Image should not have a DWARF unwind context");
+    } plcrash_async_image_list_set_reading(&_list, false);
+
+    /* Enabling indexing should index existing images, as well as all newly appended images */
+    plcrash_nasync_image_list_set_indexing(&_list, PLCRASH_ASYNC_IMAGE_INDEX_SYMBOLS|PLCRASH_ASYNC_IMAGE_INDEX_DWARF_UNWIND);
+    plcrash_nasync_image_list_append(&_list, (pl_vm_address_t) _dyld_get_image_header(1), _dyld_get_image_name(1));
+
+    plcrash_async_image_list_set_reading(&_list, true); {
+        plcrash_async_image_t *item = NULL;
+        for (uint32_t i = 0; i < 2; i++) {
+            item = plcrash_async_image_list_next(&_list, item);
+            STAssertNotNULL(item, @"Item should not be NULL");
+            STAssertNotNULL(item->macho_image.symbol_index, @"Image %d was not indexed", (int) i);
+        }
+    } plcrash_async_image_list_set_reading(&_list, false);
+}
+
+/* Test that repeatedly loading and unloading images does not accumulate removed images. */
+- (void) testRemovedImageReclamation {
+    pl_vm_address_t header = (pl_vm_address_t) _dyld_get_image_header(0);
+    const char *name = _dyld_get_image_name(0);
+    plcrash_nasync_image_list_append(&_list, (pl_vm_address_t) _dyld_get_image_header(1), _dyld_get_image_name(1));
+
+    /* Images removed while a reader is active are retained */
+    plcrash_nasync_image_list_append(&_list, header, name);
+    plcrash_async_image_list_set_reading(&_list, true); {
+        plcrash_async_image_t *image = plcrash_async_image_containing_address(&_list, header);
+        STAssertNotNULL(image, @"Failed to find image");
+
+        plcrash_nasync_image_list_remove(&_list, header);
+        STAssertEquals(plcrash_nasync_image_list_retired_count(&_list), (size_t)1, @"Image should be retained while a reader is active");
+        STAssertEquals(image->macho_image.header_addr, header, @"Retained image is invalid");
+    } plcrash_async_image_list_set_reading(&_list, false);
+
+    STAssertEquals(plcrash_nasync_image_list_retired_count(&_list), (size_t)0, @"Image was not freed once readers completed");
+
+    /* Simulate dlopen/dlclose churn */
+    for (int i = 0; i < 1000; i++) {
+        plcrash_nasync_image_list_append(&_list, header, name);
+        plcrash_nasync_image_list_remove(&_list, header);
+    }
+    STAssertEquals(plcrash_nasync_image_list_retired_count(&_list), (size_t)0, @"Removed images accumulated");
+
+    /* The remaining image should still be found */
+    plcrash_async_image_list_set_reading(&_list, true); {
+        plcrash_async_image_t *image = plcrash_async_image_list_next(&_list, NULL);
+        STAssertNotNULL(image, @"Image should not be NULL");
+        STAssertEquals(image->macho_image.header_addr, (pl_vm_address_t) _dyld_get_image_header(1), @"Incorrect header value");
+        STAssertNULL(plcrash_async_image_list_next(&_list, image), @"Removed image is still visible");
+    } plcrash_async_image_list_set_reading(&_list, false);
+}
+
+/* Test deferred registration, loading, and removal of images. */
+- (void) testDeferredAppend {
+    uint32_t count = _dyld_image_count();
+    STAssertTrue(count >= 3, @"We need at least three Mach-O images for this test. This should not be a problem on a modern system.");
+
+    /* Image 0 is resolved via dladdr(); the remainder use the provided name */
+    plcrash_nasync_image_list_append_deferred(&_list, (pl_vm_address_t) _dyld_get_image_header(0), _dyld_get_image_vmaddr_slide(0), NULL);
+    plcrash_nasync_image_list_append_deferred(&_list, (pl_vm_address_t) _dyld_get_image_header(1), _dyld_get_image_vmaddr_slide(1), _dyld_get_image_name(1));
+    plcrash_nasync_image_list_append_deferred(&_list, (pl_vm_address_t) _dyld_get_image_header(2), _dyld_get_image_vmaddr_slide(2), _dyld_get_image_name(2));
+    STAssertEquals(plcrash_nasync_image_list_deferred_count(&_list), (size_t)3, @"Incorrect deferred count");
+
+    /* Deferred images are not visible until loaded */
+    plcrash_async_image_list_set_reading(&_list, true); {
+        STAssertNULL(plcrash_async_image_list_next(&_list, NULL), @"Deferred image should not be visible");
+    } plcrash_async_image_list_set_reading(&_list, false);
+
+    /* Removing a deferred image drops the registration */
+    plcrash_nasync_image_list_remove(&_list, (pl_vm_address_t) _dyld_get_image_header(1));
+    STAssertEquals(plcrash_nasync_image_list_deferred_count(&_list), (size_t)2, @"Incorrect deferred count");
+
+    STAssertEquals(plcrash_nasync_image_list_load_deferred(&_list), (size_t)2, @"Incorrect number of images loaded");
+    STAssertEquals(plcrash_nasync_image_list_deferred_count(&_list), (size_t)0, @"Deferred images remain");
+
+    plcrash_async_image_list_set_reading(&_list, true); {
+        uint32_t expected[] = { 0, 2 };
+        plcrash_async_image_t *item = NULL;
+        for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+            item = plcrash_async_image_list_next(&_list, item);
+            STAssertNotNULL(item, @"Item should not be NULL");
+            if (item == NULL)
+                break;
+
+            STAssertEquals((pl_vm_address_t) _dyld_get_image_header(expected[i]), item->macho_image.header_addr, @"Incorrect header value");
+            STAssertEquals((pl_vm_off_t) _dyld_get_image_vmaddr_slide(expected[i]), item->macho_image.vmaddr_slide, @"Incorrect slide value");
+            STAssertNotNULL(item->macho_image.name, @"Image name was not resolved");
+        }
+        STAssertNULL(plcrash_async_image_list_next(&_list, item), @"Unexpected additional image");
+    } plcrash_async_image_list_set_reading(&_list, false);
+}
+
+/* Register all loaded images with @a list, either immediately or deferred, as performed by the dyld add-image callback. */
+static void register_images (plcrash_async_image_list_t *list, bool deferred) {
+    for (uint32_t i = 0; i < _dyld_image_count(); i++) {
+        if (deferred) {
+            plcrash_nasync_image_list_append_deferred(list, (pl_vm_address_t) _dyld_get_image_header(i), _dyld_get_image_vmaddr_slide(i), NULL);
+        } else {
+            /* Immediate registration, as performed by dladdr() and plcrash_nasync_image_list_append() */
+            Dl_info info;
+            if (dladdr(_dyld_get_image_header(i), &info) != 0)
+                plcrash_nasync_image_list_append(list, (pl_vm_address_t) _dyld_get_image_header(i), info.dli_fname);
+        }
+    }
+}
+
+/* Measure the cost of immediate image registration. Compare with testDeferredRegistrationPerformance. */
+- (void) testImmediateRegistrationPerformance {
+    [self measureBlock: ^{
+        plcrash_async_image_list_t list;
+        plcrash_nasync_image_list_init(&list, mach_task_self());
+        register_images(&list, false);
+        plcrash_nasync_image_list_free(&list);
+    }];
+}
+
+/* Measure the cost of deferred image registration. Compare with testImmediateRegistrationPerformance. */
+- (void) testDeferredRegistrationPerformance {
+    [self measureBlock: ^{
+        plcrash_async_image_list_t list;
+        plcrash_nasync_image_list_init(&list, mach_task_self());
+        register_images(&list, true);
+        plcrash_nasync_image_list_free(&list);
+    }];
+}
+
+/* Measure the cost of immediate image registration with symbol indexing. Compare with testUnwindIndexedRegistrationPerformance. */
+- (void) testSymbolIndexedRegistrationPerformance {
+    [self measureBlock: ^{
+        plcrash_async_image_list_t list;
+        plcrash_nasync_image_list_init(&list, mach_task_self());
+        plcrash_nasync_image_list_set_indexing(&list, PLCRASH_ASYNC_IMAGE_INDEX_SYMBOLS);
+        register_images(&list, false);
+        plcrash_nasync_image_list_free(&list);
+    }];
+}
+
+/* Measure the cost of immediate image registration with symbol and unwind indexing, as enabled by PLCrashReporterConfig::indexUnwindTables. */
+- (void) testUnwindIndexedRegistrationPerformance {
+    [self measureBlock: ^{
+        plcrash_async_image_list_t list;
+        plcrash_nasync_image_list_init(&list, mach_task_self());
+        plcrash_nasync_image_list_set_indexing(&list, PLCRASH_ASYNC_IMAGE_INDEX_SYMBOLS|PLCRASH_ASYNC_IMAGE_INDEX_DWARF_UNWIND|PLCRASH_ASYNC_IMAGE_INDEX_COMPACT_UNWIND);
+        register_images(&list, false);
+        plcrash_nasync_image_list_free(&list);
+    }];
+}
+
+/* Verify that loading deferred registrations produces the same list as immediate registration. */
+- (void) testDeferredRegistrationLoad {
+    uint32_t count = _dyld_image_count();
+    register_images(&_list, false);
+
+    plcrash_async_image_list_t deferred;
+    plcrash_nasync_image_list_init(&deferred, mach_task_self());
+    register_images(&deferred, true);
+
+    /* Loading the deferred images must produce the same list */
+    STAssertEquals(plcrash_nasync_image_list_load_deferred(&deferred), (size_t) count, @"Incorrect number of images loaded");
+    plcrash_async_image_list_set_reading(&_list, true);
+    plcrash_async_image_list_set_reading(&deferred, true); {
+        plcrash_async_image_t *a = NULL;
+        plcrash_async_image_t *b = NULL;
+        do {
+            a = plcrash_async_image_list_next(&_list, a);
+            b = plcrash_async_image_list_next(&deferred, b);
+            STAssertTrue((a == NULL) == (b == NULL), @"Image lists differ in length");
+            if (a != NULL && b != NULL) {
+                STAssertEquals(a->macho_image.header_addr, b->macho_image.header_addr, @"Incorrect header value");
+                STAssertEqualCStrings(a->macho_image.name, b->macho_image.name, @"Incorrect name value");
+            }
+        } while (a != NULL && b != NULL);
+    } plcrash_async_image_list_set_reading(&deferred, false);
+    plcrash_async_image_list_set_reading(&_list, false);
+
+    plcrash_nasync_image_list_free(&deferred);
+}
+
 - (void) testFindImageForAddress {    
     /* Fetch the our IMP address and symbolicate it using dladdr(). */
     IMP localIMP = class_getMethodImplementation([self class], _cmd);
@@ -184,4 +375,68 @@
 
 }
 
+/* Test address lookups across multiple images, including after an image has been removed. */
+- (void) testFindImageForAddressWithRemoval {
+    // XXX - This is required due to the tight coupling with the Mach-O parser
+    uint32_t count = _dyld_image_count();
+    STAssertTrue(count >= 5, @"We need at least five Mach-O images for this test. This should not be a problem on a modern system.");
+
+    /* Append in reverse order, to exercise sorted insertion */
+    for (int i = 4; i >= 0; i--)
+        plcrash_nasync_image_list_append(&_list, (pl_vm_address_t) _dyld_get_image_header(i), _dyld_get_image_name(i));
+
+    plcrash_async_image_list_set_reading(&_list, true); {
+        for (uint32_t i = 0; i < 5; i++) {
+            pl_vm_address_t header = (pl_vm_address_t) _dyld_get_image_header(i);
+            plcrash_async_image_t *image = plcrash_async_image_containing_address(&_list, header);
+            STAssertNotNULL(image, @"Failed to find image %d", (int) i);
+            STAssertEquals(image->macho_image.header_addr, header, @"Incorrect image returned for %d", (int) i);
+
+            /* The final byte of the text segment should resolve to the same image */
+            image = plcrash_async_image_containing_address(&_list, header + image->macho_image.text_size - 1);
+            STAssertNotNULL(image, @"Failed to find image %d", (int) i);
+            STAssertEquals(image->macho_image.header_addr, header, @"Incorrect image returned for %d", (int) i);
+        }
+    } plcrash_async_image_list_set_reading(&_list, false);
+
+    /* Remove an image; it should no longer be found */
+    pl_vm_address_t removed = (pl_vm_address_t) _dyld_get_image_header(2);
+    plcrash_nasync_image_list_remove(&_list, removed);
+
+    plcrash_async_image_list_set_reading(&_list, true); {
+        STAssertNULL(plcrash_async_image_containing_address(&_list, removed), @"Removed image should not be found");
+
+        for (uint32_t i = 0; i < 5; i++) {
+            if (i == 2)
+                continue;
+
+            pl_vm_address_t header = (pl_vm_address_t) _dyld_get_image_header(i);
+            plcrash_async_image_t *image = plcrash_async_image_containing_address(&_list, header);
+            STAssertNotNULL(image, @"Failed to find image %d", (int) i);
+            STAssertEquals(image->macho_image.header_addr, header, @"Incorrect image returned for %d", (int) i);
+        }
+    } plcrash_async_image_list_set_reading(&_list, false);
+}
+
+/* Test that an address covered by overlapping image ranges resolves to the image appended first, as iterating the list would. */
+- (void) testFindImageForAddressWithOverlappingRanges {
+    pl_vm_address_t header = (pl_vm_address_t) _dyld_get_image_header(0);
+
+    /* Register the same image twice; the second registration's range exactly overlaps the first */
+    plcrash_nasync_image_list_append(&_list, header, "first");
+    plcrash_nasync_image_list_append(&_list, header, "second");
+
+    plcrash_async_image_list_set_reading(&_list, true); {
+        plcrash_async_image_t *image = plcrash_async_image_containing_address(&_list, header);
+        STAssertNotNULL(image, @"Failed to find image");
+        STAssertEqualCStrings(image->macho_image.name, "first", @"Overlapping range did not resolve to the first appended image");
+
+        image = plcrash_async_image_containing_address(&_list, header + image->macho_image.text_size - 1);
+        STAssertNotNULL(image, @"Failed to find image");
+        STAssertEqualCStrings(image->macho_image.name, "first", @"Overlapping range did not resolve to the first appended image");
+
+        STAssertNULL(plcrash_async_image_containing_address(&_list, header + image->macho_image.text_size), @"Should not return an image for an address past the end of the range");
+    } plcrash_async_image_list_set_reading(&_list, false);
+}
+
 @end
@@ -167,4 +167,34 @@ using namespace plcrash::async;
     _list.assert_list_valid();
 }
 
+/* Test that removed nodes remain iterable by active readers, and are reclaimed once those readers complete. */
+- (void) testRetireNode {
+    _list.nasync_append(0);
+    _list.nasync_append(1);
+    _list.nasync_append(2);
+
+    /* Remove the node at which a reader is positioned */
+    _list.set_reading(true);
+    async_list<int>::node *item = _list.next(NULL);
+    _list.nasync_remove_node(item);
+    STAssertEquals(_list.nasync_retired_count(), (size_t) 1, @"Node should be retired while a reader is active");
+
+    item = _list.next(item);
+    STAssertNotNULL(item, @"Reader should continue iterating from a removed node");
+    STAssertEquals(item->value(), 1, @"Incorrect value");
+
+    /* A reader that begins and completes after the removal must not allow reclamation */
+    _list.set_reading(true);
+    _list.set_reading(false);
+    _list.nasync_append(3);
+    STAssertEquals(_list.nasync_retired_count(), (size_t) 1, @"Node was reclaimed while still referenced");
+    _list.set_reading(false);
+
+    /* Once all readers have completed, the node is recycled by the next update */
+    _list.nasync_append(4);
+    STAssertEquals(_list.nasync_retired_count(), (size_t) 0, @"Node was not reclaimed");
+
+    _list.assert_list_valid();
+}
+
 @end
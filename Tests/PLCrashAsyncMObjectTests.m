@@ -203,4 +203,42 @@
     plcrash_async_mobject_free(&mobj);
 }
 
+/**
+ * Test sharing of mappings via a bound mapping cache.
+ */
+- (void) testMappingCache {
+    size_t size = vm_page_size * 2;
+    uint8_t template[size];
+    plcrash_async_mapping_cache_t cache;
+    uint64_t hits, misses;
+
+    memset_pattern4(template, (const uint8_t[]){ 0xC, 0xA, 0xF, 0xE }, size);
+
+    plcrash_async_mapping_cache_init(&cache);
+    STAssertTrue(plcrash_async_mapping_cache_bind(&cache), @"Failed to bind cache");
+
+    /* Map the full range, and then a sub-range; the second mapping should be served from the first */
+    plcrash_async_mobject_t mobj;
+    plcrash_async_mobject_t submobj;
+    STAssertEquals(PLCRASH_ESUCCESS, plcrash_async_mobject_init(&mobj, mach_task_self(), (pl_vm_address_t)template, size, true), @"Failed to initialize mapping");
+    STAssertEquals(PLCRASH_ESUCCESS, plcrash_async_mobject_init(&submobj, mach_task_self(), (pl_vm_address_t)template + 16, 64, true), @"Failed to initialize mapping");
+
+    STAssertNotNULL(mobj.cache_entry, @"Mapping was not cached");
+    STAssertEquals(mobj.cache_entry, submobj.cache_entry, @"Mapping was not shared");
+    STAssertTrue(memcmp((void *)submobj.address, template + 16, 64) == 0, @"Shared mapping appears to be incorrect");
+    STAssertEquals((pl_vm_address_t)template + 16, (pl_vm_address_t) (submobj.address + submobj.vm_slide), @"Incorrect slide value!");
+    STAssertEquals(submobj.length, (pl_vm_size_t) 64, @"Incorrect length");
+
+    plcrash_async_mapping_cache_get_stats(&cache, &hits, &misses);
+    STAssertEquals(hits, (uint64_t) 1, @"Expected a single cache hit");
+    STAssertEquals(misses, (uint64_t) 1, @"Expected a single cache miss");
+
+    plcrash_async_mobject_free(&submobj);
+    plcrash_async_mobject_free(&mobj);
+
+    plcrash_async_mapping_cache_unbind(&cache);
+    STAssertNULL(plcrash_async_mapping_cache_bound(), @"Cache should be unbound");
+    plcrash_async_mapping_cache_free(&cache);
+}
+
 @end
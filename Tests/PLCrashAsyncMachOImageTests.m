@@ -290,6 +290,52 @@
 }
 
 
+/**
+ * Verify that lookups answered from the load command summary match those performed by walking the load commands.
+ */
+- (void) testLoadCommandSummary {
+    STAssertTrue(_image.summary.valid, @"Summary was not populated");
+
+    /* Disable the summary on a copy of the image to force the load command walk */
+    plcrash_async_macho_t walked = _image;
+    walked.summary.valid = false;
+
+    uint32_t cmds[] = { LC_UUID, LC_SYMTAB, LC_DYSYMTAB };
+    for (size_t i = 0; i < sizeof(cmds) / sizeof(cmds[0]); i++) {
+        STAssertEquals(plcrash_async_macho_find_command(&walked, cmds[i]), plcrash_async_macho_find_command(&_image, cmds[i]), @"Summary returned a different command for 0x%" PRIx32, cmds[i]);
+    }
+
+    const char *segnames[] = { "__TEXT", "__DATA", "__DATA_CONST", "__LINKEDIT", "__NO_SUCH_SEG" };
+    for (size_t i = 0; i < sizeof(segnames) / sizeof(segnames[0]); i++) {
+        STAssertEquals(plcrash_async_macho_find_segment_cmd(&walked, segnames[i]), plcrash_async_macho_find_segment_cmd(&_image, segnames[i]), @"Summary returned a different segment for %s", segnames[i]);
+    }
+
+    const char *sections[][2] = {
+        { "__TEXT", "__unwind_info" },
+        { "__TEXT", "__eh_frame" },
+        { "__DATA", "__objc_classlist" },
+        { "__DATA_CONST", "__objc_classlist" },
+        { "__DATA", "__NO_SUCH_SECT" }
+    };
+    for (size_t i = 0; i < sizeof(sections) / sizeof(sections[0]); i++) {
+        plcrash_async_mobject_t expected;
+        plcrash_async_mobject_t actual;
+        plcrash_error_t expected_err = plcrash_async_macho_map_section(&walked, sections[i][0], sections[i][1], &expected);
+        plcrash_error_t actual_err = plcrash_async_macho_map_section(&_image, sections[i][0], sections[i][1], &actual);
+
+        STAssertEquals(expected_err, actual_err, @"Summary returned a different result for (%s,%s)", sections[i][0], sections[i][1]);
+        if (expected_err == PLCRASH_ESUCCESS && actual_err == PLCRASH_ESUCCESS) {
+            STAssertEquals(expected.task_address, actual.task_address, @"Summary returned a different address for (%s,%s)", sections[i][0], sections[i][1]);
+            STAssertEquals(expected.length, actual.length, @"Summary returned a different length for (%s,%s)", sections[i][0], sections[i][1]);
+        }
+
+        if (expected_err == PLCRASH_ESUCCESS)
+            plcrash_async_mobject_free(&expected);
+        if (actual_err == PLCRASH_ESUCCESS)
+            plcrash_async_mobject_free(&actual);
+    }
+}
+
 /**
  * Test memory mapping of a missing Mach-O segment
  */
@@ -413,6 +459,57 @@ static void testFindSymbol_cb (pl_vm_address_t address, const char *name, void *
     STAssertEquals(dli.dli_saddr, (void *) ctx.addr, @"Returned incorrect symbol address with slide %" PRId64, (int64_t) _image.vmaddr_slide);
 }
 
+/**
+ * Verify that symbol lookups performed via the address-sorted symbol index return the same results as the linear
+ * symbol table search.
+ */
+- (void) testFindSymbolIndexed {
+    /* Initialize a second, indexed instance of our image */
+    plcrash_async_macho_t indexed;
+    plcrash_error_t res = plcrash_nasync_macho_init(&indexed, mach_task_self(), _image.name, _image.header_addr);
+    STAssertEquals(res, PLCRASH_ESUCCESS, @"Failed to initialize image");
+
+    STAssertNULL(indexed.symbol_index, @"Index should not be built by default");
+    res = plcrash_nasync_macho_build_symbol_index(&indexed);
+    STAssertEquals(res, PLCRASH_ESUCCESS, @"Failed to build symbol index");
+    STAssertNotNULL(indexed.symbol_index, @"Symbol index was not published");
+    STAssertTrue(indexed.symbol_index->count > 0, @"Symbol index is empty");
+
+    /* Verify ordering and uniqueness */
+    plcrash_async_macho_symbol_index_t *index = indexed.symbol_index;
+    for (uint32_t i = 1; i < index->count; i++)
+        STAssertTrue(index->entries[i-1].n_value < index->entries[i].n_value, @"Index is not strictly sorted at %" PRIu32, i);
+
+    /* Compare lookups at, after, and prior to each indexed symbol against the linear search */
+    for (uint32_t i = 0; i < index->count; i++) {
+        pl_vm_address_t base = index->entries[i].n_value + _image.vmaddr_slide;
+        pl_vm_address_t pcs[] = { base, base + 1, base - 1 };
+
+        for (size_t j = 0; j < sizeof(pcs) / sizeof(pcs[0]); j++) {
+            struct testFindSymbol_cb_ctx expected = { 0, NULL };
+            struct testFindSymbol_cb_ctx actual = { 0, NULL };
+
+            plcrash_error_t expected_res = plcrash_async_macho_find_symbol_by_pc(&_image, pcs[j], testFindSymbol_cb, &expected);
+            plcrash_error_t actual_res = plcrash_async_macho_find_symbol_by_pc(&indexed, pcs[j], testFindSymbol_cb, &actual);
+
+            STAssertEquals(expected_res, actual_res, @"Indexed lookup result differs for 0x%" PRIx64, (uint64_t) pcs[j]);
+            if (expected_res == PLCRASH_ESUCCESS && actual_res == PLCRASH_ESUCCESS) {
+                STAssertEquals(expected.addr, actual.addr, @"Indexed lookup address differs for 0x%" PRIx64, (uint64_t) pcs[j]);
+                STAssertEqualCStrings(expected.name, actual.name, @"Indexed lookup name differs for 0x%" PRIx64, (uint64_t) pcs[j]);
+            }
+
+            free(expected.name);
+            free(actual.name);
+        }
+    }
+
+    /* Building the index again should be a no-op */
+    STAssertEquals(plcrash_nasync_macho_build_symbol_index(&indexed), PLCRASH_ESUCCESS, @"Failed to rebuild symbol index");
+    STAssertTrue(index == indexed.symbol_index, @"Symbol index should not be rebuilt");
+
+    plcrash_nasync_macho_free(&indexed);
+}
+
 /**
  * Test lookup of symbols by name.
  */
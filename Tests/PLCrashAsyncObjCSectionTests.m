@@ -41,6 +41,10 @@ static void parse_callback_trampoline(bool isClassMethod, plcrash_async_macho_st
     block(isClassMethod, className, methodName, imp);
 }
 
+static void method_index_count_callback (bool isClassMethod, plcrash_async_macho_string_t *className, plcrash_async_macho_string_t *methodName, pl_vm_address_t imp, void *ctx) {
+    (*(int *) ctx)++;
+}
+
 @interface PLCrashAsyncObjCSectionTests : SenTestCase {
     plcrash_async_objc_cache_t objCContext;
     
@@ -255,6 +259,40 @@ static void parse_callback_trampoline(bool isClassMethod, plcrash_async_macho_st
     STAssertEquals(err, PLCRASH_ESUCCESS, @"ObjC parse failed");
 }
 
+/**
+ * Verify that repeated lookups within a single image are served from a single cached method index.
+ */
+- (void) testMethodIndexReuse {
+    int called = 0;
+    pl_vm_address_t pc = [[self class] addressInClassMethod];
+
+    plcrash_error_t firstErr = plcrash_async_objc_find_method(&_image, &objCContext, pc, method_index_count_callback, &called);
+    int firstCalls = called;
+
+    /* Exactly one index should have been populated for our image */
+    size_t populated = 0;
+    plcrash_async_objc_method_index_t *index = NULL;
+    for (size_t i = 0; i < PLCRASH_ASYNC_OBJC_METHOD_INDEX_COUNT; i++) {
+        if (objCContext.methodIndexes[i].image != NULL) {
+            populated++;
+            index = &objCContext.methodIndexes[i];
+        }
+    }
+    STAssertEquals(populated, (size_t)1, @"Expected a single populated method index");
+    STAssertTrue(index->image == &_image, @"Index populated for the wrong image");
+    plcrash_async_objc_method_index_entry_t *entries = index->entries;
+
+    /* The index entries must be sorted by IMP */
+    for (size_t i = 1; i < index->count; i++)
+        STAssertTrue(index->entries[i-1].imp <= index->entries[i].imp, @"Method index is not sorted");
+
+    /* A second lookup must reuse the existing index, and produce the same result */
+    plcrash_error_t secondErr = plcrash_async_objc_find_method(&_image, &objCContext, pc, method_index_count_callback, &called);
+    STAssertEquals(firstErr, secondErr, @"Lookup results differ");
+    STAssertEquals(called, firstCalls * 2, @"Callback counts differ");
+    STAssertTrue(index->entries == entries, @"Method index was rebuilt");
+}
+
 @end
 
 @implementation PLCrashAsyncObjCSectionTests (Category)
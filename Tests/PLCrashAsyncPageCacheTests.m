@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#import "SenTestCompat.h"
+
+#import "PLCrashAsyncPageCache.h"
+
+@interface PLCrashAsyncPageCacheTests : SenTestCase {
+@private
+    plcrash_async_page_cache_t _cache;
+}
+@end
+
+@implementation PLCrashAsyncPageCacheTests
+
+- (void) setUp {
+    STAssertEquals(plcrash_async_page_cache_init(&_cache), PLCRASH_ESUCCESS, @"Failed to initialize cache");
+}
+
+- (void) tearDown {
+    plcrash_async_page_cache_free(&_cache);
+}
+
+/* Test reading through the cache, including reads that span a page boundary. */
+- (void) testCachedReads {
+    size_t len = _cache.page_size * 2;
+    uint8_t *source = malloc(len);
+    uint8_t dest[32];
+    uint64_t hits, misses;
+
+    for (size_t i = 0; i < len; i++)
+        source[i] = (uint8_t) i;
+
+    /* The first read from a page is a miss; subsequent reads from the same page are hits */
+    STAssertEquals(plcrash_async_page_cache_memcpy(&_cache, mach_task_self(), (pl_vm_address_t) source, 0, dest, 8), PLCRASH_ESUCCESS, @"Read failed");
+    STAssertTrue(memcmp(dest, source, 8) == 0, @"Incorrect data read");
+
+    STAssertEquals(plcrash_async_page_cache_memcpy(&_cache, mach_task_self(), (pl_vm_address_t) source, 8, dest, 8), PLCRASH_ESUCCESS, @"Read failed");
+    STAssertTrue(memcmp(dest, source + 8, 8) == 0, @"Incorrect data read");
+
+    plcrash_async_page_cache_get_stats(&_cache, &hits, &misses);
+    STAssertEquals(misses, (uint64_t) 1, @"Expected a single miss");
+    STAssertEquals(hits, (uint64_t) 1, @"Expected a single hit");
+
+    /* Read across the page boundary following source */
+    pl_vm_address_t boundary = ((pl_vm_address_t) source + _cache.page_size) & ~((pl_vm_address_t) _cache.page_size - 1);
+    pl_vm_off_t offset = (pl_vm_off_t) (boundary - (pl_vm_address_t) source) - (pl_vm_off_t) (sizeof(dest) / 2);
+    STAssertEquals(plcrash_async_page_cache_memcpy(&_cache, mach_task_self(), (pl_vm_address_t) source, offset, dest, sizeof(dest)), PLCRASH_ESUCCESS, @"Read failed");
+    STAssertTrue(memcmp(dest, source + offset, sizeof(dest)) == 0, @"Incorrect data read across a page boundary");
+
+    /* Reads from the bound thread are made through the cache */
+    uint64_t prev_hits = 0;
+    plcrash_async_page_cache_get_stats(&_cache, &prev_hits, &misses);
+    STAssertNULL(plcrash_async_page_cache_bound(), @"No cache should be bound");
+    STAssertTrue(plcrash_async_page_cache_bind(&_cache), @"Failed to bind cache");
+    STAssertEquals(plcrash_async_page_cache_bound(), &_cache, @"Incorrect bound cache");
+
+    STAssertEquals(plcrash_async_task_memcpy(mach_task_self(), (pl_vm_address_t) source, 0, dest, 8), PLCRASH_ESUCCESS, @"Read failed");
+    plcrash_async_page_cache_unbind(&_cache);
+    STAssertNULL(plcrash_async_page_cache_bound(), @"Cache should be unbound");
+
+    plcrash_async_page_cache_get_stats(&_cache, &hits, &misses);
+    STAssertEquals(hits, prev_hits + 1, @"Bound read did not use the cache");
+
+    free(source);
+}
+
+/* Test that a cache bound while another cache is bound shadows it until unbound, as when a crash report is written
+ * while a live report is in progress on the same thread. */
+- (void) testNestedBinding {
+    plcrash_async_page_cache_t inner;
+    STAssertEquals(plcrash_async_page_cache_init(&inner), PLCRASH_ESUCCESS, @"Failed to initialize cache");
+
+    STAssertTrue(plcrash_async_page_cache_bind(&_cache), @"Failed to bind cache");
+    STAssertTrue(plcrash_async_page_cache_bind(&inner), @"Failed to bind nested cache");
+    STAssertEquals(plcrash_async_page_cache_bound(), &inner, @"The most recently bound cache should be used");
+
+    /* A cache may only be bound once */
+    STAssertFalse(plcrash_async_page_cache_bind(&_cache), @"Binding an already bound cache should fail");
+    STAssertEquals(plcrash_async_page_cache_bound(), &inner, @"The most recently bound cache should be used");
+
+    plcrash_async_page_cache_unbind(&inner);
+    STAssertEquals(plcrash_async_page_cache_bound(), &_cache, @"The outer cache should be restored");
+
+    plcrash_async_page_cache_unbind(&_cache);
+    STAssertNULL(plcrash_async_page_cache_bound(), @"Cache should be unbound");
+
+    plcrash_async_page_cache_free(&inner);
+}
+
+/* Test that reads of unmapped memory return the same error as an uncached read. */
+- (void) testUnmappedRead {
+    uint8_t dest[8];
+    plcrash_error_t err = plcrash_async_page_cache_memcpy(&_cache, mach_task_self(), 0, 0, dest, sizeof(dest));
+    STAssertEquals(err, plcrash_async_task_memcpy_uncached(mach_task_self(), 0, 0, dest, sizeof(dest)), @"Unexpected result for an unmapped read");
+    STAssertNotEquals(err, PLCRASH_ESUCCESS, @"Read of the NULL page should fail");
+}
+
+@end
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+
+#import "SenTestCompat.h"
+
+#import "PLCrashAsyncStringTable.h"
+
+@interface PLCrashAsyncStringTableTests : SenTestCase {
+@private
+    plcrash_async_string_table_t _table;
+}
+@end
+
+@implementation PLCrashAsyncStringTableTests
+
+- (void) setUp {
+    STAssertEquals(plcrash_async_string_table_init(&_table), PLCRASH_ESUCCESS, @"Failed to initialize table");
+}
+
+- (void) tearDown {
+    plcrash_async_string_table_free(&_table);
+}
+
+/**
+ * Reassemble the full value of the entry at @a index.
+ */
+- (NSString *) valueForEntry: (uint32_t) index {
+    NSMutableString *value = [NSMutableString string];
+    while (index != 0) {
+        uint32_t prefix;
+        size_t length;
+        const char *str = plcrash_async_string_table_get(&_table, index, &prefix, &length);
+        STAssertNotNULL(str, @"Invalid entry index %u", index);
+        if (str == NULL)
+            return nil;
+
+        STAssertEquals(strlen(str), length, @"Incorrect entry length");
+        STAssertTrue(prefix < index, @"Prefix entries must precede the entries that reference them");
+        [value insertString: [NSString stringWithUTF8String: str] atIndex: 0];
+        index = prefix;
+    }
+    return value;
+}
+
+/* Test interning of plain strings */
+- (void) testIntern {
+    uint32_t a = plcrash_async_string_table_intern(&_table, 0, "objc_msgSend", strlen("objc_msgSend"));
+    uint32_t b = plcrash_async_string_table_intern(&_table, 0, "mach_msg_trap", strlen("mach_msg_trap"));
+    STAssertEquals(a, (uint32_t) 1, @"Entries should be indexed from 1");
+    STAssertEquals(b, (uint32_t) 2, @"Entries should be indexed in order");
+
+    /* Interning an existing string returns the existing entry; the string need not be NUL-terminated */
+    const char *str = "objc_msgSendSuper";
+    STAssertEquals(plcrash_async_string_table_intern(&_table, 0, str, strlen("objc_msgSend")), a, @"Existing entry not returned");
+    STAssertEquals(plcrash_async_string_table_count(&_table), (uint32_t) 2, @"Unexpected entry count");
+
+    /* Entries with differing prefixes are distinct */
+    uint32_t c = plcrash_async_string_table_intern(&_table, b, "objc_msgSend", strlen("objc_msgSend"));
+    STAssertNotEquals(c, a, @"Entries with differing prefixes should be distinct");
+    STAssertEqualObjects([self valueForEntry: c], @"mach_msg_trapobjc_msgSend", @"Incorrect entry value");
+
+    /* Invalid prefixes are rejected */
+    STAssertEquals(plcrash_async_string_table_intern(&_table, 100, "x", 1), (uint32_t) 0, @"Invalid prefix accepted");
+    STAssertNULL(plcrash_async_string_table_get(&_table, 0, NULL, NULL), @"Invalid index accepted");
+}
+
+/* Test interning of paths that share directory prefixes */
+- (void) testInternPath {
+    uint32_t uikit = plcrash_async_string_table_intern_path(&_table, "/System/Library/Frameworks/UIKit.framework/UIKit");
+    uint32_t count = plcrash_async_string_table_count(&_table);
+    STAssertEquals(count, (uint32_t) 6, @"Expected one entry per path component");
+
+    uint32_t foundation = plcrash_async_string_table_intern_path(&_table, "/System/Library/Frameworks/Foundation.framework/Foundation");
+    STAssertEquals(plcrash_async_string_table_count(&_table), count + 2, @"Shared directory prefix was not reused");
+
+    STAssertEquals(plcrash_async_string_table_intern_path(&_table, "/System/Library/Frameworks/UIKit.framework/UIKit"), uikit, @"Existing path not returned");
+
+    STAssertEqualObjects([self valueForEntry: uikit], @"/System/Library/Frameworks/UIKit.framework/UIKit", @"Incorrect path value");
+    STAssertEqualObjects([self valueForEntry: foundation], @"/System/Library/Frameworks/Foundation.framework/Foundation", @"Incorrect path value");
+
+    /* Relative, directory, and empty paths */
+    STAssertEqualObjects([self valueForEntry: plcrash_async_string_table_intern_path(&_table, "dyld")], @"dyld", @"Incorrect path value");
+    STAssertEqualObjects([self valueForEntry: plcrash_async_string_table_intern_path(&_table, "/usr/lib/")], @"/usr/lib/", @"Incorrect path value");
+
+    uint32_t empty = plcrash_async_string_table_intern_path(&_table, "");
+    STAssertNotEquals(empty, (uint32_t) 0, @"Empty path was not interned");
+    STAssertEqualObjects([self valueForEntry: empty], @"", @"Incorrect path value");
+}
+
+/* Test that interning fails once the table is full, without affecting existing entries */
+- (void) testCapacity {
+    char name[32];
+    uint32_t index = 0;
+
+    for (uint32_t i = 0; i < PLCRASH_ASYNC_STRING_TABLE_MAX_ENTRIES; i++) {
+        snprintf(name, sizeof(name), "symbol_%u", i);
+        index = plcrash_async_string_table_intern(&_table, 0, name, strlen(name));
+        STAssertEquals(index, i + 1, @"Failed to intern entry %u", i);
+        if (index != i + 1)
+            return;
+    }
+
+    STAssertEquals(plcrash_async_string_table_intern(&_table, 0, "overflow", strlen("overflow")), (uint32_t) 0, @"Full table accepted a new entry");
+    STAssertEquals(plcrash_async_string_table_intern(&_table, 0, "symbol_42", strlen("symbol_42")), (uint32_t) 43, @"Existing entry not found in full table");
+}
+
+@end
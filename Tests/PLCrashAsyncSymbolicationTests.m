@@ -117,6 +117,43 @@ void PLCrashAsyncLocalSymbolicationTestsDummyFunction(void) {}
     plcrash_async_symbol_cache_free(&findContext);
 }
 
+/**
+ * Verify that repeated lookups of the same PC are served from the symbol cache.
+ */
+- (void) testCachedLookup {
+    struct testFindSymbol_cb_ctx ctx = {};
+    plcrash_async_symbol_cache_t findContext;
+    uint64_t hits, misses;
+    plcrash_error_t err;
+
+    err = plcrash_async_symbol_cache_init(&findContext);
+    STAssertEquals(err, PLCRASH_ESUCCESS, @"Failed to initialize symbol cache");
+
+    pl_vm_address_t pc = (pl_vm_address_t)PLCrashAsyncLocalSymbolicationTestsDummyFunction;
+    for (int i = 0; i < 3; i++) {
+        ctx.addr = 0;
+        free(ctx.name);
+        ctx.name = NULL;
+
+        err = plcrash_async_find_symbol(&_image, PLCRASH_ASYNC_SYMBOL_STRATEGY_SYMBOL_TABLE, &findContext, pc, testFindSymbol_cb, &ctx);
+        STAssertEquals(err, PLCRASH_ESUCCESS, @"Got error trying to find symbol");
+        STAssertEquals(ctx.addr, pc, @"Got bad address finding symbol");
+        STAssertEqualCStrings(ctx.name, "_PLCrashAsyncLocalSymbolicationTestsDummyFunction", @"Got wrong symbol name");
+    }
+
+    plcrash_async_symbol_cache_get_stats(&findContext, &hits, &misses);
+    STAssertEquals(misses, (uint64_t)1, @"Expected a single uncached lookup");
+    STAssertEquals(hits, (uint64_t)2, @"Expected repeated lookups to be cached");
+
+    /* A lookup using a different strategy must not be served from the cache */
+    plcrash_async_find_symbol(&_image, PLCRASH_ASYNC_SYMBOL_STRATEGY_ALL, &findContext, pc, testFindSymbol_cb, &ctx);
+    plcrash_async_symbol_cache_get_stats(&findContext, &hits, &misses);
+    STAssertEquals(misses, (uint64_t)2, @"Lookup with a different strategy was served from the cache");
+
+    free(ctx.name);
+    plcrash_async_symbol_cache_free(&findContext);
+}
+
 - (void) testStrategyFlags {
     XCTSkip(@"ERROR: testStrategyFlags, ((err) equal to (PLCRASH_ESUCCESS)) failed: ('8') is not equal to ('0') - Got error trying to find symbol (line 138)");
 
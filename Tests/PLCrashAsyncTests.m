@@ -197,6 +197,92 @@
     STAssertTrue(dest[1024] == (uint8_t)0xB, @"Sentinal was overwritten (0x%" PRIX8 ")", dest[1024]);
 }
 
+/**
+ * Verify that the word-at-a-time memory primitives match libc across sizes and relative alignments.
+ */
+- (void) testMemoryPrimitiveEquivalence {
+    uint8_t src[512 + 16];
+    uint8_t dest[512 + 32];
+    uint8_t expected[512 + 32];
+
+    for (size_t i = 0; i < sizeof(src); i++)
+        src[i] = (uint8_t) (i * 7 + 3);
+
+    for (size_t n = 0; n <= 512; n += (n < 64 ? 1 : 37)) {
+        for (size_t src_off = 0; src_off < 16; src_off += 3) {
+            for (size_t dest_off = 0; dest_off < 16; dest_off += 5) {
+                memset(dest, 0xEE, sizeof(dest));
+                memset(expected, 0xEE, sizeof(expected));
+                plcrash_async_memcpy(dest + dest_off, src + src_off, n);
+                memcpy(expected + dest_off, src + src_off, n);
+                STAssertTrue(memcmp(dest, expected, sizeof(dest)) == 0, @"memcpy mismatch (n=%zu, src+%zu, dest+%zu)", n, src_off, dest_off);
+
+                plcrash_async_memset(dest + dest_off, (uint8_t) n, n);
+                memset(expected + dest_off, (uint8_t) n, n);
+                STAssertTrue(memcmp(dest, expected, sizeof(dest)) == 0, @"memset mismatch (n=%zu, dest+%zu)", n, dest_off);
+            }
+        }
+    }
+}
+
+/**
+ * Verify that the word-at-a-time string comparisons match libc, including differences and terminators at every
+ * position within a word, for both matching and mismatched alignments.
+ */
+- (void) testStringCompareEquivalence {
+    char s1[64 + 8];
+    char s2[64 + 8];
+
+#define SIGN(x) (((x) > 0) - ((x) < 0))
+    for (size_t len = 0; len < 40; len++) {
+        for (size_t off1 = 0; off1 < 8; off1++) {
+            for (size_t off2 = 0; off2 < 8; off2 += 7) {
+                char *a = s1 + off1;
+                char *b = s2 + off2;
+
+                for (size_t i = 0; i < len; i++)
+                    a[i] = (char) ('a' + (i % 26));
+                a[len] = '\0';
+
+                /* Equal strings, then a difference (or early terminator) at each position */
+                for (size_t diff = 0; diff <= len; diff++) {
+                    memcpy(b, a, len + 1);
+                    if (diff < len)
+                        b[diff] = (diff % 3 == 0) ? '\0' : (char) (a[diff] + ((diff & 1) ? 1 : -1));
+
+                    STAssertEquals(SIGN(plcrash_async_strcmp(a, b)), SIGN(strcmp(a, b)), @"strcmp mismatch (len=%zu, diff=%zu)", len, diff);
+                    for (size_t n = 0; n <= len + 1; n++)
+                        STAssertEquals(SIGN(plcrash_async_strncmp(a, b, n)), SIGN(strncmp(a, b, n)), @"strncmp mismatch (len=%zu, diff=%zu, n=%zu)", len, diff, n);
+                }
+            }
+        }
+    }
+#undef SIGN
+}
+
+/**
+ * Measure memcpy/memset throughput across sizes from 1 byte to 64KB.
+ */
+- (void) testMemoryPrimitivePerformance {
+    size_t max = 64 * 1024;
+    uint8_t *src = malloc(max);
+    uint8_t *dest = malloc(max);
+    memset(src, 0xAB, max);
+
+    [self measureBlock: ^{
+        for (size_t size = 1; size <= max; size *= 2) {
+            size_t iterations = (1024 * 1024) / size;
+            for (size_t i = 0; i < iterations; i++) {
+                plcrash_async_memcpy(dest, src, size);
+                plcrash_async_memset(dest, (uint8_t) i, size);
+            }
+        }
+    }];
+
+    free(src);
+    free(dest);
+}
+
 - (void) testWriteLimits {
     plcrash_async_file_t file;
     uint32_t data = 1;
@@ -274,4 +360,145 @@
     [input close];
 }
 
+/**
+ * Verify that previously written data may be rewritten, both within the buffer and after
+ * it has been flushed to disk.
+ */
+- (void) testRewrite {
+    plcrash_async_file_t file;
+    unsigned char data[sizeof(file.buffer) + 145];
+    uint32_t marker = 0xCAFEF00D;
+
+    /* Initialize the file instance */
+    plcrash_async_file_init(&file, _testFd, 0);
+
+    /* Create test data */
+    for (size_t i = 0; i < sizeof(data); i++)
+        data[i] = (unsigned char) i;
+
+    /* Write a single byte, followed by a write larger than the buffer; this will flush both to disk. */
+    STAssertTrue(plcrash_async_file_write(&file, data, 1), @"Failed to write to output buffer");
+    STAssertEquals(plcrash_async_file_offset(&file), (off_t)1, @"Incorrect offset");
+    STAssertTrue(plcrash_async_file_write(&file, data + 1, sizeof(file.buffer) + 44), @"Failed to write to output buffer");
+
+    /* Write the remainder, which will be buffered */
+    STAssertTrue(plcrash_async_file_write(&file, data + sizeof(file.buffer) + 45, 100), @"Failed to write to output buffer");
+    STAssertEquals(plcrash_async_file_offset(&file), (off_t)sizeof(data), @"Incorrect offset");
+    STAssertEquals(file.buflen, (size_t)100, @"Unexpected buffer length");
+
+    /* Rewrite a flushed range, a buffered range, and a range that spans the buffered and flushed data */
+    off_t buffered_offset = sizeof(data) - file.buflen;
+    STAssertTrue(plcrash_async_file_rewrite(&file, 2, &marker, sizeof(marker)), @"Failed to rewrite flushed data");
+    STAssertTrue(plcrash_async_file_rewrite(&file, sizeof(data) - sizeof(marker), &marker, sizeof(marker)), @"Failed to rewrite buffered data");
+    STAssertTrue(plcrash_async_file_rewrite(&file, buffered_offset - 2, &marker, sizeof(marker)), @"Failed to rewrite data spanning the buffer");
+    memcpy(data + 2, &marker, sizeof(marker));
+    memcpy(data + sizeof(data) - sizeof(marker), &marker, sizeof(marker));
+    memcpy(data + buffered_offset - 2, &marker, sizeof(marker));
+
+    /* Data that has not yet been written may not be rewritten */
+    STAssertFalse(plcrash_async_file_rewrite(&file, sizeof(data) - 1, &marker, sizeof(marker)), @"Rewrite past end of output was accepted");
+
+    /* Flush pending data and close the file */
+    STAssertTrue(plcrash_async_file_flush(&file), @"File flush failed");
+    STAssertTrue(plcrash_async_file_close(&file), @"File not closed");
+
+    /* Validate the test file */
+    NSData *written = [NSData dataWithContentsOfFile: _outputFile];
+    STAssertNotNil(written, @"Failed to read output file");
+    STAssertEquals((NSUInteger)sizeof(data), [written length], @"Incorrect file size");
+    STAssertTrue(memcmp([written bytes], data, sizeof(data)) == 0, @"Rewritten data does not match");
+}
+
+/**
+ * Verify output through a caller-supplied buffer, including writes large enough to bypass the buffer.
+ */
+- (void) testExternalBuffer {
+    plcrash_async_file_t file;
+    char buffer[64];
+    unsigned char data[200];
+
+    plcrash_async_file_init(&file, _testFd, 0);
+    plcrash_async_file_set_buffer(&file, buffer, sizeof(buffer));
+
+    for (size_t i = 0; i < sizeof(data); i++)
+        data[i] = (unsigned char) i;
+
+    /* Small writes are buffered; a large write is emitted along with the pending buffered bytes */
+    STAssertTrue(plcrash_async_file_write(&file, data, 10), @"Failed to write to output buffer");
+    STAssertTrue(plcrash_async_file_write(&file, data + 10, 20), @"Failed to write to output buffer");
+    STAssertEquals(plcrash_async_file_write_ops(&file), (size_t)0, @"Small writes were not buffered");
+
+    STAssertTrue(plcrash_async_file_write(&file, data + 30, 150), @"Failed to write to output buffer");
+    STAssertEquals(plcrash_async_file_write_ops(&file), (size_t)1, @"Large write was not coalesced with buffered data");
+    STAssertEquals(file.buflen, (size_t)0, @"Buffer was not drained");
+
+    STAssertTrue(plcrash_async_file_write(&file, data + 180, 20), @"Failed to write to output buffer");
+    STAssertTrue(plcrash_async_file_flush(&file), @"File flush failed");
+    STAssertTrue(plcrash_async_file_close(&file), @"File not closed");
+
+    NSData *written = [NSData dataWithContentsOfFile: _outputFile];
+    STAssertEquals((NSUInteger)sizeof(data), [written length], @"Incorrect file size");
+    STAssertTrue(memcmp([written bytes], data, sizeof(data)) == 0, @"Written data does not match");
+}
+
+/**
+ * Verify that writes that fit within the default buffer are buffered, and that only writes exceeding its capacity
+ * bypass it.
+ */
+- (void) testDefaultBufferBypass {
+    plcrash_async_file_t file;
+    unsigned char data[PLCRASH_ASYNC_FILE_DEFAULT_BUFFER_SIZE + 1];
+
+    plcrash_async_file_init(&file, _testFd, 0);
+
+    for (size_t i = 0; i < sizeof(data); i++)
+        data[i] = (unsigned char) i;
+
+    STAssertTrue(plcrash_async_file_write(&file, data, PLCRASH_ASYNC_FILE_DEFAULT_BUFFER_SIZE / 2), @"Failed to write to output buffer");
+    STAssertEquals(plcrash_async_file_write_ops(&file), (size_t)0, @"Write of half the default buffer was not buffered");
+
+    STAssertTrue(plcrash_async_file_write(&file, data, sizeof(data)), @"Failed to write to output buffer");
+    STAssertEquals(plcrash_async_file_write_ops(&file), (size_t)1, @"Oversized write was not coalesced with buffered data");
+
+    STAssertTrue(plcrash_async_file_close(&file), @"File not closed");
+}
+
+- (void) testMemoryOutput {
+    plcrash_async_file_t file;
+    unsigned char data[(4 * 4096) + 145];
+    uint32_t marker = 0xCAFEF00D;
+    size_t length;
+
+    plcrash_async_file_init_memory(&file, 0);
+
+    /* Create test data */
+    for (size_t i = 0; i < sizeof(data); i++)
+        data[i] = (unsigned char) i;
+
+    /* Nothing has been flushed */
+    STAssertNULL(plcrash_async_file_memory_bytes(&file, &length), @"Unexpected output");
+    STAssertEquals(length, (size_t)0, @"Unexpected output length");
+
+    /* Write enough data to require growing the output region, followed by buffered data */
+    STAssertTrue(plcrash_async_file_write(&file, data, 1), @"Failed to write to output buffer");
+    STAssertTrue(plcrash_async_file_write(&file, data + 1, sizeof(data) - 101), @"Failed to write to output buffer");
+    STAssertTrue(plcrash_async_file_write(&file, data + sizeof(data) - 100, 100), @"Failed to write to output buffer");
+    STAssertEquals(plcrash_async_file_offset(&file), (off_t)sizeof(data), @"Incorrect offset");
+
+    /* Rewrite flushed and buffered ranges */
+    STAssertTrue(plcrash_async_file_rewrite(&file, 2, &marker, sizeof(marker)), @"Failed to rewrite flushed data");
+    STAssertTrue(plcrash_async_file_rewrite(&file, sizeof(data) - sizeof(marker), &marker, sizeof(marker)), @"Failed to rewrite buffered data");
+    memcpy(data + 2, &marker, sizeof(marker));
+    memcpy(data + sizeof(data) - sizeof(marker), &marker, sizeof(marker));
+
+    /* Validate the output */
+    STAssertTrue(plcrash_async_file_flush(&file), @"File flush failed");
+    const void *bytes = plcrash_async_file_memory_bytes(&file, &length);
+    STAssertNotNULL(bytes, @"No output");
+    STAssertEquals(length, sizeof(data), @"Incorrect output length");
+    STAssertTrue(memcmp(bytes, data, sizeof(data)) == 0, @"Output does not match");
+
+    STAssertTrue(plcrash_async_file_close(&file), @"File not closed");
+}
+
 @end
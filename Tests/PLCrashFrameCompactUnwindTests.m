@@ -27,8 +27,12 @@
 
 #import "SenTestCompat.h"
 #import "PLCrashFrameCompactUnwind.h"
+#import "PLCrashFrameUnwindPlan.h"
 #import "PLCrashFeatureConfig.h"
 
+#import <dlfcn.h>
+#import <objc/runtime.h>
+
 #if PLCRASH_FEATURE_UNWIND_COMPACT
 
 /**
@@ -75,6 +79,86 @@
     STAssertEquals(err, PLFRAME_ENOTSUP, @"Unexpected result for a frame missing a valid image");
 }
 
+/* Verify that the per-image compact unwind context is built when indexing is enabled, and produces the same
+ * results as the unindexed path. */
+- (void) testPersistentContext {
+    plcrash_async_image_list_t indexed_list;
+    plframe_stackframe_t frame;
+    plframe_stackframe_t next;
+    plframe_stackframe_t indexed_next;
+
+    /* Find our own image */
+    IMP localIMP = class_getMethodImplementation([self class], _cmd);
+    Dl_info dli;
+    STAssertTrue(dladdr((void *)localIMP, &dli) != 0, @"Failed to look up symbol");
+
+    /* Register the image with both an unindexed and an indexed list */
+    plcrash_nasync_image_list_init(&indexed_list, mach_task_self());
+    plcrash_nasync_image_list_set_indexing(&indexed_list, PLCRASH_ASYNC_IMAGE_INDEX_COMPACT_UNWIND);
+    plcrash_nasync_image_list_append(&indexed_list, (pl_vm_address_t) dli.dli_fbase, dli.dli_fname);
+    plcrash_nasync_image_list_append(&_image_list, (pl_vm_address_t) dli.dli_fbase, dli.dli_fname);
+
+    plcrash_async_image_list_set_reading(&indexed_list, true); {
+        plcrash_async_image_t *image = plcrash_async_image_list_next(&indexed_list, NULL);
+        STAssertNotNULL(image, @"Image should not be NULL");
+        STAssertNotNULL(image->compact_unwind, @"Image should have a compact unwind context");
+    } plcrash_async_image_list_set_reading(&indexed_list, false);
+
+    /* Both paths must produce identical results */
+    plcrash_async_thread_state_clear_all_regs(&frame.thread_state);
+    plcrash_async_thread_state_set_reg(&frame.thread_state, PLCRASH_REG_IP, (plcrash_greg_t) localIMP);
+
+    plframe_error_t err = plframe_cursor_read_compact_unwind(mach_task_self(), &_image_list, &frame, NULL, &next);
+    plframe_error_t indexed_err = plframe_cursor_read_compact_unwind(mach_task_self(), &indexed_list, &frame, NULL, &indexed_next);
+    STAssertEquals(indexed_err, err, @"Indexed lookup returned a different result");
+    if (err == PLFRAME_ESUCCESS) {
+        STAssertEquals(plcrash_async_thread_state_get_reg(&indexed_next.thread_state, PLCRASH_REG_IP),
+                       plcrash_async_thread_state_get_reg(&next.thread_state, PLCRASH_REG_IP), @"Indexed lookup returned a different frame");
+    }
+
+    plcrash_nasync_image_list_free(&indexed_list);
+}
+
+/* Verify that two PCs within a single function share a single cached plan. */
+- (void) testPlanSharedWithinFunction {
+    plframe_unwind_plan_cache_t plan_cache;
+    plframe_stackframe_t frame;
+    plframe_stackframe_t next;
+    uint64_t hits, misses;
+
+    /* Find our own image */
+    IMP localIMP = class_getMethodImplementation([self class], _cmd);
+    Dl_info dli;
+    STAssertTrue(dladdr((void *)localIMP, &dli) != 0, @"Failed to look up symbol");
+    plcrash_nasync_image_list_append(&_image_list, (pl_vm_address_t) dli.dli_fbase, dli.dli_fname);
+
+    STAssertEquals(plframe_unwind_plan_cache_init(&plan_cache), PLCRASH_ESUCCESS, @"Failed to initialize plan cache");
+    STAssertTrue(plframe_unwind_plan_cache_bind(&plan_cache), @"Failed to bind plan cache");
+
+    /* Read the function start, and a PC within the function body */
+    plcrash_async_thread_state_clear_all_regs(&frame.thread_state);
+    plcrash_async_thread_state_set_reg(&frame.thread_state, PLCRASH_REG_IP, (plcrash_greg_t) localIMP);
+    plframe_error_t err = plframe_cursor_read_compact_unwind(mach_task_self(), &_image_list, &frame, NULL, &next);
+
+    plcrash_async_thread_state_set_reg(&frame.thread_state, PLCRASH_REG_IP, ((plcrash_greg_t) localIMP) + 4);
+    plframe_error_t body_err = plframe_cursor_read_compact_unwind(mach_task_self(), &_image_list, &frame, NULL, &next);
+    STAssertEquals(body_err, err, @"PCs within a single function returned different results");
+
+    plframe_unwind_plan_cache_unbind(&plan_cache);
+
+    plframe_unwind_plan_cache_get_stats(&plan_cache, &hits, &misses);
+    STAssertEquals(hits, (uint64_t) 1, @"The second PC should have been satisfied by the first PC's plan");
+
+    size_t used = 0;
+    for (size_t i = 0; i < PLFRAME_UNWIND_PLAN_CACHE_ENTRIES; i++) {
+        if (plan_cache.entries[i].task != MACH_PORT_NULL)
+            used++;
+    }
+    STAssertEquals(used, (size_t) 1, @"PCs within a single function should share a single entry");
+
+    plframe_unwind_plan_cache_free(&plan_cache);
+}
+
 @end
 
 #endif /* PLCRASH_FEATURE_UNWIND_COMPACT */
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#import "SenTestCompat.h"
+
+#import "PLCrashFrameUnwindPlan.h"
+
+@interface PLCrashFrameUnwindPlanTests : SenTestCase {
+@private
+    plframe_unwind_plan_cache_t _cache;
+}
+@end
+
+@implementation PLCrashFrameUnwindPlanTests
+
+- (void) setUp {
+    STAssertEquals(plframe_unwind_plan_cache_init(&_cache), PLCRASH_ESUCCESS, @"Failed to initialize cache");
+}
+
+- (void) tearDown {
+    plframe_unwind_plan_cache_free(&_cache);
+}
+
+/* Test insertion and lookup of plans, including separation of plan types for the same PC. */
+- (void) testLookup {
+    plframe_unwind_plan_t plan;
+    const plframe_unwind_plan_t *cached;
+    uint64_t hits, misses;
+
+    STAssertNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x1000, PLFRAME_UNWIND_PLAN_TYPE_COMPACT), @"Lookup of an empty cache should fail");
+
+    plan.type = PLFRAME_UNWIND_PLAN_TYPE_COMPACT;
+    plan.compact.function_base = 0x800;
+    plan.compact.encoding = 0x04000000;
+    plframe_unwind_plan_cache_insert(&_cache, mach_task_self(), 0x1000, 0x1004, &plan);
+
+    cached = plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x1000, PLFRAME_UNWIND_PLAN_TYPE_COMPACT);
+    STAssertNotNULL(cached, @"Failed to find cached plan");
+    STAssertEquals(cached->compact.function_base, (pl_vm_address_t) 0x800, @"Incorrect function base");
+    STAssertEquals(cached->compact.encoding, (uint32_t) 0x04000000, @"Incorrect encoding");
+
+    /* Plans are keyed by type and task, as well as PC range */
+    STAssertNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x1000, PLFRAME_UNWIND_PLAN_TYPE_DWARF), @"Lookup of a different plan type should fail");
+    STAssertNULL(plframe_unwind_plan_cache_lookup(&_cache, MACH_PORT_DEAD, 0x1000, PLFRAME_UNWIND_PLAN_TYPE_COMPACT), @"Lookup from a different task should fail");
+    STAssertNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x1004, PLFRAME_UNWIND_PLAN_TYPE_COMPACT), @"Lookup of a PC outside the range should fail");
+
+    /* Replace the plan */
+    plan.compact.encoding = 0x02000000;
+    plframe_unwind_plan_cache_insert(&_cache, mach_task_self(), 0x1000, 0x1004, &plan);
+    cached = plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x1000, PLFRAME_UNWIND_PLAN_TYPE_COMPACT);
+    STAssertNotNULL(cached, @"Failed to find cached plan");
+    STAssertEquals(cached->compact.encoding, (uint32_t) 0x02000000, @"Plan was not replaced");
+
+    plframe_unwind_plan_cache_get_stats(&_cache, &hits, &misses);
+    STAssertEquals(hits, (uint64_t) 2, @"Incorrect hit count");
+    STAssertEquals(misses, (uint64_t) 4, @"Incorrect miss count");
+}
+
+/* Test that all PCs within a plan's range -- eg, two call sites within one function -- share a single entry. */
+- (void) testRangeLookup {
+    plframe_unwind_plan_t plan;
+    const plframe_unwind_plan_t *first;
+    const plframe_unwind_plan_t *second;
+    uint64_t hits, misses;
+
+    plan.type = PLFRAME_UNWIND_PLAN_TYPE_COMPACT;
+    plan.compact.function_base = 0x1000;
+    plan.compact.encoding = 0x04000000;
+    plframe_unwind_plan_cache_insert(&_cache, mach_task_self(), 0x1000, 0x1100, &plan);
+
+    first = plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x1010, PLFRAME_UNWIND_PLAN_TYPE_COMPACT);
+    second = plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x10F0, PLFRAME_UNWIND_PLAN_TYPE_COMPACT);
+    STAssertNotNULL(first, @"Failed to find cached plan");
+    STAssertEquals(first, second, @"PCs within a single function should share a single entry");
+
+    STAssertNotNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x1000, PLFRAME_UNWIND_PLAN_TYPE_COMPACT), @"Range start should be included");
+    STAssertNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x1100, PLFRAME_UNWIND_PLAN_TYPE_COMPACT), @"Range end should be excluded");
+    STAssertNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0xFFF, PLFRAME_UNWIND_PLAN_TYPE_COMPACT), @"PCs preceding the range should be excluded");
+
+    plframe_unwind_plan_cache_get_stats(&_cache, &hits, &misses);
+    STAssertEquals(hits, (uint64_t) 3, @"Incorrect hit count");
+    STAssertEquals(misses, (uint64_t) 2, @"Incorrect miss count");
+
+    /* Only a single entry should be in use */
+    size_t used = 0;
+    for (size_t i = 0; i < PLFRAME_UNWIND_PLAN_CACHE_ENTRIES; i++) {
+        if (_cache.entries[i].task != MACH_PORT_NULL)
+            used++;
+    }
+    STAssertEquals(used, (size_t) 1, @"Incorrect number of entries in use");
+}
+
+/* Test eviction of the least recently used plan. */
+- (void) testEviction {
+    plframe_unwind_plan_t plan;
+    plan.type = PLFRAME_UNWIND_PLAN_TYPE_COMPACT;
+    plan.compact.function_base = 0;
+    plan.compact.encoding = 0;
+
+    for (pl_vm_address_t pc = 0; pc < PLFRAME_UNWIND_PLAN_CACHE_ENTRIES; pc++)
+        plframe_unwind_plan_cache_insert(&_cache, mach_task_self(), pc, pc + 1, &plan);
+
+    /* Touch the first plan, making the second the least recently used */
+    STAssertNotNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0, PLFRAME_UNWIND_PLAN_TYPE_COMPACT), @"Failed to find cached plan");
+
+    plframe_unwind_plan_cache_insert(&_cache, mach_task_self(), PLFRAME_UNWIND_PLAN_CACHE_ENTRIES, PLFRAME_UNWIND_PLAN_CACHE_ENTRIES + 1, &plan);
+    STAssertNotNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0, PLFRAME_UNWIND_PLAN_TYPE_COMPACT), @"Recently used plan was evicted");
+    STAssertNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 1, PLFRAME_UNWIND_PLAN_TYPE_COMPACT), @"Least recently used plan was not evicted");
+    STAssertNotNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), PLFRAME_UNWIND_PLAN_CACHE_ENTRIES, PLFRAME_UNWIND_PLAN_TYPE_COMPACT), @"Failed to find inserted plan");
+}
+
+/* Test that negative results are cached independently of plans, and that skipped reader attempts are counted. */
+- (void) testNegativeResults {
+    plframe_unwind_plan_t plan;
+    plcrash_async_memset(&plan, 0, sizeof(plan));
+    plan.type = PLFRAME_UNWIND_PLAN_TYPE_DWARF_NONE;
+    plframe_unwind_plan_cache_insert(&_cache, mach_task_self(), 0x1000, 0x1001, &plan);
+
+    STAssertNotNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x1000, PLFRAME_UNWIND_PLAN_TYPE_DWARF_NONE), @"Failed to find negative result");
+    STAssertNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x1000, PLFRAME_UNWIND_PLAN_TYPE_DWARF), @"Negative result should not be returned as a plan");
+    STAssertNULL(plframe_unwind_plan_cache_lookup(&_cache, mach_task_self(), 0x1000, PLFRAME_UNWIND_PLAN_TYPE_COMPACT_NONE), @"Negative result returned for the wrong reader");
+
+    STAssertEquals(plframe_unwind_plan_cache_get_skipped(&_cache), (uint64_t) 0, @"Incorrect initial skip count");
+    plframe_unwind_plan_cache_note_skipped(&_cache);
+    plframe_unwind_plan_cache_note_skipped(&_cache);
+    STAssertEquals(plframe_unwind_plan_cache_get_skipped(&_cache), (uint64_t) 2, @"Incorrect skip count");
+}
+
+/* Test binding the cache to the calling thread. */
+- (void) testBinding {
+    STAssertNULL(plframe_unwind_plan_cache_bound(), @"No cache should be bound");
+    STAssertTrue(plframe_unwind_plan_cache_bind(&_cache), @"Failed to bind cache");
+    STAssertEquals(plframe_unwind_plan_cache_bound(), &_cache, @"Incorrect bound cache");
+
+    plframe_unwind_plan_cache_unbind(&_cache);
+    STAssertNULL(plframe_unwind_plan_cache_bound(), @"Cache should have been unbound");
+}
+
+@end
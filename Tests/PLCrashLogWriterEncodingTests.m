@@ -29,6 +29,7 @@
 #import "SenTestCompat.h"
 #import "PLCrashAsync.h"
 #import "PLCrashLogWriterEncoding.h"
+#import "PLCrashReport.pb-enc.h"
 
 #import "protobuf-c.h"
 #import "PLCrashLogWriterEncodingTests.pb-c.h"
@@ -151,4 +152,176 @@ TEST_PACK(EncoderTest__Enum, enum_, enum, ENCODER_TEST__ENUM__Value2, 14, PLPROT
     STAssertTrue(strcmp(et->string, str) == 0, @"Did not encode correct value");
 }
 
+/**
+ * Verify that a length-delimited field written with a reserved, fixed-width length slot is correctly decoded.
+ */
+- (void) testPackReservedLength {
+    uint8_t bytes[] = { 0xC, 0xA, 0xF, 0xE };
+    off_t length_offset;
+
+    size_t rv = plcrash_writer_pack_reserved_length(&_file, 15, &length_offset);
+    STAssertEquals(rv, (size_t)(1 + PLCRASH_WRITER_RESERVED_LENGTH_SIZE), @"Incorrect header size");
+    STAssertTrue(plcrash_async_file_write(&_file, bytes, sizeof(bytes)), @"Failed to write field data");
+    STAssertTrue(plcrash_writer_fill_reserved_length(&_file, length_offset, sizeof(bytes)), @"Failed to fill reserved length");
+    STAssertTrue(plcrash_async_file_flush(&_file), @"Failed to flush file");
+
+    NSData *data = [NSData dataWithContentsOfFile: _filePath];
+    STAssertNotNil(data, @"Failed to load encoded data");
+    if (data == nil)
+        return;
+
+    EncoderTest *et = encoder_test__unpack(NULL, [data length], [data bytes]);
+    STAssertNotNULL(et, @"Failed to decode test data");
+    if (et == NULL)
+        return;
+
+    STAssertTrue(et->has_bytes, @"Did not encode correct type");
+    STAssertEquals(et->bytes.len, sizeof(bytes), @"Encoded incorrect size");
+    STAssertTrue((memcmp(et->bytes.data, bytes, sizeof(bytes)) == 0), @"Did not encode correct value");
+}
+
+/**
+ * Verify that plcrash_writer_message_reserve() accounts for the varint write slack, and that a staged message is
+ * written in full.
+ */
+- (void) testStagedMessageReserve {
+    uint8_t staging[64];
+    plcrash_writer_message_t msg;
+    plcrash_writer_message_init(&msg, staging, sizeof(staging));
+
+    STAssertFalse(plcrash_writer_message_reserve(&msg, sizeof(staging)), @"Reserved without the varint slack");
+    STAssertTrue(plcrash_writer_message_reserve(&msg, sizeof(staging) - PLCRASH_WRITER_VARINT_SLACK), @"Failed to reserve message");
+
+    /* Pack a maximum-length varint as the 'uint64' field (7, varint wire type) */
+    msg.buffer[msg.length++] = (7 << 3);
+    msg.length += plcrash_writer_varint_pack(UINT64_MAX, msg.buffer + msg.length);
+
+    size_t rv = plcrash_writer_message_write(&_file, &msg);
+    STAssertEquals(rv, (size_t) 1 + PLCRASH_WRITER_VARINT_MAX_SIZE, @"Incorrect message length");
+    STAssertTrue(plcrash_async_file_flush(&_file), @"Failed to flush file");
+
+    NSData *data = [NSData dataWithContentsOfFile: _filePath];
+    STAssertNotNil(data, @"Failed to load encoded data");
+    if (data == nil)
+        return;
+
+    EncoderTest *et = encoder_test__unpack(NULL, [data length], [data bytes]);
+    STAssertNotNULL(et, @"Failed to decode test data");
+    if (et == NULL)
+        return;
+
+    STAssertTrue(et->has_uint64, @"Did not encode scalar field");
+    STAssertEquals(et->uint64, (uint64_t) UINT64_MAX, @"Did not encode correct value");
+}
+
+/* Frame values used by the frame encoding benchmarks */
+static const char *bench_symbol = "-[PLCrashLogWriterEncodingTests testStagedFramePerformance]";
+static const uint64_t bench_pc = 0x100004abc;
+static const uint64_t bench_start = 0x100004a00;
+
+/* The number of frames written per benchmark iteration */
+#define BENCH_FRAME_COUNT 100000
+
+/**
+ * Measure the throughput of symbolicated frame messages written via individual plcrash_writer_pack() calls, sizing
+ * each message prior to writing it. Compare with testStagedFramePerformance.
+ */
+- (void) testPerFieldFramePerformance {
+    [self measureBlock: ^{
+        plcrash_async_file_t file;
+        plcrash_async_file_init(&file, open("/dev/null", O_WRONLY), OFF_MAX);
+
+        for (uint32_t i = 0; i < BENCH_FRAME_COUNT; i++) {
+            uint32_t symbol_size = (uint32_t) (plcrash_writer_pack(NULL, PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_NUMBER, PLPROTOBUF_C_TYPE_STRING, bench_symbol) +
+                                               plcrash_writer_pack(NULL, PLCRASH_PB_CRASH_REPORT_SYMBOL__START_ADDRESS_NUMBER, PLPROTOBUF_C_TYPE_UINT64, &bench_start));
+            uint32_t frame_size = (uint32_t) (plcrash_writer_pack(NULL, PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__PC_NUMBER, PLPROTOBUF_C_TYPE_UINT64, &bench_pc) +
+                                              plcrash_writer_pack(NULL, PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__SYMBOL_NUMBER, PLPROTOBUF_C_TYPE_MESSAGE, &symbol_size)) + symbol_size;
+
+            plcrash_writer_pack(&file, PLCRASH_PB_CRASH_REPORT_THREAD__FRAMES_NUMBER, PLPROTOBUF_C_TYPE_MESSAGE, &frame_size);
+            plcrash_writer_pack(&file, PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__PC_NUMBER, PLPROTOBUF_C_TYPE_UINT64, &bench_pc);
+            plcrash_writer_pack(&file, PLCRASH_PB_CRASH_REPORT_THREAD_STACK_FRAME__SYMBOL_NUMBER, PLPROTOBUF_C_TYPE_MESSAGE, &symbol_size);
+            plcrash_writer_pack(&file, PLCRASH_PB_CRASH_REPORT_SYMBOL__NAME_NUMBER, PLPROTOBUF_C_TYPE_STRING, bench_symbol);
+            plcrash_writer_pack(&file, PLCRASH_PB_CRASH_REPORT_SYMBOL__START_ADDRESS_NUMBER, PLPROTOBUF_C_TYPE_UINT64, &bench_start);
+        }
+
+        plcrash_async_file_close(&file);
+    }];
+}
+
+/**
+ * Measure the throughput of symbolicated frame messages staged via the generated encoders and written with a single
+ * write per frame. Compare with testPerFieldFramePerformance.
+ */
+- (void) testStagedFramePerformance {
+    [self measureBlock: ^{
+        plcrash_async_file_t file;
+        plcrash_async_file_init(&file, open("/dev/null", O_WRONLY), OFF_MAX);
+
+        size_t namelen = strlen(bench_symbol);
+        for (uint32_t i = 0; i < BENCH_FRAME_COUNT; i++) {
+            uint8_t staging[512];
+            plcrash_writer_message_t msg;
+            plcrash_writer_message_init(&msg, staging, sizeof(staging));
+
+            size_t symbol_size = plcrash_pb_crash_report_symbol__name_size(namelen) + plcrash_pb_crash_report_symbol__start_address_size(bench_start);
+            size_t frame_size = plcrash_pb_crash_report_thread_stack_frame__pc_size(bench_pc) + plcrash_pb_crash_report_thread_stack_frame__symbol_size(symbol_size);
+            if (!plcrash_writer_message_reserve(&msg, plcrash_pb_crash_report_thread__frames_size(frame_size)))
+                break;
+
+            plcrash_pb_crash_report_thread__frames_pack_header(&msg, frame_size);
+            plcrash_pb_crash_report_thread_stack_frame__pc_pack(&msg, bench_pc);
+            plcrash_pb_crash_report_thread_stack_frame__symbol_pack_header(&msg, symbol_size);
+            plcrash_pb_crash_report_symbol__name_pack(&msg, bench_symbol, namelen);
+            plcrash_pb_crash_report_symbol__start_address_pack(&msg, bench_start);
+            plcrash_writer_message_write(&file, &msg);
+        }
+
+        plcrash_async_file_close(&file);
+    }];
+}
+
+/* Reference varint encoder, emitting one 7-bit group per iteration. Used to validate the encoder's packing kernels. */
+static size_t reference_varint_pack (uint64_t value, uint8_t *out) {
+    size_t rv = 0;
+    while (value >= 0x80) {
+        out[rv++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+    out[rv++] = (uint8_t) value;
+    return rv;
+}
+
+/* Return a random value, shifted to exercise all encoded varint lengths */
+static uint64_t random_varint_value (void) {
+    uint64_t value = ((uint64_t) arc4random() << 32) | arc4random();
+    return value >> arc4random_uniform(64);
+}
+
+/**
+ * Verify the shared varint packing kernel against a reference encoder over randomized values of every encoded length,
+ * including the kernel's write slack contract.
+ */
+- (void) testPackVarintRandomized {
+    for (uint32_t i = 0; i < 1000000; i++) {
+        uint64_t value = random_varint_value();
+        uint8_t expected[PLCRASH_WRITER_VARINT_MAX_SIZE];
+        uint8_t output[PLCRASH_WRITER_VARINT_MAX_SIZE + 1];
+
+        memset(output, 0xA5, sizeof(output));
+        size_t expected_len = reference_varint_pack(value, expected);
+        size_t len = plcrash_writer_varint_pack(value, output);
+
+        if (len != expected_len || plcrash_writer_varint_size(value) != expected_len || memcmp(output, expected, expected_len) != 0) {
+            STFail(@"Incorrect encoding of value 0x%llx", (unsigned long long) value);
+            return;
+        }
+
+        /* Writes must not extend past the documented slack */
+        if (output[PLCRASH_WRITER_VARINT_MAX_SIZE] != 0xA5) {
+            STFail(@"Write slack exceeded encoding value 0x%llx", (unsigned long long) value);
+            return;
+        }
+    }
+}
+
 @end
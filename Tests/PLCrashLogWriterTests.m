@@ -31,6 +31,7 @@
 #import "PLCrashLogWriter.h"
 #import "PLCrashFrameWalker.h"
 #import "PLCrashAsyncImageList.h"
+#import "PLCrashAsyncStringTable.h"
 #import "PLCrashReport.h"
 #import "PLCrashReport.pb-c.h"
 
@@ -45,6 +46,9 @@
 #import <mach-o/loader.h>
 #import <mach-o/dyld.h>
 
+#import <pthread.h>
+#import <stdatomic.h>
+
 #import "PLCrashTestThread.h"
 #import "PLCrashSysctl.h"
 
@@ -280,6 +284,11 @@
 }
 
 - (Plcrash__CrashReport *) loadReport {
+    return [self loadReportWithVersion: PLCRASH_REPORT_FILE_VERSION];
+}
+
+/* Load the report at the log path, verifying that it was written with the given file @a version. */
+- (Plcrash__CrashReport *) loadReportWithVersion: (uint8_t) version {
     /* Reading the report */
     NSData *data = [NSData dataWithContentsOfFile:_logPath options:NSDataReadingMappedAlways error:nil];
     STAssertNotNil(data, @"Could not map pages");
@@ -289,7 +298,7 @@
     STAssertTrue([data length] > sizeof(struct PLCrashReportFileHeader), @"File is too small for magic + version + data");
     // verifies correct byte ordering of the file magic
     STAssertTrue(memcmp(header->magic, PLCRASH_REPORT_FILE_MAGIC, strlen(PLCRASH_REPORT_FILE_MAGIC)) == 0, @"File header is not 'plcrash', is: '%s'", (const char *) &header->magic);
-    STAssertEquals(header->version, (uint8_t) PLCRASH_REPORT_FILE_VERSION, @"File version is not equal to 0");
+    STAssertEquals(header->version, version, @"Incorrect file version");
     
     /* Try to read the crash report */
     Plcrash__CrashReport *crashReport;
@@ -475,4 +484,515 @@
     protobuf_c_message_free_unpacked((ProtobufCMessage *) crashReport, NULL);
 }
 
+/**
+ * Write a report for the test thread to the log path, using the given output buffer, returning the number of write
+ * operations issued.
+ */
+- (size_t) writeReportWithOutputBuffer: (void *) buffer size: (size_t) size {
+    return [self writeReportWithOutputBuffer: buffer size: size packedFrames: false];
+}
+
+/**
+ * Write a report for the test thread to the log path, using the given output buffer and stack frame format,
+ * returning the number of write operations issued.
+ */
+- (size_t) writeReportWithOutputBuffer: (void *) buffer size: (size_t) size packedFrames: (bool) packedFrames {
+    return [self writeReportWithOutputBuffer: buffer size: size packedFrames: packedFrames stringTable: false];
+}
+
+/**
+ * Write a report for the test thread to the log path, using the given output buffer, stack frame format and
+ * string table configuration, returning the number of write operations issued.
+ */
+- (size_t) writeReportWithOutputBuffer: (void *) buffer size: (size_t) size packedFrames: (bool) packedFrames stringTable: (bool) stringTable {
+    plcrash_async_file_t file;
+
+    int fd = open([_logPath UTF8String], O_RDWR|O_CREAT|O_TRUNC, 0644);
+    plcrash_async_file_init(&file, fd, 0);
+    plcrash_async_file_set_buffer(&file, buffer, size);
+
+    [self writeReportToFile: &file packedFrames: packedFrames stringTable: stringTable];
+
+    STAssertTrue(plcrash_async_file_flush(&file), @"Flush failed");
+    size_t write_ops = plcrash_async_file_write_ops(&file);
+    plcrash_async_file_close(&file);
+
+    return write_ops;
+}
+
+/**
+ * Write a report for the test thread to @a file, using the given stack frame format and string table configuration.
+ * The caller is responsible for flushing and closing @a file.
+ */
+- (void) writeReportToFile: (plcrash_async_file_t *) file packedFrames: (bool) packedFrames stringTable: (bool) stringTable {
+    plcrash_async_image_list_t image_list;
+
+    plcrash_nasync_image_list_init(&image_list, mach_task_self());
+    for (uint32_t i = 0; i < _dyld_image_count(); i++)
+        plcrash_nasync_image_list_append(&image_list, (pl_vm_address_t) _dyld_get_image_header(i), _dyld_get_image_name(i));
+
+    [self writeReportToFile: file imageList: &image_list packedFrames: packedFrames stringTable: stringTable unwindWorkers: 0];
+
+    plcrash_nasync_image_list_free(&image_list);
+}
+
+/**
+ * Write a report for the test thread to @a file from @a image_list, using the given stack frame format, string
+ * table configuration and number of parallel unwind workers. The caller is responsible for flushing and closing
+ * @a file.
+ */
+- (void) writeReportToFile: (plcrash_async_file_t *) file
+                 imageList: (plcrash_async_image_list_t *) image_list
+              packedFrames: (bool) packedFrames
+               stringTable: (bool) stringTable
+             unwindWorkers: (uint32_t) unwindWorkers
+{
+    plcrash_log_writer_t writer;
+    plcrash_async_thread_state_t thread_state;
+    thread_t thread = pthread_mach_thread_np(_thr_args.thread);
+
+    plcrash_async_thread_state_mach_thread_init(&thread_state, thread);
+
+    plcrash_log_bsd_signal_info_t bsd_info = {
+        .address = (void *) 0x42,
+        .code = SEGV_MAPERR,
+        .signo = SIGSEGV
+    };
+    plcrash_log_signal_info_t info = {
+        .bsd_info = &bsd_info,
+        .mach_info = NULL
+    };
+
+    STAssertEquals(PLCRASH_ESUCCESS, plcrash_log_writer_init(&writer, @"test.id", @"1.0", @"2.0", PLCRASH_ASYNC_SYMBOL_STRATEGY_ALL, false), @"Initialization failed");
+    plcrash_log_writer_set_custom_data(&writer, [@"DummyInfo" dataUsingEncoding:NSUTF8StringEncoding]);
+    plcrash_log_writer_set_packed_frames(&writer, packedFrames);
+    plcrash_log_writer_set_string_table(&writer, stringTable);
+    plcrash_log_writer_set_unwind_workers(&writer, unwindWorkers);
+    STAssertEquals(PLCRASH_ESUCCESS, plcrash_log_writer_write(&writer, thread, image_list, file, &info, &thread_state), @"Crash log failed");
+
+    plcrash_log_writer_close(&writer);
+    plcrash_log_writer_free(&writer);
+}
+
+/**
+ * Write a report for the test thread using either the file or memory output backend, returning the report data.
+ * The file backend round-trips the report through a temporary file, as live reports were previously generated.
+ */
+- (NSData *) writeReportUsingMemoryBackend: (bool) useMemory {
+    plcrash_async_file_t file;
+    NSData *data;
+
+    if (useMemory) {
+        plcrash_async_file_init_memory(&file, 0);
+        [self writeReportToFile: &file packedFrames: false stringTable: false];
+        STAssertTrue(plcrash_async_file_flush(&file), @"Flush failed");
+
+        size_t length;
+        const void *bytes = plcrash_async_file_memory_bytes(&file, &length);
+        data = [NSData dataWithBytes: bytes length: length];
+        plcrash_async_file_close(&file);
+    } else {
+        char *path = strdup([[NSTemporaryDirectory() stringByAppendingPathComponent: @"live_report.XXXXXX"] fileSystemRepresentation]);
+        int fd = mkstemp(path);
+        STAssertTrue(fd >= 0, @"Could not create temporary file");
+
+        plcrash_async_file_init(&file, fd, 0);
+        [self writeReportToFile: &file packedFrames: false stringTable: false];
+        STAssertTrue(plcrash_async_file_flush(&file), @"Flush failed");
+        plcrash_async_file_close(&file);
+
+        data = [NSData dataWithContentsOfFile: [NSString stringWithUTF8String: path]];
+        unlink(path);
+        free(path);
+    }
+
+    STAssertNotNil(data, @"Failed to write report");
+    STAssertTrue([data length] > 0, @"Empty report");
+    return data;
+}
+
+/**
+ * Measure report generation via a temporary file. Compare with testMemoryBackendReportPerformance.
+ */
+- (void) testFileBackendReportPerformance {
+    [self measureBlock: ^{
+        for (int i = 0; i < 10; i++)
+            [self writeReportUsingMemoryBackend: false];
+    }];
+}
+
+/**
+ * Measure report generation into memory, as used by live reports. Compare with testFileBackendReportPerformance.
+ */
+- (void) testMemoryBackendReportPerformance {
+    /* Both backends must produce a decodable report */
+    NSError *error = nil;
+    STAssertNotNil([[PLCrashReport alloc] initWithData: [self writeReportUsingMemoryBackend: true] error: &error], @"Failed to decode report: %@", error);
+    STAssertNotNil([[PLCrashReport alloc] initWithData: [self writeReportUsingMemoryBackend: false] error: &error], @"Failed to decode report: %@", error);
+
+    [self measureBlock: ^{
+        for (int i = 0; i < 10; i++)
+            [self writeReportUsingMemoryBackend: true];
+    }];
+}
+
+/**
+ * Verify that a large output buffer reduces the number of write operations required to emit a report.
+ */
+- (void) testOutputBufferWriteOps {
+    size_t bufsize = 64 * 1024;
+    void *buffer = malloc(bufsize);
+
+    size_t default_ops = [self writeReportWithOutputBuffer: NULL size: 0];
+
+    /* The default buffer is only flushed once the next write would overflow it; any two consecutive flushes
+     * must together emit more than a full buffer. Each thread and the exception may additionally require a
+     * rewrite of their reserved length. */
+    size_t report_size = [[[NSFileManager defaultManager] attributesOfItemAtPath: _logPath error: NULL] fileSize];
+    STAssertTrue(report_size > 0, @"Failed to determine the report size");
+
+    Plcrash__CrashReport *defaultReport = [self loadReport];
+    STAssertNotNULL(defaultReport, @"Failed to load report");
+    if (defaultReport != NULL) {
+        size_t default_ops_limit = (2 * report_size / PLCRASH_ASYNC_FILE_DEFAULT_BUFFER_SIZE) + 1 + defaultReport->n_threads + 1;
+        STAssertTrue(default_ops <= default_ops_limit, @"Default buffer issued too many write operations (%zu > %zu)", default_ops, default_ops_limit);
+        protobuf_c_message_free_unpacked((ProtobufCMessage *) defaultReport, NULL);
+    }
+
+    size_t buffered_ops = [self writeReportWithOutputBuffer: buffer size: bufsize];
+
+    STAssertTrue(buffered_ops < default_ops, @"Larger buffer did not reduce write operations (%zu >= %zu)", buffered_ops, default_ops);
+
+    /* The report must remain valid */
+    Plcrash__CrashReport *crashReport = [self loadReport];
+    STAssertNotNULL(crashReport, @"Failed to load report");
+    if (crashReport != NULL) {
+        [self checkSystemInfo: crashReport];
+        [self checkThreads: crashReport];
+        [self checkCustomData: crashReport];
+        protobuf_c_message_free_unpacked((ProtobufCMessage *) crashReport, NULL);
+    }
+
+    free(buffer);
+}
+
+/**
+ * Verify that a writer with preallocated caches resets and reuses them across reports, producing the same frames
+ * as a writer that allocates its caches per report.
+ */
+- (void) testPreallocatedCaches {
+    NSError *error = nil;
+
+    /* Write a reference report using per-report caches */
+    [self writeReportWithOutputBuffer: NULL size: 0];
+    PLCrashReport *expected = [[PLCrashReport alloc] initWithData: [NSData dataWithContentsOfFile: _logPath] error: &error];
+    STAssertNotNil(expected, @"Failed to decode report: %@", error);
+    if (expected == nil)
+        return;
+
+    plcrash_async_image_list_t image_list;
+    plcrash_nasync_image_list_init(&image_list, mach_task_self());
+    for (uint32_t i = 0; i < _dyld_image_count(); i++)
+        plcrash_nasync_image_list_append(&image_list, (pl_vm_address_t) _dyld_get_image_header(i), _dyld_get_image_name(i));
+
+    thread_t thread = pthread_mach_thread_np(_thr_args.thread);
+    plcrash_log_bsd_signal_info_t bsd_info = {
+        .address = (void *) 0x42,
+        .code = SEGV_MAPERR,
+        .signo = SIGSEGV
+    };
+    plcrash_log_signal_info_t info = {
+        .bsd_info = &bsd_info,
+        .mach_info = NULL
+    };
+
+    plcrash_log_writer_t writer;
+    STAssertEquals(PLCRASH_ESUCCESS, plcrash_log_writer_init(&writer, @"test.id", @"1.0", @"2.0", PLCRASH_ASYNC_SYMBOL_STRATEGY_ALL, false), @"Initialization failed");
+    STAssertEquals(PLCRASH_ESUCCESS, plcrash_log_writer_preallocate_caches(&writer), @"Failed to preallocate caches");
+    STAssertTrue(writer.caches.allocated, @"Caches were not allocated");
+
+    /* Each report must reset, rather than reallocate, the preallocated caches */
+    plcrash_async_symbol_cache_entry_t *symbol_entries = writer.caches.symbol_cache.entries;
+    for (int i = 0; i < 2; i++) {
+        plcrash_async_thread_state_t thread_state;
+        plcrash_async_thread_state_mach_thread_init(&thread_state, thread);
+
+        plcrash_async_file_t file;
+        plcrash_async_file_init_memory(&file, 0);
+        STAssertEquals(PLCRASH_ESUCCESS, plcrash_log_writer_write(&writer, thread, &image_list, &file, &info, &thread_state), @"Crash log failed");
+        STAssertTrue(plcrash_async_file_flush(&file), @"Flush failed");
+
+        STAssertTrue(writer.caches.allocated, @"Preallocated caches were freed");
+        STAssertEquals(writer.caches.symbol_cache.entries, symbol_entries, @"Symbol cache was reallocated");
+
+        size_t length;
+        const void *bytes = plcrash_async_file_memory_bytes(&file, &length);
+        NSData *data = [NSData dataWithBytes: bytes length: length];
+        plcrash_async_file_close(&file);
+
+        PLCrashReport *report = [[PLCrashReport alloc] initWithData: data error: &error];
+        STAssertNotNil(report, @"Failed to decode report: %@", error);
+        if (report != nil)
+            [self checkFramesOfReport: report matchReport: expected symbols: true];
+    }
+
+    plcrash_log_writer_close(&writer);
+    plcrash_log_writer_free(&writer);
+    STAssertFalse(writer.caches.allocated, @"Preallocated caches were not freed");
+
+    plcrash_nasync_image_list_free(&image_list);
+}
+
+/**
+ * Write the test thread's report using individual and packed, image-relative stack frames, verifying that both
+ * formats decode to the same frames, and that packed frames reduce the report size.
+ */
+- (void) testPackedStackFrames {
+    NSError *error = nil;
+    NSData *data[2];
+    PLCrashReport *reports[2];
+
+    for (int i = 0; i < 2; i++) {
+        [self writeReportWithOutputBuffer: NULL size: 0 packedFrames: (i == 1)];
+
+        data[i] = [NSData dataWithContentsOfFile: _logPath];
+        STAssertNotNil(data[i], @"Failed to read report");
+
+        reports[i] = [[PLCrashReport alloc] initWithData: data[i] error: &error];
+        STAssertNotNil(reports[i], @"Failed to decode report: %@", error);
+        if (reports[i] == nil)
+            return;
+    }
+
+    const struct PLCrashReportFileHeader *header = [data[1] bytes];
+    STAssertEquals(header->version, (uint8_t) PLCRASH_REPORT_FILE_VERSION_2, @"Incorrect file version for packed frames");
+    STAssertTrue([data[1] length] < [data[0] length], @"Packed frames did not reduce the report size");
+
+    [self checkFramesOfReport: reports[1] matchReport: reports[0] symbols: true];
+}
+
+/**
+ * Verify that the crashed thread of @a report contains the same frames as that of @a expectedReport, optionally
+ * comparing the frames' symbols.
+ */
+- (void) checkFramesOfReport: (PLCrashReport *) report matchReport: (PLCrashReport *) expectedReport symbols: (bool) symbols {
+    /* The test thread is blocked, and so both reports must contain the same frames */
+    PLCrashReport *reports[2] = { expectedReport, report };
+    PLCrashReportThreadInfo *threads[2] = { nil, nil };
+    for (int i = 0; i < 2; i++) {
+        for (PLCrashReportThreadInfo *thread in reports[i].threads) {
+            if (thread.crashed)
+                threads[i] = thread;
+        }
+        STAssertNotNil(threads[i], @"No crashed thread found");
+        if (threads[i] == nil)
+            return;
+    }
+
+    STAssertEquals([threads[0].stackFrames count], [threads[1].stackFrames count], @"Frame count mismatch");
+    STAssertTrue([threads[1].stackFrames count] > 0, @"No frames were written");
+    for (NSUInteger i = 0; i < MIN([threads[0].stackFrames count], [threads[1].stackFrames count]); i++) {
+        PLCrashReportStackFrameInfo *expected = threads[0].stackFrames[i];
+        PLCrashReportStackFrameInfo *frame = threads[1].stackFrames[i];
+
+        STAssertEquals(expected.instructionPointer, frame.instructionPointer, @"Frame %lu PC mismatch", (unsigned long) i);
+        if (!symbols)
+            continue;
+
+        if (expected.symbolInfo == nil) {
+            STAssertNil(frame.symbolInfo, @"Frame %lu has an unexpected symbol", (unsigned long) i);
+        } else {
+            STAssertEqualObjects(expected.symbolInfo.symbolName, frame.symbolInfo.symbolName, @"Frame %lu symbol name mismatch", (unsigned long) i);
+            STAssertEquals(expected.symbolInfo.startAddress, frame.symbolInfo.startAddress, @"Frame %lu symbol address mismatch", (unsigned long) i);
+        }
+    }
+}
+
+/* Image list mutation state for testPackedStackFramesParallelUnwind */
+struct image_churn {
+    /** The image list to be mutated. */
+    plcrash_async_image_list_t *image_list;
+
+    /** Set to stop mutating the list. */
+    atomic_bool stop;
+
+    /** The number of completed remove/append cycles. */
+    atomic_uint cycles;
+};
+
+/* Repeatedly move the first image to the end of the image list, shifting the position of every other image. */
+static void *image_churn_thread (void *arg) {
+    struct image_churn *churn = arg;
+    while (!atomic_load(&churn->stop)) {
+        plcrash_nasync_image_list_remove(churn->image_list, (pl_vm_address_t) _dyld_get_image_header(0));
+        plcrash_nasync_image_list_append(churn->image_list, (pl_vm_address_t) _dyld_get_image_header(0), _dyld_get_image_name(0));
+        atomic_fetch_add(&churn->cycles, 1);
+    }
+    return NULL;
+}
+
+/**
+ * Write packed stack frames via the parallel unwind path, which resumes the task's threads before frames are
+ * written, while the image list is reordered concurrently. The frames' image indices must match the order of the
+ * report's binary images, and so must decode to the same PCs as a serially written report.
+ */
+- (void) testPackedStackFramesParallelUnwind {
+    NSError *error = nil;
+
+    /* Write a reference report serially, with individual frames */
+    [self writeReportWithOutputBuffer: NULL size: 0];
+    PLCrashReport *expected = [[PLCrashReport alloc] initWithData: [NSData dataWithContentsOfFile: _logPath] error: &error];
+    STAssertNotNil(expected, @"Failed to decode report: %@", error);
+    if (expected == nil)
+        return;
+
+    plcrash_async_image_list_t image_list;
+    plcrash_nasync_image_list_init(&image_list, mach_task_self());
+    for (uint32_t i = 0; i < _dyld_image_count(); i++)
+        plcrash_nasync_image_list_append(&image_list, (pl_vm_address_t) _dyld_get_image_header(i), _dyld_get_image_name(i));
+
+    /* Start reordering the image list, and wait for the first cycle to complete */
+    struct image_churn churn = { .image_list = &image_list };
+    atomic_init(&churn.stop, false);
+    atomic_init(&churn.cycles, 0);
+
+    pthread_t churn_thread;
+    STAssertEquals(pthread_create(&churn_thread, NULL, image_churn_thread, &churn), 0, @"Failed to start image list thread");
+    while (atomic_load(&churn.cycles) == 0)
+        sched_yield();
+
+    plcrash_async_file_t file;
+    plcrash_async_file_init_memory(&file, 0);
+    [self writeReportToFile: &file imageList: &image_list packedFrames: true stringTable: false unwindWorkers: 2];
+    STAssertTrue(plcrash_async_file_flush(&file), @"Flush failed");
+
+    atomic_store(&churn.stop, true);
+    pthread_join(churn_thread, NULL);
+
+    size_t length;
+    const void *bytes = plcrash_async_file_memory_bytes(&file, &length);
+    NSData *data = [NSData dataWithBytes: bytes length: length];
+    plcrash_async_file_close(&file);
+    plcrash_nasync_image_list_free(&image_list);
+
+    const struct PLCrashReportFileHeader *header = [data bytes];
+    STAssertEquals(header->version, (uint8_t) PLCRASH_REPORT_FILE_VERSION_2, @"Incorrect file version for packed frames");
+
+    PLCrashReport *report = [[PLCrashReport alloc] initWithData: data error: &error];
+    STAssertNotNil(report, @"Failed to decode report: %@", error);
+    if (report == nil)
+        return;
+
+    /* Symbols are resolved from the live image list once threads are resumed, and so only the PCs are compared */
+    [self checkFramesOfReport: report matchReport: expected symbols: false];
+}
+
+/**
+ * Write the test thread's report with and without the string table, verifying that interned image paths and symbol
+ * names decode to the original values, and comparing the resulting report sizes.
+ */
+- (void) testReportStringTable {
+    NSError *error = nil;
+    NSData *data[2];
+    PLCrashReport *reports[2];
+
+    for (int i = 0; i < 2; i++) {
+        [self writeReportWithOutputBuffer: NULL size: 0 packedFrames: false stringTable: (i == 1)];
+
+        data[i] = [NSData dataWithContentsOfFile: _logPath];
+        STAssertNotNil(data[i], @"Failed to read report");
+
+        reports[i] = [[PLCrashReport alloc] initWithData: data[i] error: &error];
+        STAssertNotNil(reports[i], @"Failed to decode report: %@", error);
+        if (reports[i] == nil)
+            return;
+    }
+
+    const struct PLCrashReportFileHeader *header = [data[1] bytes];
+    STAssertEquals(header->version, (uint8_t) PLCRASH_REPORT_FILE_VERSION_2, @"Incorrect file version for string table");
+    STAssertTrue([data[1] length] < [data[0] length], @"String table did not reduce the report size");
+
+    /* Verify the raw encoding references the table */
+    Plcrash__CrashReport *crashReport = [self loadReportWithVersion: PLCRASH_REPORT_FILE_VERSION_2];
+    STAssertNotNULL(crashReport, @"Failed to load report");
+    if (crashReport != NULL) {
+        STAssertTrue(crashReport->n_string_table > 0, @"No string table entries were written");
+        STAssertTrue(crashReport->n_binary_images > 0, @"No binary images were written");
+        if (crashReport->n_binary_images > 0)
+            STAssertTrue(crashReport->binary_images[0]->has_name_ref, @"Image name was not interned");
+        protobuf_c_message_free_unpacked((ProtobufCMessage *) crashReport, NULL);
+    }
+
+    /* Image names must match */
+    STAssertEquals([reports[0].images count], [reports[1].images count], @"Image count mismatch");
+    for (NSUInteger i = 0; i < MIN([reports[0].images count], [reports[1].images count]); i++) {
+        PLCrashReportBinaryImageInfo *expected = reports[0].images[i];
+        PLCrashReportBinaryImageInfo *image = reports[1].images[i];
+        STAssertEqualObjects(expected.imageName, image.imageName, @"Image %lu name mismatch", (unsigned long) i);
+        STAssertEquals(expected.imageBaseAddress, image.imageBaseAddress, @"Image %lu address mismatch", (unsigned long) i);
+    }
+
+    [self checkFramesOfReport: reports[1] matchReport: reports[0] symbols: true];
+}
+
+/**
+ * Write a report whose binary image paths exceed the string table's capacity, verifying that the paths which could
+ * not be interned are written inline, and that all paths decode to their original values.
+ */
+- (void) testReportStringTableOverflow {
+    NSError *error = nil;
+    uint32_t count = _dyld_image_count();
+
+    /* Give each image a unique path; in total, the paths require twice the string table's data capacity */
+    size_t component_len = (PLCRASH_ASYNC_STRING_TABLE_DATA_SIZE / count) * 2;
+    NSString *component = [@"" stringByPaddingToLength: component_len withString: @"x" startingAtIndex: 0];
+    NSMutableArray *names = [NSMutableArray arrayWithCapacity: count];
+
+    plcrash_async_image_list_t image_list;
+    plcrash_nasync_image_list_init(&image_list, mach_task_self());
+    for (uint32_t i = 0; i < count; i++) {
+        NSString *name = [NSString stringWithFormat: @"/overflow/%u-%@/%s", i, component, _dyld_get_image_name(i)];
+        [names addObject: name];
+        plcrash_nasync_image_list_append(&image_list, (pl_vm_address_t) _dyld_get_image_header(i), [name UTF8String]);
+    }
+
+    plcrash_async_file_t file;
+    int fd = open([_logPath UTF8String], O_RDWR|O_CREAT|O_TRUNC, 0644);
+    plcrash_async_file_init(&file, fd, 0);
+    [self writeReportToFile: &file imageList: &image_list packedFrames: false stringTable: true unwindWorkers: 0];
+    STAssertTrue(plcrash_async_file_flush(&file), @"Flush failed");
+    plcrash_async_file_close(&file);
+    plcrash_nasync_image_list_free(&image_list);
+
+    /* Both interned and inline names must have been written */
+    Plcrash__CrashReport *crashReport = [self loadReportWithVersion: PLCRASH_REPORT_FILE_VERSION_2];
+    STAssertNotNULL(crashReport, @"Failed to load report");
+    if (crashReport != NULL) {
+        size_t interned = 0;
+        size_t inline_names = 0;
+        for (size_t i = 0; i < crashReport->n_binary_images; i++) {
+            if (crashReport->binary_images[i]->has_name_ref) {
+                interned++;
+            } else if (strlen(crashReport->binary_images[i]->name) > 0) {
+                inline_names++;
+            }
+        }
+
+        STAssertTrue(interned > 0, @"No image names were interned");
+        STAssertTrue(inline_names > 0, @"String table did not overflow");
+        protobuf_c_message_free_unpacked((ProtobufCMessage *) crashReport, NULL);
+    }
+
+    PLCrashReport *report = [[PLCrashReport alloc] initWithData: [NSData dataWithContentsOfFile: _logPath] error: &error];
+    STAssertNotNil(report, @"Failed to decode report: %@", error);
+    if (report == nil)
+        return;
+
+    STAssertEquals([report.images count], (NSUInteger) count, @"Image count mismatch");
+    for (NSUInteger i = 0; i < MIN([report.images count], (NSUInteger) count); i++) {
+        PLCrashReportBinaryImageInfo *image = report.images[i];
+        STAssertEqualObjects(image.imageName, names[i], @"Image %lu name mismatch", (unsigned long) i);
+    }
+}
+
 @end
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#import "SenTestCompat.h"
+
+#import "PLCrashParallelUnwind.h"
+
+#import <dlfcn.h>
+
+/** The number of synthetic threads to unwind. */
+#define TEST_THREAD_COUNT 16
+
+/** The maximum depth of each synthetic thread's stack. */
+#define TEST_FRAME_COUNT 8
+
+struct stack_frame {
+    uintptr_t fp;
+    uintptr_t pc;
+} __attribute__((packed));
+
+/**
+ * A frame symbol, as found by a serial plcrash_async_find_symbol() lookup.
+ */
+struct test_symbol {
+    bool found;
+    pl_vm_address_t address;
+    char name[256];
+};
+
+static void test_found_symbol_cb (pl_vm_address_t address, const char *name, void *ctx) {
+    struct test_symbol *symbol = ctx;
+    symbol->found = true;
+    symbol->address = address;
+    strlcpy(symbol->name, name, sizeof(symbol->name));
+}
+
+@interface PLCrashParallelUnwindTests : SenTestCase {
+@private
+    plcrash_async_image_list_t _image_list;
+
+    /** Synthetic stacks for each thread. */
+    struct stack_frame _stacks[TEST_THREAD_COUNT][TEST_FRAME_COUNT];
+}
+@end
+
+@implementation PLCrashParallelUnwindTests
+
+/**
+ * Register the on-disk image containing @a addr with our image list.
+ */
+- (void) appendImageContainingAddress: (const void *) addr {
+    Dl_info info;
+    STAssertTrue(dladdr(addr, &info) != 0, @"Could not find image for %p", addr);
+    plcrash_nasync_image_list_append(&_image_list, (pl_vm_address_t) info.dli_fbase, info.dli_fname);
+}
+
+- (void) setUp {
+    plcrash_nasync_image_list_init(&_image_list, mach_task_self());
+
+    /* Register the images backing the code addresses used in our synthetic stacks */
+    [self appendImageContainingAddress: (const void *) &plcrash_nasync_parallel_unwind_pool_init];
+    [self appendImageContainingAddress: (const void *) &strlcpy];
+}
+
+- (void) tearDown {
+    plcrash_nasync_image_list_free(&_image_list);
+}
+
+/**
+ * Populate @a state with a synthetic stack of @a depth frames, terminated by a NULL frame pointer. Frame PCs
+ * reference code within our registered images.
+ */
+- (void) initThreadState: (plcrash_async_thread_state_t *) state index: (size_t) index depth: (size_t) depth {
+    const uintptr_t pcs[] = {
+        (uintptr_t) &plcrash_nasync_parallel_unwind_pool_init,
+        (uintptr_t) &plcrash_parallel_unwind_pool_walk,
+        (uintptr_t) &plcrash_nasync_parallel_unwind_pool_symbolicate,
+        (uintptr_t) &strlcpy
+    };
+    struct stack_frame *frames = _stacks[index];
+
+    for (size_t i = 0; i < depth; i++) {
+        frames[i].pc = pcs[(index + i) % (sizeof(pcs) / sizeof(pcs[0]))] + 1;
+        frames[i].fp = (i + 1 < depth) ? (uintptr_t) &frames[i + 1] : 0x0;
+    }
+
+    plcrash_async_thread_state_mach_thread_init(state, pl_mach_thread_self());
+    plcrash_async_thread_state_set_reg(state, PLCRASH_REG_FP, frames[0].fp);
+    plcrash_async_thread_state_set_reg(state, PLCRASH_REG_IP, frames[0].pc);
+}
+
+/**
+ * Verify that parallel unwinding and symbolication produce the same results, in the same thread order, as a
+ * serial walk of the same thread states.
+ */
+- (void) testUnwindMatchesSerial {
+    plcrash_parallel_unwind_thread_t threads[TEST_THREAD_COUNT];
+    plcrash_parallel_unwind_pool_t pool;
+
+    for (size_t i = 0; i < TEST_THREAD_COUNT; i++) {
+        STAssertEquals(plcrash_nasync_parallel_unwind_thread_init(&threads[i], TEST_FRAME_COUNT), PLCRASH_ESUCCESS, @"Failed to initialize thread");
+        [self initThreadState: &threads[i].thread_state index: i depth: 1 + (i % TEST_FRAME_COUNT)];
+    }
+
+    STAssertEquals(plcrash_nasync_parallel_unwind_pool_init(&pool, 4), PLCRASH_ESUCCESS, @"Failed to initialize pool");
+    plcrash_parallel_unwind_pool_walk(&pool, mach_task_self(), &_image_list, threads, TEST_THREAD_COUNT);
+    plcrash_nasync_parallel_unwind_pool_symbolicate(&pool, &_image_list, PLCRASH_ASYNC_SYMBOL_STRATEGY_SYMBOL_TABLE, threads, TEST_THREAD_COUNT);
+    plcrash_nasync_parallel_unwind_pool_free(&pool);
+
+    /* Compare against a serial walk of the same thread states */
+    plcrash_async_symbol_cache_t cache;
+    STAssertEquals(plcrash_async_symbol_cache_init(&cache), PLCRASH_ESUCCESS, @"Failed to initialize symbol cache");
+
+    for (size_t i = 0; i < TEST_THREAD_COUNT; i++) {
+        plcrash_async_thread_state_t state;
+        plframe_cursor_t cursor;
+        plframe_error_t ferr;
+        uint32_t frame_count = 0;
+
+        [self initThreadState: &state index: i depth: 1 + (i % TEST_FRAME_COUNT)];
+        STAssertEquals(plframe_cursor_init(&cursor, mach_task_self(), &state, &_image_list), PLFRAME_ESUCCESS, @"Failed to initialize cursor");
+
+        while ((ferr = plframe_cursor_next(&cursor)) == PLFRAME_ESUCCESS && frame_count < TEST_FRAME_COUNT) {
+            plcrash_greg_t pc;
+            STAssertEquals(plframe_cursor_get_reg(&cursor, PLCRASH_REG_IP, &pc), PLFRAME_ESUCCESS, @"Failed to fetch PC");
+            STAssertTrue(frame_count < threads[i].frame_count, @"Parallel walk of thread %zu returned too few frames", i);
+            if (frame_count >= threads[i].frame_count)
+                break;
+
+            plcrash_parallel_unwind_frame_t *frame = &threads[i].frames[frame_count];
+            STAssertEquals(frame->pc, (uint64_t) pc, @"Incorrect PC for thread %zu frame %u", i, frame_count);
+
+            /* Verify the symbol */
+            struct test_symbol symbol = { .found = false };
+            plcrash_async_image_t *image = plcrash_async_image_containing_address(&_image_list, (pl_vm_address_t) pc);
+            if (image != NULL)
+                plcrash_async_find_symbol(&image->macho_image, PLCRASH_ASYNC_SYMBOL_STRATEGY_SYMBOL_TABLE, &cache, (pl_vm_address_t) pc, test_found_symbol_cb, &symbol);
+
+            STAssertEquals(symbol.found, (bool) (frame->symbol_name != NULL), @"Symbol lookup mismatch for thread %zu frame %u", i, frame_count);
+            if (symbol.found && frame->symbol_name != NULL) {
+                STAssertEqualCStrings(frame->symbol_name, symbol.name, @"Incorrect symbol name");
+                STAssertEquals(frame->symbol_start, (uint64_t) symbol.address, @"Incorrect symbol address");
+            }
+
+            frame_count++;
+        }
+
+        STAssertEquals(threads[i].frame_count, frame_count, @"Frame count mismatch for thread %zu", i);
+        STAssertEquals(threads[i].error, ferr, @"Termination mismatch for thread %zu", i);
+
+        plframe_cursor_free(&cursor);
+        plcrash_nasync_parallel_unwind_thread_free(&threads[i]);
+    }
+
+    plcrash_async_symbol_cache_free(&cache);
+}
+
+/**
+ * Verify that a pool without workers performs all work on the calling thread.
+ */
+- (void) testNoWorkers {
+    plcrash_parallel_unwind_thread_t thread;
+    plcrash_parallel_unwind_pool_t pool;
+
+    STAssertEquals(plcrash_nasync_parallel_unwind_thread_init(&thread, TEST_FRAME_COUNT), PLCRASH_ESUCCESS, @"Failed to initialize thread");
+    [self initThreadState: &thread.thread_state index: 0 depth: 3];
+
+    STAssertEquals(plcrash_nasync_parallel_unwind_pool_init(&pool, 0), PLCRASH_ESUCCESS, @"Failed to initialize pool");
+    plcrash_parallel_unwind_pool_walk(&pool, mach_task_self(), &_image_list, &thread, 1);
+    plcrash_nasync_parallel_unwind_pool_free(&pool);
+
+    STAssertTrue(thread.frame_count > 0, @"No frames unwound");
+    STAssertEquals(thread.frames[0].pc, (uint64_t) _stacks[0][0].pc, @"Incorrect first frame");
+
+    plcrash_nasync_parallel_unwind_thread_free(&thread);
+}
+
+@end
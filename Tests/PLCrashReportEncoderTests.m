@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2013 Plausible Labs Cooperative, Inc.
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#import "SenTestCompat.h"
+#import "PLCrashAsync.h"
+#import "PLCrashReport.pb-enc.h"
+
+#import "protobuf-c.h"
+#import "PLCrashReport.pb-c.h"
+
+/**
+ * Verify that the generated PLCrashReport.pb-enc.h encoders produce output identical to protobuf-c's
+ * reflection-based encoder.
+ */
+@interface PLCrashReportEncoderTests : SenTestCase @end
+
+@implementation PLCrashReportEncoderTests
+
+/* Pack @a message via protobuf-c, returning the encoded bytes. */
+static NSData *protobuf_pack (const ProtobufCMessage *message) {
+    NSMutableData *data = [NSMutableData dataWithLength: protobuf_c_message_get_packed_size(message)];
+    protobuf_c_message_pack(message, [data mutableBytes]);
+    return data;
+}
+
+/**
+ * Test computing varint sizes around each 7-bit boundary.
+ */
+- (void) testVarintSize {
+    uint8_t buffer[16];
+    plcrash_writer_message_t msg;
+
+    for (unsigned int bits = 0; bits <= 64; bits++) {
+        uint64_t values[] = { bits == 0 ? 0 : (1ULL << (bits - 1)), bits == 64 ? UINT64_MAX : (1ULL << bits) - 1 };
+        for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+            plcrash_writer_message_init(&msg, buffer, sizeof(buffer));
+            plcrash_pb_put_varint(&msg, values[i]);
+            STAssertEquals(plcrash_pb_varint_size(values[i]), msg.length, @"Incorrect size for 0x%llx", (unsigned long long) values[i]);
+        }
+    }
+}
+
+/**
+ * Test encoding a binary image message, including the nested processor message.
+ */
+- (void) testBinaryImage {
+    uint8_t uuid[16] = { 0xde, 0xad, 0xbe, 0xef, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c };
+    const char *name = "/usr/lib/system/libsystem_kernel.dylib";
+
+    /* Encode via protobuf-c */
+    Plcrash__CrashReport__Processor processor = PLCRASH__CRASH_REPORT__PROCESSOR__INIT;
+    processor.has_encoding = true;
+    processor.encoding = PLCRASH__CRASH_REPORT__PROCESSOR__TYPE_ENCODING__TYPE_ENCODING_MACH;
+    processor.type = 0x0100000c;
+    processor.subtype = 0x80000002;
+
+    Plcrash__CrashReport__BinaryImage image = PLCRASH__CRASH_REPORT__BINARY_IMAGE__INIT;
+    image.base_address = 0x7fff20300000ULL;
+    image.size = 0x37000;
+    image.name = (char *) name;
+    image.has_uuid = true;
+    image.uuid.len = sizeof(uuid);
+    image.uuid.data = uuid;
+    image.code_type = &processor;
+
+    NSData *expected = protobuf_pack(&image.base);
+
+    /* Encode via the generated encoders */
+    size_t processor_size = plcrash_pb_crash_report_processor__encoding_size(processor.encoding) +
+        plcrash_pb_crash_report_processor__type_size(processor.type) +
+        plcrash_pb_crash_report_processor__subtype_size(processor.subtype);
+    size_t image_size = plcrash_pb_crash_report_binary_image__base_address_size(image.base_address) +
+        plcrash_pb_crash_report_binary_image__size_size(image.size) +
+        plcrash_pb_crash_report_binary_image__name_size(strlen(name)) +
+        plcrash_pb_crash_report_binary_image__uuid_size(sizeof(uuid)) +
+        plcrash_pb_crash_report_binary_image__code_type_size(processor_size);
+    STAssertEquals(image_size, (size_t) [expected length], @"Incorrect computed size");
+
+    uint8_t buffer[256];
+    plcrash_writer_message_t msg;
+    plcrash_writer_message_init(&msg, buffer, sizeof(buffer));
+    STAssertTrue(plcrash_writer_message_reserve(&msg, image_size), @"Failed to reserve message");
+
+    plcrash_pb_crash_report_binary_image__base_address_pack(&msg, image.base_address);
+    plcrash_pb_crash_report_binary_image__size_pack(&msg, image.size);
+    plcrash_pb_crash_report_binary_image__name_pack(&msg, name, strlen(name));
+    plcrash_pb_crash_report_binary_image__uuid_pack(&msg, uuid, sizeof(uuid));
+    plcrash_pb_crash_report_binary_image__code_type_pack_header(&msg, processor_size);
+    plcrash_pb_crash_report_processor__encoding_pack(&msg, processor.encoding);
+    plcrash_pb_crash_report_processor__type_pack(&msg, processor.type);
+    plcrash_pb_crash_report_processor__subtype_pack(&msg, processor.subtype);
+
+    STAssertEqualObjects([NSData dataWithBytes: buffer length: msg.length], expected, @"Encoded message does not match protobuf-c output");
+}
+
+/**
+ * Test encoding a thread message containing repeated frame and register messages, and decode the result.
+ */
+- (void) testThread {
+    const char *symbol_name = "-[PLCrashReportEncoderTests testThread]";
+    const char *reg_names[] = { "pc", "sp", "lr" };
+    uint64_t reg_values[] = { 0x100004a2cULL, 0x16fdff3a0ULL, 0 };
+    uint64_t pcs[] = { 0x100004a2cULL, 0x1a2b3c4d5e6fULL };
+
+    /* Encode via protobuf-c */
+    Plcrash__CrashReport__Symbol symbol = PLCRASH__CRASH_REPORT__SYMBOL__INIT;
+    symbol.name = (char *) symbol_name;
+    symbol.start_address = 0x100004a00ULL;
+
+    Plcrash__CrashReport__Thread__StackFrame frames[2] = { PLCRASH__CRASH_REPORT__THREAD__STACK_FRAME__INIT, PLCRASH__CRASH_REPORT__THREAD__STACK_FRAME__INIT };
+    Plcrash__CrashReport__Thread__StackFrame *frame_ptrs[2] = { &frames[0], &frames[1] };
+    frames[0].pc = pcs[0];
+    frames[0].symbol = &symbol;
+    frames[1].pc = pcs[1];
+
+    Plcrash__CrashReport__Thread__RegisterValue regs[3];
+    Plcrash__CrashReport__Thread__RegisterValue *reg_ptrs[3];
+    for (size_t i = 0; i < 3; i++) {
+        Plcrash__CrashReport__Thread__RegisterValue init = PLCRASH__CRASH_REPORT__THREAD__REGISTER_VALUE__INIT;
+        regs[i] = init;
+        regs[i].name = (char *) reg_names[i];
+        regs[i].value = reg_values[i];
+        reg_ptrs[i] = &regs[i];
+    }
+
+    Plcrash__CrashReport__Thread thread = PLCRASH__CRASH_REPORT__THREAD__INIT;
+    thread.thread_number = 300;
+    thread.n_frames = 2;
+    thread.frames = frame_ptrs;
+    thread.crashed = true;
+    thread.n_registers = 3;
+    thread.registers = reg_ptrs;
+
+    NSData *expected = protobuf_pack(&thread.base);
+
+    /* Encode via the generated encoders */
+    uint8_t buffer[512];
+    plcrash_writer_message_t msg;
+    plcrash_writer_message_init(&msg, buffer, sizeof(buffer));
+    STAssertTrue(plcrash_writer_message_reserve(&msg, [expected length]), @"Failed to reserve message");
+
+    plcrash_pb_crash_report_thread__thread_number_pack(&msg, thread.thread_number);
+
+    size_t symbol_size = plcrash_pb_crash_report_symbol__name_size(strlen(symbol_name)) + plcrash_pb_crash_report_symbol__start_address_size(symbol.start_address);
+    for (size_t i = 0; i < 2; i++) {
+        size_t frame_size = plcrash_pb_crash_report_thread_stack_frame__pc_size(pcs[i]);
+        if (i == 0)
+            frame_size += plcrash_pb_crash_report_thread_stack_frame__symbol_size(symbol_size);
+
+        plcrash_pb_crash_report_thread__frames_pack_header(&msg, frame_size);
+        plcrash_pb_crash_report_thread_stack_frame__pc_pack(&msg, pcs[i]);
+        if (i == 0) {
+            plcrash_pb_crash_report_thread_stack_frame__symbol_pack_header(&msg, symbol_size);
+            plcrash_pb_crash_report_symbol__name_pack(&msg, symbol_name, strlen(symbol_name));
+            plcrash_pb_crash_report_symbol__start_address_pack(&msg, symbol.start_address);
+        }
+    }
+
+    plcrash_pb_crash_report_thread__crashed_pack(&msg, true);
+
+    for (size_t i = 0; i < 3; i++) {
+        size_t reg_size = plcrash_pb_crash_report_thread_register_value__name_size(strlen(reg_names[i])) + plcrash_pb_crash_report_thread_register_value__value_size(reg_values[i]);
+        plcrash_pb_crash_report_thread__registers_pack_header(&msg, reg_size);
+        plcrash_pb_crash_report_thread_register_value__name_pack(&msg, reg_names[i], strlen(reg_names[i]));
+        plcrash_pb_crash_report_thread_register_value__value_pack(&msg, reg_values[i]);
+    }
+
+    STAssertEqualObjects([NSData dataWithBytes: buffer length: msg.length], expected, @"Encoded message does not match protobuf-c output");
+
+    /* Verify that the output decodes */
+    Plcrash__CrashReport__Thread *decoded = (Plcrash__CrashReport__Thread *) protobuf_c_message_unpack(&plcrash__crash_report__thread__descriptor, NULL, msg.length, buffer);
+    STAssertNotNULL(decoded, @"Failed to decode message");
+    if (decoded == NULL)
+        return;
+
+    STAssertEquals(decoded->thread_number, (uint32_t) 300, @"Incorrect thread number");
+    STAssertEquals(decoded->n_frames, (size_t) 2, @"Incorrect frame count");
+    STAssertEquals(decoded->frames[1]->pc, pcs[1], @"Incorrect PC");
+    STAssertEqualCStrings(decoded->frames[0]->symbol->name, symbol_name, @"Incorrect symbol name");
+    STAssertEquals(decoded->n_registers, (size_t) 3, @"Incorrect register count");
+
+    protobuf_c_message_free_unpacked((ProtobufCMessage *) decoded, NULL);
+}
+
+/**
+ * Measure the throughput of 64-bit varint fields packed via the generated encoders.
+ */
+- (void) testPackVarintPerformance {
+    const uint32_t count = 1000000;
+    uint64_t *values = malloc(sizeof(uint64_t) * count);
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t value = ((uint64_t) arc4random() << 32) | arc4random();
+        values[i] = value >> arc4random_uniform(64);
+    }
+
+    uint8_t *staging = malloc(4096);
+
+    [self measureBlock: ^{
+        plcrash_writer_message_t msg;
+        plcrash_writer_message_init(&msg, staging, 4096);
+
+        for (uint32_t i = 0; i < count; i++) {
+            if (!plcrash_writer_message_reserve(&msg, plcrash_pb_crash_report_thread_stack_frame__pc_size(values[i])))
+                plcrash_writer_message_init(&msg, staging, 4096);
+            plcrash_pb_crash_report_thread_stack_frame__pc_pack(&msg, values[i]);
+        }
+    }];
+
+    free(staging);
+    free(values);
+}
+
+@end
@@ -36,6 +36,11 @@
 @interface PLCrashReporterTests : SenTestCase
 @end
 
+@interface PLCrashReporter (PrivateMethods)
++ (void) resetSharedImageList;
++ (void) registerLoadedImagesWithDeferredLoading: (BOOL) deferred;
+@end
+
 @implementation PLCrashReporterTests
 
 - (void) testSingleton {
@@ -79,6 +84,53 @@
     STAssertEqualStrings(report.exceptionInfo.exceptionReason, exc.reason, @"Incorrect exception reason");
 }
 
+/**
+ * Test generation of a 'live' crash report using parallel unwinding.
+ */
+- (void) testGenerateLiveReportWithUnwindWorkers {
+    NSError *error;
+    NSData *reportData;
+    plcrash_test_thread_t thr;
+
+    /* Spawn a thread and generate a report for it */
+    plcrash_test_thread_spawn(&thr);
+
+    PLCrashReporterConfig *config = [[PLCrashReporterConfig alloc] initWithSignalHandlerType: PLCrashReporterSignalHandlerTypeBSD
+                                                                       symbolicationStrategy: PLCrashReporterSymbolicationStrategyAll
+                                                      shouldRegisterUncaughtExceptionHandler: YES
+                                                                                    basePath: nil
+                                                                              maxReportBytes: 1024 * 1024
+                                                                     liveReportUnwindWorkers: 2
+                                                                      reportOutputBufferSize: 0
+                                                                      loadImagesInBackground: NO
+                                                                        usePackedStackFrames: NO
+                                                                        useReportStringTable: NO
+                                                                           indexUnwindTables: NO];
+
+    PLCrashReporter *reporter = [[PLCrashReporter alloc] initWithConfiguration: config];
+    reportData = [reporter generateLiveReportWithThread: pthread_mach_thread_np(thr.thread)
+                                              exception: nil
+                                                  error: &error];
+    plcrash_test_thread_stop(&thr);
+    STAssertNotNil(reportData, @"Failed to generate live report: %@", error);
+
+    /* Try parsing the result */
+    PLCrashReport *report = [[PLCrashReport alloc] initWithData: reportData error: &error];
+    STAssertNotNil(report, @"Could not parse geneated live report: %@", error);
+
+    /* The crashed thread must have been unwound, with registers */
+    BOOL foundCrashed = NO;
+    for (PLCrashReportThreadInfo *thread in report.threads) {
+        if (!thread.crashed)
+            continue;
+
+        foundCrashed = YES;
+        STAssertTrue([thread.stackFrames count] > 0, @"No frames were unwound for the crashed thread");
+        STAssertTrue([thread.registers count] > 0, @"No registers were written for the crashed thread");
+    }
+    STAssertTrue(foundCrashed, @"Crashed thread was not reported");
+}
+
 /**
  * Test generation of a 'live' crash report that exceeds maxReportBytes.
  */
@@ -160,4 +212,53 @@
     STAssertEqualStrings([[report signalInfo] code], @"TRAP_TRACE", @"Incorrect signal code");
 }
 
+/**
+ * Measure reporter startup -- dyld image registration, initialization, and enableCrashReporter -- with the
+ * given image loading mode. Each iteration reproduces the state of the shared image list prior to registration of
+ * the dyld callbacks.
+ *
+ * Enabling a reporter installs its signal handlers in the test process; reporters can not be disabled, and every
+ * iteration registers an additional set of handlers.
+ */
+- (void) measureStartupWithBackgroundImageLoading: (BOOL) loadImagesInBackground {
+    NSString *basePath = [NSTemporaryDirectory() stringByAppendingPathComponent: [[NSProcessInfo processInfo] globallyUniqueString]];
+    PLCrashReporterConfig *config = [[PLCrashReporterConfig alloc] initWithSignalHandlerType: PLCrashReporterSignalHandlerTypeBSD
+                                                                       symbolicationStrategy: PLCrashReporterSymbolicationStrategyAll
+                                                      shouldRegisterUncaughtExceptionHandler: NO
+                                                                                    basePath: basePath
+                                                                              maxReportBytes: 1024 * 1024
+                                                                     liveReportUnwindWorkers: 0
+                                                                      reportOutputBufferSize: 0
+                                                                      loadImagesInBackground: loadImagesInBackground
+                                                                        usePackedStackFrames: NO
+                                                                        useReportStringTable: NO
+                                                                           indexUnwindTables: NO];
+
+    [self measureMetrics: [[self class] defaultPerformanceMetrics] automaticallyStartMeasuring: NO forBlock: ^{
+        [PLCrashReporter resetSharedImageList];
+
+        [self startMeasuring];
+        [PLCrashReporter registerLoadedImagesWithDeferredLoading: loadImagesInBackground];
+
+        NSError *error = nil;
+        PLCrashReporter *reporter = [[PLCrashReporter alloc] initWithConfiguration: config];
+        BOOL enabled = [reporter enableCrashReporterAndReturnError: &error];
+        [self stopMeasuring];
+
+        STAssertTrue(enabled, @"Failed to enable the crash reporter: %@", error);
+    }];
+
+    [[NSFileManager defaultManager] removeItemAtPath: basePath error: NULL];
+}
+
+/* Measure reporter startup with the default, synchronous image loading. Compare with testStartupPerformanceBackgroundImageLoading. */
+- (void) testStartupPerformance {
+    [self measureStartupWithBackgroundImageLoading: NO];
+}
+
+/* Measure reporter startup with images loaded in the background. Compare with testStartupPerformance. */
+- (void) testStartupPerformanceBackgroundImageLoading {
+    [self measureStartupWithBackgroundImageLoading: YES];
+}
+
 @end
@@ -133,6 +133,104 @@ using namespace plcrash::async;
     plcrash_async_mobject_free(&mobj);
 }
 
+/**
+ * Encode @a value as a ULEB128, padded to @a len bytes, returning the encoded length.
+ */
+static size_t encode_uleb128 (uint64_t value, uint8_t *buffer, size_t len) {
+    size_t i = 0;
+    do {
+        buffer[i] = value & 0x7f;
+        value >>= 7;
+        if (value != 0 || i + 1 < len)
+            buffer[i] |= 0x80;
+        i++;
+    } while (value != 0 || i < len);
+
+    return i;
+}
+
+/**
+ * Test LEB128 decoding across all encoded lengths, from both the word-wide and bytewise decode paths.
+ */
+- (void) testDecodeLEB128Lengths {
+    /* Trailing space ensures that values of up to 8 bytes may be decoded with a single word load */
+    uint8_t buffer[16];
+    pl_vm_size_t size;
+
+    for (size_t len = 1; len <= 10; len++) {
+        uint64_t expected = (len * 7 >= 64) ? UINT64_MAX : ((1ULL << (len * 7)) - 1) / 3;
+
+        memset(buffer, 0xAA, sizeof(buffer));
+        STAssertEquals(encode_uleb128(expected, buffer, len), len, @"Unexpected encoded length");
+
+        /* Word-wide path (if enabled) */
+        uint64_t uval;
+        STAssertEquals(plcrash_async_dwarf_decode_uleb128(buffer, sizeof(buffer), &uval, &size), PLCRASH_ESUCCESS, @"Failed to decode %zu byte value", len);
+        STAssertEquals(uval, expected, @"Incorrect value decoded for %zu byte value", len);
+        STAssertEquals(size, (pl_vm_size_t) len, @"Incorrect length for %zu byte value", len);
+
+        /* Bytewise path; the span exactly covers the encoded value */
+        STAssertEquals(plcrash_async_dwarf_decode_uleb128(buffer, len, &uval, &size), PLCRASH_ESUCCESS, @"Failed to decode %zu byte value", len);
+        STAssertEquals(uval, expected, @"Incorrect value decoded for %zu byte value", len);
+        STAssertEquals(size, (pl_vm_size_t) len, @"Incorrect length for %zu byte value", len);
+
+        /* Truncated input must not be decoded */
+        STAssertEquals(plcrash_async_dwarf_decode_uleb128(buffer, len - 1, &uval, &size), PLCRASH_EINVAL, @"Decoded truncated %zu byte value", len);
+
+        /* Negative SLEB128 of the same length: -1, encoded as all 7-bit groups set */
+        if (len < 10) {
+            memset(buffer, 0xFF, len);
+            buffer[len - 1] = 0x7F;
+
+            int64_t sval;
+            STAssertEquals(plcrash_async_dwarf_decode_sleb128(buffer, sizeof(buffer), &sval, &size), PLCRASH_ESUCCESS, @"Failed to decode %zu byte value", len);
+            STAssertEquals(sval, (int64_t) -1, @"Incorrect value decoded for %zu byte value", len);
+            STAssertEquals(plcrash_async_dwarf_decode_sleb128(buffer, len, &sval, &size), PLCRASH_ESUCCESS, @"Failed to decode %zu byte value", len);
+            STAssertEquals(sval, (int64_t) -1, @"Incorrect value decoded for %zu byte value", len);
+            STAssertEquals(size, (pl_vm_size_t) len, @"Incorrect length for %zu byte value", len);
+        }
+    }
+
+    /* Values larger than 64 bits are rejected */
+    memset(buffer, 0x80, sizeof(buffer));
+    uint64_t uval;
+    STAssertEquals(plcrash_async_dwarf_decode_uleb128(buffer, sizeof(buffer), &uval, &size), PLCRASH_ENOTSUP, @"Decoded a LEB128 value larger than 64 bits");
+}
+
+/**
+ * Measure LEB128 decoding throughput from an opcode stream.
+ */
+- (void) testReadLEB128Performance {
+    const size_t count = 4096;
+    uint8_t *opcodes = (uint8_t *) malloc(count * 10);
+    size_t len = 0;
+
+    /* Mix of short and long encodings, as found in CFA programs */
+    for (size_t i = 0; i < count; i++)
+        len += encode_uleb128((uint64_t) i * 0x9E3779B97F4A7C15ULL >> ((i % 8) * 8), opcodes + len, 0);
+
+    plcrash_async_mobject_t mobj;
+    STAssertEquals(PLCRASH_ESUCCESS, plcrash_async_mobject_init(&mobj, mach_task_self(), (pl_vm_address_t)opcodes, len, true), @"Failed to initialize mobj");
+
+    [self measureBlock: ^{
+        for (int iteration = 0; iteration < 100; iteration++) {
+            dwarf_opstream stream;
+            STAssertEquals(PLCRASH_ESUCCESS, stream.init(&mobj, plcrash_async_byteorder_big_endian(), (pl_vm_address_t)opcodes, 0, len), @"Failed to initialize opcode stream");
+
+            uint64_t val;
+            for (size_t i = 0; i < count; i++) {
+                if (!stream.read_uleb128(&val)) {
+                    STFail(@"Failed to read value %zu", i);
+                    return;
+                }
+            }
+        }
+    }];
+
+    plcrash_async_mobject_free(&mobj);
+    free(opcodes);
+}
+
 /**
  * Test pointer read from an opcode stream.
  */